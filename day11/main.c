@@ -223,6 +223,13 @@ static int run() {
   uint64_t last = GetTickCount64();
   uint64_t now = last;
   uint64_t delta = now - last;
+
+#if defined(DX_ENGINE_WITH_BENCHMARKS) && 1 == DX_ENGINE_WITH_BENCHMARKS
+  // The time spent in on_render_scene and the number of frames since the last report.
+  // A report is written every 1024 frames.
+  dx_n64 render_time = 0;
+  dx_size number_of_frames = 0;
+#endif
   
   while (!g_quit) {
     dx_fps_counter_on_enter_frame(g_fps_counter);
@@ -279,6 +286,9 @@ static int run() {
       LEAVE(DX_C_FUNCTION_NAME);
       return 1;
     }
+#if defined(DX_ENGINE_WITH_BENCHMARKS) && 1 == DX_ENGINE_WITH_BENCHMARKS
+    dx_n64 render_start = dx_os_get_time_ns();
+#endif
     if (on_render_scene(ctx, ((dx_f32)delta)/1000.f, canvas_width, canvas_height)) {
       dx_gl_wgl_leave_frame();
       dx_fps_counter_on_leave_frame(g_fps_counter);
@@ -286,6 +296,14 @@ static int run() {
       LEAVE(DX_C_FUNCTION_NAME);
       return 1;
     }
+#if defined(DX_ENGINE_WITH_BENCHMARKS) && 1 == DX_ENGINE_WITH_BENCHMARKS
+    render_time += dx_os_get_time_ns() - render_start;
+    if (++number_of_frames == 1024) {
+      dx_log_benchmark("render loop (on_render_scene)", render_time, number_of_frames);
+      render_time = 0;
+      number_of_frames = 0;
+    }
+#endif
     dx_gl_wgl_leave_frame();
     dx_fps_counter_on_leave_frame(g_fps_counter);
     //
@@ -3,11 +3,21 @@
 #include "dx/adl.h"
 
 dx_asset_scene* _create_scene_from_text(char const* adl_text, dx_size adl_text_length) {
+#if defined(DX_ENGINE_WITH_BENCHMARKS) && 1 == DX_ENGINE_WITH_BENCHMARKS
+  dx_n64 start = dx_os_get_time_ns();
+#endif
   dx_ddl_node* adl_node = dx_ddl_compile(adl_text, adl_text_length);
   if (!adl_node) {
     return NULL;
   }
+#if defined(DX_ENGINE_WITH_BENCHMARKS) && 1 == DX_ENGINE_WITH_BENCHMARKS
+  dx_log_benchmark("DDL compile", dx_os_get_time_ns() - start, 1);
+  start = dx_os_get_time_ns();
+#endif
   dx_asset_scene* asset_scene = dx_adl_compile(adl_node);
+#if defined(DX_ENGINE_WITH_BENCHMARKS) && 1 == DX_ENGINE_WITH_BENCHMARKS
+  dx_log_benchmark("ADL compile", dx_os_get_time_ns() - start, 1);
+#endif
   DX_UNREFERENCE(adl_node);
   adl_node = NULL;
   return asset_scene;
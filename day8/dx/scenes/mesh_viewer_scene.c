@@ -1,7 +1,5 @@
 #include "dx/scenes/mesh_viewer_scene.h"
 
-// _strdup
-#include <string.h>
 // sinf
 #include <math.h>
 // snprintf
@@ -181,10 +179,55 @@ static int dx_mesh_viewer_scene_startup(dx_mesh_viewer_scene* self, dx_context*
     return 1;
   }
 #endif
+#if defined(DX_CONVERT_WITH_TESTS) && 1 == DX_CONVERT_WITH_TESTS
+  if (dx_convert_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_STRING_FORMAT_WITH_TESTS) && 1 == DX_STRING_FORMAT_WITH_TESTS
+  if (dx_string_format_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_ALGORITHMS_WITH_TESTS) && 1 == DX_ALGORITHMS_WITH_TESTS
+  if (dx_algorithms_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_MSG_QUEUE_WITH_TESTS) && 1 == DX_MSG_QUEUE_WITH_TESTS
+  if (dx_msg_queue_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_OBJECT_WITH_TESTS) && 1 == DX_OBJECT_WITH_TESTS
+  if (dx_object_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_HASH_WITH_TESTS) && 1 == DX_HASH_WITH_TESTS
+  if (dx_hash_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_POINTER_HASHMAP_WITH_TESTS) && 1 == DX_POINTER_HASHMAP_WITH_TESTS
+  if (dx_pointer_hashmap_tests()) {
+    return 1;
+  }
+#endif
+#if defined(DX_TYPED_HASHMAP_WITH_TESTS) && 1 == DX_TYPED_HASHMAP_WITH_TESTS
+  if (dx_typed_hashmap_tests()) {
+    return 1;
+  }
+#endif
 #if defined(DX_DDL_PARSER_WITH_TESTS) && 1 == DX_DDL_PARSER_WITH_TESTS
   if (dx_ddl_parser_tests()) {
     return 1;
   }
+#endif
+#if defined(DX_DDL_NODE_WITH_TESTS) && 1 == DX_DDL_NODE_WITH_TESTS
+  if (dx_ddl_node_tests()) {
+    return 1;
+  }
 #endif
   {
     char* p;
@@ -343,7 +386,7 @@ int dx_mesh_viewer_scene_construct(dx_mesh_viewer_scene* self, char const* name)
     return 1;
   }
 
-  self->name = _strdup(name);
+  self->name = dx_memory_duplicate_string(name);
   if (!self->name) {
     return 1;
   }
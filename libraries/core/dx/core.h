@@ -20,6 +20,7 @@
 /// @defgroup core-file-system Core functionality related to the file system
 /// @ingroup core
 
+#include "dx/core/algorithms.h"
 #include "dx/core/byte_array.h"
 #include "dx/core/canvas_msgs.h"
 #include "dx/core/convert.h"
@@ -39,6 +40,7 @@
 #include "dx/core/safe_mul_ix.h"
 #include "dx/core/safe_mul_nx.h"
 #include "dx/core/string.h"
+#include "dx/core/typed_hashmap.h"
 #include "dx/core/pointer_array.h"
 #include "dx/core/visuals.h"
 
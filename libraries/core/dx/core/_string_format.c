@@ -1,15 +1,21 @@
 #include "dx/core/_string_format.h"
 
-// memcpy
+// memcpy, memmove, memset, strlen
 #include <string.h>
-// snprintf
-#include <stdio.h>
 
+#include "dx/core/memory.h"
 #include "dx/core/string.h"
+#include "dx/core/safe_mul_nx.h"
+#if defined(DX_STRING_FORMAT_WITH_TESTS) && 1 == DX_STRING_FORMAT_WITH_TESTS
+  #include "dx/core/convert.h"
+#endif
+#if defined(DX_STRING_FORMAT_WITH_TESTS) && 1 == DX_STRING_FORMAT_WITH_TESTS && defined(DX_STRING_FORMAT_WITH_BENCHMARKS) && 1 == DX_STRING_FORMAT_WITH_BENCHMARKS
+  #include "dx/core/os.h"
+  // snprintf
+  #include <stdio.h>
+#endif
 //#include "dx/core/byte_array.h"
-//#include "dx/core/memory.h"
 //#include "dx/core/safe_add_nx.h"
-//#include "dx/core/safe_mul_nx.h"
 //#include <stdarg.h>
 
 #define PRINT_PRECISION_8 (8)
@@ -84,8 +90,10 @@ static int parse(char const** start, char const* end) {
   (*start)++;
   if ((*start) == end) return PRINT_ERROR;
   
-  if (IS('$'))
+  if (IS('$')) {
+    (*start)++;
     return PRINT_DOLLAR;
+  }
   if (!IS('{'))
     return PRINT_ERROR;
 
@@ -141,161 +149,1024 @@ static int parse(char const** start, char const* end) {
 
 #undef IS
 
-int dx__format_v(dx_byte_array* buffer, char const* start, char const* end, va_list arguments) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+// Integers are formatted two digits at a time using a table of the 100 digit pairs.
+
+static char const g_digit_pairs[200] = {
+  '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+  '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+  '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+  '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+  '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+  '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+  '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+  '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+  '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+  '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+/// @brief Get the number of decimal digits of a value.
+/// @param x The value.
+/// @return The number of decimal digits. At least @a 1.
+static inline dx_size _dx_format_number_of_digits(uint64_t x) {
+  dx_size n = 1;
+  while (x >= 10000) {
+    x /= 10000;
+    n += 4;
+  }
+  if (x >= 1000) {
+    return n + 3;
+  } else if (x >= 100) {
+    return n + 2;
+  } else if (x >= 10) {
+    return n + 1;
+  } else {
+    return n;
+  }
+}
+
+/// @brief Write the decimal digits of a value.
+/// @param p A pointer to an array of at least _dx_format_number_of_digits(x) Bytes.
+/// @param n The number of digits as computed by _dx_format_number_of_digits(x).
+/// @param x The value.
+static inline void _dx_format_digits(char* p, dx_size n, uint64_t x) {
+  char* q = p + n;
+  while (x >= 100) {
+    uint64_t r = x % 100;
+    x /= 100;
+    q -= 2;
+    memcpy(q, g_digit_pairs + 2 * r, 2);
+  }
+  if (x >= 10) {
+    q -= 2;
+    memcpy(q, g_digit_pairs + 2 * x, 2);
+  } else {
+    *(--q) = (char)('0' + x);
+  }
+}
+
+/// @brief Format an unsigned integer value.
+/// @param p A pointer to an array of at least 20 Bytes.
+/// @param x The value.
+/// @return The number of Bytes written.
+static dx_size _dx_format_n64(char* p, uint64_t x) {
+  dx_size n = _dx_format_number_of_digits(x);
+  _dx_format_digits(p, n, x);
+  return n;
+}
+
+/// @brief Format a signed integer value.
+/// @param p A pointer to an array of at least 20 Bytes.
+/// @param x The value.
+/// @return The number of Bytes written.
+static dx_size _dx_format_i64(char* p, int64_t x) {
+  if (x < 0) {
+    *p = '-';
+    // Compute the magnitude in unsigned arithmetic. Does not overflow for INT64_MIN.
+    return 1 + _dx_format_n64(p + 1, UINT64_C(0) - (uint64_t)x);
+  } else {
+    return _dx_format_n64(p, (uint64_t)x);
+  }
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+// Floating point values are formatted as the shortest decimal that converts back to the same value
+// using the Ryu algorithm as described in "Ryu: Fast Float-to-String Conversion" by Ulf Adams, PLDI 2018.
+// The output is locale-independent and is accepted by dx_convert_utf8bytes_to_f32/dx_convert_utf8bytes_to_f64.
+
+#define DX_FORMAT_POW5_INV_BITCOUNT_64 (125)
+#define DX_FORMAT_POW5_BITCOUNT_64 (125)
+#define DX_FORMAT_POW5_INV_BITCOUNT_32 (59)
+#define DX_FORMAT_POW5_BITCOUNT_32 (61)
+
+static uint64_t const g_pow5_inv_split_64[][2] = {
+#define POW5_INV_SPLIT_64(LOW, HIGH) { UINT64_C(LOW), UINT64_C(HIGH) },
+#define POW5_SPLIT_64(LOW, HIGH)
+#define POW5_INV_SPLIT_32(VALUE)
+#define POW5_SPLIT_32(VALUE)
+#include "dx/core/_string_format_ryu.i"
+#undef POW5_SPLIT_32
+#undef POW5_INV_SPLIT_32
+#undef POW5_SPLIT_64
+#undef POW5_INV_SPLIT_64
+};
+
+static uint64_t const g_pow5_split_64[][2] = {
+#define POW5_INV_SPLIT_64(LOW, HIGH)
+#define POW5_SPLIT_64(LOW, HIGH) { UINT64_C(LOW), UINT64_C(HIGH) },
+#define POW5_INV_SPLIT_32(VALUE)
+#define POW5_SPLIT_32(VALUE)
+#include "dx/core/_string_format_ryu.i"
+#undef POW5_SPLIT_32
+#undef POW5_INV_SPLIT_32
+#undef POW5_SPLIT_64
+#undef POW5_INV_SPLIT_64
+};
+
+static uint64_t const g_pow5_inv_split_32[] = {
+#define POW5_INV_SPLIT_64(LOW, HIGH)
+#define POW5_SPLIT_64(LOW, HIGH)
+#define POW5_INV_SPLIT_32(VALUE) UINT64_C(VALUE),
+#define POW5_SPLIT_32(VALUE)
+#include "dx/core/_string_format_ryu.i"
+#undef POW5_SPLIT_32
+#undef POW5_INV_SPLIT_32
+#undef POW5_SPLIT_64
+#undef POW5_INV_SPLIT_64
+};
+
+static uint64_t const g_pow5_split_32[] = {
+#define POW5_INV_SPLIT_64(LOW, HIGH)
+#define POW5_SPLIT_64(LOW, HIGH)
+#define POW5_INV_SPLIT_32(VALUE)
+#define POW5_SPLIT_32(VALUE) UINT64_C(VALUE),
+#include "dx/core/_string_format_ryu.i"
+#undef POW5_SPLIT_32
+#undef POW5_INV_SPLIT_32
+#undef POW5_SPLIT_64
+#undef POW5_INV_SPLIT_64
+};
+
+/// @brief Compute ceil(log2(5^e)) for e in [1, 3528] and 1 for e = 0.
+static inline int32_t _dx_pow5_bits(int32_t e) {
+  return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+/// @brief Compute floor(log10(2^e)) for e in [0, 1650].
+static inline uint32_t _dx_log10_pow2(int32_t e) {
+  return ((uint32_t)e * 78913) >> 18;
+}
+
+/// @brief Compute floor(log10(5^e)) for e in [0, 2620].
+static inline uint32_t _dx_log10_pow5(int32_t e) {
+  return ((uint32_t)e * 732923) >> 20;
+}
+
+static inline uint32_t _dx_pow5_factor_64(uint64_t x) {
+  uint32_t count = 0;
+  while (x % 5 == 0) {
+    x /= 5;
+    count++;
+  }
+  return count;
+}
+
+static inline bool _dx_is_multiple_of_pow5_64(uint64_t x, uint32_t p) {
+  return _dx_pow5_factor_64(x) >= p;
+}
+
+static inline bool _dx_is_multiple_of_pow2_64(uint64_t x, uint32_t p) {
+  return (x & ((UINT64_C(1) << p) - 1)) == 0;
+}
+
+/// @brief Compute <code>(m * mul) >> j</code> where @a mul is a 128 bit value and 64 < j < 128.
+static inline uint64_t _dx_mul_shift_64(uint64_t m, uint64_t const* mul, int32_t j) {
+  uint64_t high0, high1;
+  dx_mul_u64(m, mul[0], &high0);
+  uint64_t low1 = dx_mul_u64(m, mul[1], &high1);
+  uint64_t sum = high0 + low1;
+  if (sum < high0) {
+    high1++;
+  }
+  int32_t shift = j - 64;
+  return (sum >> shift) | (high1 << (64 - shift));
+}
+
+/// @brief Compute the shortest decimal <code>*output * 10^*exponent</code> of a finite positive dx_f64 value.
+/// @param mantissa The IEEE 754 mantissa Bits.
+/// @param exponent The IEEE 754 exponent Bits.
+static void _dx_ryu_f64(uint64_t ieee_mantissa, uint32_t ieee_exponent, uint64_t* output, int32_t* exponent) {
+  int32_t e2;
+  uint64_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - 1023 - 52 - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = (int32_t)ieee_exponent - 1023 - 52 - 2;
+    m2 = (UINT64_C(1) << 52) | ieee_mantissa;
+  }
+  bool const accept_bounds = (m2 & 1) == 0;
+  // The interval of valid decimal representations is [mv - mm_shift - 1, mv + 2] / 4 * 2^e2.
+  uint64_t const mv = 4 * m2;
+  uint32_t const mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  bool vm_is_trailing_zeros = false, vr_is_trailing_zeros = false;
+  if (e2 >= 0) {
+    uint32_t const q = _dx_log10_pow2(e2) - (e2 > 3);
+    e10 = (int32_t)q;
+    int32_t const k = DX_FORMAT_POW5_INV_BITCOUNT_64 + _dx_pow5_bits((int32_t)q) - 1;
+    int32_t const i = -e2 + (int32_t)q + k;
+    vr = _dx_mul_shift_64(4 * m2, g_pow5_inv_split_64[q], i);
+    vp = _dx_mul_shift_64(4 * m2 + 2, g_pow5_inv_split_64[q], i);
+    vm = _dx_mul_shift_64(4 * m2 - 1 - mm_shift, g_pow5_inv_split_64[q], i);
+    if (q <= 21) {
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = _dx_is_multiple_of_pow5_64(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = _dx_is_multiple_of_pow5_64(mv - 1 - mm_shift, q);
+      } else {
+        vp -= _dx_is_multiple_of_pow5_64(mv + 2, q);
+      }
+    }
+  } else {
+    uint32_t const q = _dx_log10_pow5(-e2) - (-e2 > 1);
+    e10 = (int32_t)q + e2;
+    int32_t const i = -e2 - (int32_t)q;
+    int32_t const k = _dx_pow5_bits(i) - DX_FORMAT_POW5_BITCOUNT_64;
+    int32_t const j = (int32_t)q - k;
+    vr = _dx_mul_shift_64(4 * m2, g_pow5_split_64[i], j);
+    vp = _dx_mul_shift_64(4 * m2 + 2, g_pow5_split_64[i], j);
+    vm = _dx_mul_shift_64(4 * m2 - 1 - mm_shift, g_pow5_split_64[i], j);
+    if (q <= 1) {
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = _dx_is_multiple_of_pow2_64(mv, q);
+    }
+  }
+  // Remove digits as long as the interval contains a shorter representation.
+  int32_t removed = 0;
+  uint8_t last_removed_digit = 0;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    while (vp / 10 > vm / 10) {
+      vm_is_trailing_zeros &= vm % 10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = (uint8_t)(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_is_trailing_zeros) {
+      while (vm % 10 == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = (uint8_t)(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+      // Round to even if the exact value is .....50..0.
+      last_removed_digit = 4;
+    }
+    *output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5);
+  } else {
+    // The common case.
+    bool round_up = false;
+    if (vp / 100 > vm / 100) {
+      round_up = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while (vp / 10 > vm / 10) {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    *output = vr + (vr == vm || round_up);
+  }
+  *exponent = e10 + removed;
+}
+
+static inline uint32_t _dx_pow5_factor_32(uint32_t x) {
+  uint32_t count = 0;
+  while (x % 5 == 0) {
+    x /= 5;
+    count++;
+  }
+  return count;
+}
+
+static inline bool _dx_is_multiple_of_pow5_32(uint32_t x, uint32_t p) {
+  return _dx_pow5_factor_32(x) >= p;
+}
+
+static inline bool _dx_is_multiple_of_pow2_32(uint32_t x, uint32_t p) {
+  return (x & ((UINT32_C(1) << p) - 1)) == 0;
+}
+
+/// @brief Compute <code>(m * factor) >> shift</code> where 32 < shift.
+static inline uint32_t _dx_mul_shift_32(uint32_t m, uint64_t factor, int32_t shift) {
+  uint64_t const bits0 = (uint64_t)m * (uint32_t)factor;
+  uint64_t const bits1 = (uint64_t)m * (uint32_t)(factor >> 32);
+  uint64_t const sum = (bits0 >> 32) + bits1;
+  return (uint32_t)(sum >> (shift - 32));
+}
+
+/// @brief Compute the shortest decimal <code>*output * 10^*exponent</code> of a finite positive dx_f32 value.
+/// @param mantissa The IEEE 754 mantissa Bits.
+/// @param exponent The IEEE 754 exponent Bits.
+static void _dx_ryu_f32(uint32_t ieee_mantissa, uint32_t ieee_exponent, uint64_t* output, int32_t* exponent) {
+  int32_t e2;
+  uint32_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - 127 - 23 - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = (int32_t)ieee_exponent - 127 - 23 - 2;
+    m2 = (UINT32_C(1) << 23) | ieee_mantissa;
+  }
+  bool const accept_bounds = (m2 & 1) == 0;
+  // The interval of valid decimal representations is [mm, mp] / 4 * 2^e2.
+  uint32_t const mv = 4 * m2;
+  uint32_t const mp = 4 * m2 + 2;
+  uint32_t const mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+  uint32_t const mm = 4 * m2 - 1 - mm_shift;
+  uint32_t vr, vp, vm;
+  int32_t e10;
+  bool vm_is_trailing_zeros = false, vr_is_trailing_zeros = false;
+  uint8_t last_removed_digit = 0;
+  if (e2 >= 0) {
+    uint32_t const q = _dx_log10_pow2(e2);
+    e10 = (int32_t)q;
+    int32_t const k = DX_FORMAT_POW5_INV_BITCOUNT_32 + _dx_pow5_bits((int32_t)q) - 1;
+    int32_t const i = -e2 + (int32_t)q + k;
+    vr = _dx_mul_shift_32(mv, g_pow5_inv_split_32[q], i);
+    vp = _dx_mul_shift_32(mp, g_pow5_inv_split_32[q], i);
+    vm = _dx_mul_shift_32(mm, g_pow5_inv_split_32[q], i);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      // One removed digit is needed even if the loop below does not remove any digits.
+      int32_t const l = DX_FORMAT_POW5_INV_BITCOUNT_32 + _dx_pow5_bits((int32_t)(q - 1)) - 1;
+      last_removed_digit = (uint8_t)(_dx_mul_shift_32(mv, g_pow5_inv_split_32[q - 1], -e2 + (int32_t)q - 1 + l) % 10);
+    }
+    if (q <= 9) {
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = _dx_is_multiple_of_pow5_32(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = _dx_is_multiple_of_pow5_32(mm, q);
+      } else {
+        vp -= _dx_is_multiple_of_pow5_32(mp, q);
+      }
+    }
+  } else {
+    uint32_t const q = _dx_log10_pow5(-e2);
+    e10 = (int32_t)q + e2;
+    int32_t const i = -e2 - (int32_t)q;
+    int32_t const k = _dx_pow5_bits(i) - DX_FORMAT_POW5_BITCOUNT_32;
+    int32_t j = (int32_t)q - k;
+    vr = _dx_mul_shift_32(mv, g_pow5_split_32[i], j);
+    vp = _dx_mul_shift_32(mp, g_pow5_split_32[i], j);
+    vm = _dx_mul_shift_32(mm, g_pow5_split_32[i], j);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      j = (int32_t)q - 1 - (_dx_pow5_bits(i + 1) - DX_FORMAT_POW5_BITCOUNT_32);
+      last_removed_digit = (uint8_t)(_dx_mul_shift_32(mv, g_pow5_split_32[i + 1], j) % 10);
+    }
+    if (q <= 1) {
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 31) {
+      vr_is_trailing_zeros = _dx_is_multiple_of_pow2_32(mv, q - 1);
+    }
+  }
+  // Remove digits as long as the interval contains a shorter representation.
+  int32_t removed = 0;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    while (vp / 10 > vm / 10) {
+      vm_is_trailing_zeros &= vm % 10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = (uint8_t)(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_is_trailing_zeros) {
+      while (vm % 10 == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = (uint8_t)(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+      // Round to even if the exact value is .....50..0.
+      last_removed_digit = 4;
+    }
+    *output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5);
+  } else {
+    while (vp / 10 > vm / 10) {
+      last_removed_digit = (uint8_t)(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    *output = vr + (vr == vm || last_removed_digit >= 5);
+  }
+  *exponent = e10 + removed;
+}
+
+/// @brief Format a decimal <code>output * 10^exponent</code>.
+/// Values with a decimal exponent in [-5, 17) are formatted in positional notation, other values in scientific notation.
+/// @param p A pointer to an array of at least 32 Bytes.
+/// @param negative @a true if the value is negative.
+/// @param output, exponent The decimal.
+/// @return The number of Bytes written.
+static dx_size _dx_format_decimal(char* p, bool negative, uint64_t output, int32_t exponent) {
+  char* q = p;
+  if (negative) {
+    *(q++) = '-';
+  }
+  dx_size n = _dx_format_number_of_digits(output);
+  // The exponent of the value in scientific notation.
+  int32_t scientific_exponent = exponent + (int32_t)n - 1;
+  if (-5 <= scientific_exponent && scientific_exponent < 17) {
+    if (exponent >= 0) {
+      // ddd000
+      _dx_format_digits(q, n, output);
+      q += n;
+      memset(q, '0', (dx_size)exponent);
+      q += exponent;
+    } else if (scientific_exponent >= 0) {
+      // dd.ddd
+      dx_size m = (dx_size)(scientific_exponent + 1);
+      _dx_format_digits(q + 1, n, output);
+      memmove(q, q + 1, m);
+      q[m] = '.';
+      q += n + 1;
+    } else {
+      // 0.000ddd
+      dx_size z = (dx_size)(-scientific_exponent - 1);
+      *(q++) = '0';
+      *(q++) = '.';
+      memset(q, '0', z);
+      q += z;
+      _dx_format_digits(q, n, output);
+      q += n;
+    }
+  } else {
+    // d.ddde+xx
+    _dx_format_digits(q + 1, n, output);
+    q[0] = q[1];
+    if (n > 1) {
+      q[1] = '.';
+      q += n + 1;
+    } else {
+      q += 1;
+    }
+    *(q++) = 'e';
+    *(q++) = scientific_exponent < 0 ? '-' : '+';
+    q += _dx_format_n64(q, (uint64_t)(scientific_exponent < 0 ? -scientific_exponent : scientific_exponent));
+  }
+  return (dx_size)(q - p);
+}
+
+/// @brief Format a non-finite value or zero.
+/// @param p A pointer to an array of at least 32 Bytes.
+/// @return The number of Bytes written.
+static dx_size _dx_format_special(char* p, bool negative, bool exponent_all_ones, bool mantissa_zero) {
+  char const* s;
+  if (exponent_all_ones) {
+    s = mantissa_zero ? (negative ? "-inf" : "inf") : "nan";
+  } else {
+    s = negative ? "-0" : "0";
+  }
+  dx_size n = strlen(s);
+  memcpy(p, s, n);
+  return n;
+}
+
+/// @brief Format a dx_f64 value.
+/// @param p A pointer to an array of at least 32 Bytes.
+/// @param x The value.
+/// @return The number of Bytes written.
+static dx_size _dx_format_f64(char* p, dx_f64 x) {
+  uint64_t bits;
+  memcpy(&bits, &x, sizeof(dx_f64));
+  bool const negative = (bits >> 63) != 0;
+  uint64_t const ieee_mantissa = bits & ((UINT64_C(1) << 52) - 1);
+  uint32_t const ieee_exponent = (uint32_t)((bits >> 52) & 0x7FF);
+  if (ieee_exponent == 0x7FF || (ieee_exponent == 0 && ieee_mantissa == 0)) {
+    return _dx_format_special(p, negative, ieee_exponent == 0x7FF, ieee_mantissa == 0);
+  }
+  uint64_t output;
+  int32_t exponent;
+  _dx_ryu_f64(ieee_mantissa, ieee_exponent, &output, &exponent);
+  return _dx_format_decimal(p, negative, output, exponent);
+}
+
+/// @brief Format a dx_f32 value.
+/// @param p A pointer to an array of at least 32 Bytes.
+/// @param x The value.
+/// @return The number of Bytes written.
+static dx_size _dx_format_f32(char* p, dx_f32 x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(dx_f32));
+  bool const negative = (bits >> 31) != 0;
+  uint32_t const ieee_mantissa = bits & ((UINT32_C(1) << 23) - 1);
+  uint32_t const ieee_exponent = (bits >> 23) & 0xFF;
+  if (ieee_exponent == 0xFF || (ieee_exponent == 0 && ieee_mantissa == 0)) {
+    return _dx_format_special(p, negative, ieee_exponent == 0xFF, ieee_mantissa == 0);
+  }
+  uint64_t output;
+  int32_t exponent;
+  _dx_ryu_f32(ieee_mantissa, ieee_exponent, &output, &exponent);
+  return _dx_format_decimal(p, negative, output, exponent);
+}
+
+static int _dx_format_sink_append(dx__format_sink* sink, char const* bytes, dx_size number_of_bytes) {
+  if (sink->array) {
+    return dx_byte_array_append(sink->array, bytes, number_of_bytes);
+  }
+  if (sink->capacity - sink->size < number_of_bytes) {
+    dx_set_error(DX_OVERFLOW);
+    return 1;
+  }
+  memcpy(sink->bytes + sink->size, bytes, number_of_bytes);
+  sink->size += number_of_bytes;
+  return 0;
+}
+
+/// @brief Format the next argument.
+/// @param sink A pointer to the sink.
+/// @param kind The kind of the format specifier. Must not be PRINT_DOLLAR or PRINT_ERROR.
+/// @param arguments A pointer to the arguments.
+/// @return The zero value on success. A non-zero value on failure.
+static int _dx_format_argument(dx__format_sink* sink, int kind, va_list* arguments) {
+  char temporary[32];
+  dx_size n;
+  switch (kind) {
+  case PRINT_STRING: {
+    dx_string* argument = va_arg(*arguments, dx_string*);
+    if (!argument) {
+      dx_set_error(DX_INVALID_ARGUMENT);
+      return 1;
+    }
+    return _dx_format_sink_append(sink, argument->bytes, argument->number_of_bytes);
+  } break;
+  // dx_i8, dx_i16, dx_n8, and dx_n16 arguments are passed as int due to the default argument promotions.
+  case PRINT_I8: {
+    n = _dx_format_i64(temporary, (dx_i8)va_arg(*arguments, int));
+  } break;
+  case PRINT_I16: {
+    n = _dx_format_i64(temporary, (dx_i16)va_arg(*arguments, int));
+  } break;
+  case PRINT_I32: {
+    n = _dx_format_i64(temporary, va_arg(*arguments, dx_i32));
+  } break;
+  case PRINT_I64: {
+    n = _dx_format_i64(temporary, va_arg(*arguments, dx_i64));
+  } break;
+  case PRINT_N8: {
+    n = _dx_format_n64(temporary, (dx_n8)va_arg(*arguments, int));
+  } break;
+  case PRINT_N16: {
+    n = _dx_format_n64(temporary, (dx_n16)va_arg(*arguments, int));
+  } break;
+  case PRINT_N32: {
+    n = _dx_format_n64(temporary, va_arg(*arguments, dx_n32));
+  } break;
+  case PRINT_N64: {
+    n = _dx_format_n64(temporary, va_arg(*arguments, dx_n64));
+  } break;
+  // dx_f32 arguments are passed as double due to the default argument promotions.
+  case PRINT_F32: {
+    n = _dx_format_f32(temporary, (dx_f32)va_arg(*arguments, double));
+  } break;
+  case PRINT_F64: {
+    n = _dx_format_f64(temporary, va_arg(*arguments, dx_f64));
+  } break;
+  default: {
+    // Expected: Format specifier. Received: Unknown format specifier prefix.
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  } break;
+  };
+  return _dx_format_sink_append(sink, temporary, n);
+}
+
+int dx__format_v(dx__format_sink* sink, char const* start, char const* end, va_list arguments) {
+  // Copy the arguments such that they can be passed by pointer.
+  va_list arguments1;
+  va_copy(arguments1, arguments);
   char const* current = start;
   while (current != end) {
     if (*current == '$') {
       // We encountered a format symbol. Store all the bytes up to and excluding the format symbol in the buffer.
-      if (dx_byte_array_append(buffer, start, current - start)) {
+      if (_dx_format_sink_append(sink, start, current - start)) {
+        va_end(arguments1);
         return 1;
       }
       int k = parse(&current, end);
       if (k == PRINT_ERROR) {
         dx_set_error(DX_INVALID_ARGUMENT);
+        va_end(arguments1);
         return 1;
       }
-      switch (k) {
-      case PRINT_STRING: {
-        dx_string* argument = va_arg(arguments, dx_string*);
-        if (!argument) {
-          dx_set_error(DX_INVALID_ARGUMENT);
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, argument->bytes, argument->number_of_bytes)) {
-          return 1;
-        }
-      } break;
-      case PRINT_I8: {
-        dx_i8 argument = va_arg(arguments, dx_i8);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIi8, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_I16: {
-        dx_i16 argument = va_arg(arguments, dx_i16);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIi16, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_I32: {
-        dx_i32 argument = va_arg(arguments, dx_i32);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIi32, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_I64: {
-        dx_i64 argument = va_arg(arguments, dx_i64);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIi64, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_N8: {
-        dx_n8 argument = va_arg(arguments, dx_n8);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIu8, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_N16: {
-        dx_n16 argument = va_arg(arguments, dx_n16);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIu16, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_N32: {
-        dx_n32 argument = va_arg(arguments, dx_n32);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIu32, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_N64: {
-        dx_n64 argument = va_arg(arguments, dx_n64);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%"PRIu64, argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_F32: {
-        dx_f32 argument = va_arg(arguments, dx_f32);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%.14g", argument);
-        if (result < 0 || result >= 44) {
-          return 1;
-        }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
-          return 1;
-        }
-      } break;
-      case PRINT_F64: {
-        dx_f64 argument = va_arg(arguments, dx_f64);
-        char temporary[44];
-        int result = snprintf(temporary, 44, "%.14g", argument);
-        if (result < 0 || result >= 44) {
+      if (k == PRINT_DOLLAR) {
+        static char const bytes[] = "$";
+        if (_dx_format_sink_append(sink, bytes, sizeof(bytes) - 1)) {
+          va_end(arguments1);
           return 1;
         }
-        if (dx_byte_array_append(buffer, temporary, strlen(temporary))) {
+      } else {
+        if (_dx_format_argument(sink, k, &arguments1)) {
+          va_end(arguments1);
           return 1;
         }
-      } break;
-      case PRINT_DOLLAR: {
-        static char const bytes[] = "$";
-        if (dx_byte_array_append(buffer, bytes, sizeof(bytes) - 1)) {
-          return 1;
-        }
-      } break;
-      default: {
-        // Expected: Format specifier. Received: Unknown format specifier prefix.
-        dx_set_error(DX_INVALID_ARGUMENT);
-        return 1;
-      } break;
-      };
+      }
       start = current;
     } else {
       current++;
     }
   }
+  va_end(arguments1);
   if (start != current) {
-    if (dx_byte_array_append(buffer, start, current - start)) {
+    if (_dx_format_sink_append(sink, start, current - start)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int dx__format_compile(char const* start, char const* end, dx__format_op** ops, dx_size* number_of_ops, char** bytes, dx_size* number_of_bytes) {
+  if (!start || !end || !ops || !number_of_ops || !bytes || !number_of_bytes) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  // A format of n Bytes compiles to at most n operations followed by at most n literal Bytes.
+  dx_size n = (dx_size)(end - start);
+  if (n > SIZE_MAX / (sizeof(dx__format_op) + 1)) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return 1;
+  }
+  dx__format_op* ops1 = dx_memory_allocate(sizeof(dx__format_op) * n + n + 1);
+  if (!ops1) {
+    return 1;
+  }
+  char* bytes1 = (char*)(ops1 + n);
+  dx_size number_of_ops1 = 0, number_of_bytes1 = 0;
+  // The index of the first literal Byte not covered by an operation.
+  dx_size literal = 0;
+  char const* current = start;
+  while (current != end) {
+    if (*current != '$') {
+      bytes1[number_of_bytes1++] = *(current++);
+      continue;
+    }
+    int k = parse(&current, end);
+    if (k == PRINT_ERROR) {
+      dx_memory_deallocate(ops1);
+      dx_set_error(DX_INVALID_ARGUMENT);
+      return 1;
+    }
+    if (k == PRINT_DOLLAR) {
+      bytes1[number_of_bytes1++] = '$';
+      continue;
+    }
+    if (literal != number_of_bytes1) {
+      ops1[number_of_ops1++] = (dx__format_op){ .kind = DX__FORMAT_OP_LITERAL, .offset = literal, .number_of_bytes = number_of_bytes1 - literal };
+      literal = number_of_bytes1;
+    }
+    ops1[number_of_ops1++] = (dx__format_op){ .kind = k, .offset = 0, .number_of_bytes = 0 };
+  }
+  if (literal != number_of_bytes1) {
+    ops1[number_of_ops1++] = (dx__format_op){ .kind = DX__FORMAT_OP_LITERAL, .offset = literal, .number_of_bytes = number_of_bytes1 - literal };
+  }
+  *ops = ops1;
+  *number_of_ops = number_of_ops1;
+  *bytes = bytes1;
+  *number_of_bytes = number_of_bytes1;
+  return 0;
+}
+
+int dx__format_execute_v(dx__format_sink* sink, dx__format_op const* ops, dx_size number_of_ops, char const* bytes, va_list arguments) {
+  // Copy the arguments such that they can be passed by pointer.
+  va_list arguments1;
+  va_copy(arguments1, arguments);
+  for (dx_size i = 0; i < number_of_ops; ++i) {
+    dx__format_op const* op = &ops[i];
+    int result;
+    if (op->kind == DX__FORMAT_OP_LITERAL) {
+      result = _dx_format_sink_append(sink, bytes + op->offset, op->number_of_bytes);
+    } else {
+      result = _dx_format_argument(sink, op->kind, &arguments1);
+    }
+    if (result) {
+      va_end(arguments1);
+      return 1;
+    }
+  }
+  va_end(arguments1);
+  return 0;
+}
+
+#if defined(DX_STRING_FORMAT_WITH_TESTS) && 1 == DX_STRING_FORMAT_WITH_TESTS
+
+// The number of pseudo-random values formatted and converted back per type.
+#define _DX_STRING_FORMAT_TESTS_NUMBER_OF_RANDOM_VALUES (64 * 1024)
+
+// The compiled formats of the tests.
+typedef struct _dx_string_format_tests_formats {
+  dx_string_format* f32;
+  dx_string_format* f64;
+  dx_string_format* i64;
+  dx_string_format* n64;
+} _dx_string_format_tests_formats;
+
+// A value and its expected formatted representation.
+typedef struct _dx_string_format_tests_expected {
+  uint64_t bits;
+  char const* expected;
+} _dx_string_format_tests_expected;
+
+// xorshift64 generating the pseudo-random values.
+static inline uint64_t _dx_string_format_tests_next(uint64_t* state) {
+  uint64_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  *state = x;
+  return x;
+}
+
+static bool _dx_string_format_tests_is_equal(char const* bytes, dx_size number_of_bytes, char const* expected) {
+  return strlen(expected) == number_of_bytes && !memcmp(bytes, expected, number_of_bytes);
+}
+
+// Format a dx_f64 value and convert it back.
+// The value must be obtained bit-exactly. If @a expected is not a null pointer, then the formatted value must be @a expected.
+static int _dx_string_format_tests_f64(dx_string_format* format, uint64_t bits, char const* expected) {
+  char bytes[64];
+  dx_size number_of_bytes;
+  dx_f64 x, y;
+  memcpy(&x, &bits, sizeof(dx_f64));
+  if (dx_string_format_print_bytes(format, bytes, sizeof(bytes), &number_of_bytes, x)) {
+    return 1;
+  }
+  if (expected && !_dx_string_format_tests_is_equal(bytes, number_of_bytes, expected)) {
+    return 1;
+  }
+  if (dx_convert_utf8bytes_to_f64(bytes, number_of_bytes, &y)) {
+    return 1;
+  }
+  return memcmp(&x, &y, sizeof(dx_f64)) ? 1 : 0;
+}
+
+// Format a dx_f32 value and convert it back.
+// The value must be obtained bit-exactly. If @a expected is not a null pointer, then the formatted value must be @a expected.
+static int _dx_string_format_tests_f32(dx_string_format* format, uint32_t bits, char const* expected) {
+  char bytes[64];
+  dx_size number_of_bytes;
+  dx_f32 x, y;
+  memcpy(&x, &bits, sizeof(dx_f32));
+  if (dx_string_format_print_bytes(format, bytes, sizeof(bytes), &number_of_bytes, x)) {
+    return 1;
+  }
+  if (expected && !_dx_string_format_tests_is_equal(bytes, number_of_bytes, expected)) {
+    return 1;
+  }
+  if (dx_convert_utf8bytes_to_f32(bytes, number_of_bytes, &y)) {
+    return 1;
+  }
+  return memcmp(&x, &y, sizeof(dx_f32)) ? 1 : 0;
+}
+
+// Format a dx_i64 value and convert it back.
+static int _dx_string_format_tests_i64(dx_string_format* format, dx_i64 x, char const* expected) {
+  char bytes[64];
+  dx_size number_of_bytes;
+  dx_i64 y;
+  if (dx_string_format_print_bytes(format, bytes, sizeof(bytes), &number_of_bytes, x)) {
+    return 1;
+  }
+  if (expected && !_dx_string_format_tests_is_equal(bytes, number_of_bytes, expected)) {
+    return 1;
+  }
+  if (dx_convert_utf8bytes_to_i64(bytes, number_of_bytes, &y)) {
+    return 1;
+  }
+  return x != y;
+}
+
+// Format a dx_n64 value and convert it back.
+static int _dx_string_format_tests_n64(dx_string_format* format, dx_n64 x, char const* expected) {
+  char bytes[64];
+  dx_size number_of_bytes;
+  dx_n64 y;
+  if (dx_string_format_print_bytes(format, bytes, sizeof(bytes), &number_of_bytes, x)) {
+    return 1;
+  }
+  if (expected && !_dx_string_format_tests_is_equal(bytes, number_of_bytes, expected)) {
+    return 1;
+  }
+  if (dx_convert_utf8bytes_to_n64(bytes, number_of_bytes, &y)) {
+    return 1;
+  }
+  return x != y;
+}
+
+static int _dx_string_format_tests_floats(_dx_string_format_tests_formats* formats) {
+  static _dx_string_format_tests_expected const f64[] = {
+    { UINT64_C(0x0000000000000000), "0" },
+    { UINT64_C(0x8000000000000000), "-0" },
+    { UINT64_C(0x3FF0000000000000), "1" },
+    { UINT64_C(0xBFF0000000000000), "-1" },
+    { UINT64_C(0x3FB999999999999A), "0.1" },
+    { UINT64_C(0x3FD5555555555555), "0.3333333333333333" },
+    // The least and the greatest exponents formatted in positional notation and their neighbours.
+    { UINT64_C(0x3EE4F8B588E368F1), "0.00001" },
+    { UINT64_C(0x3EB0C6F7A0B5ED8D), "1e-6" },
+    { UINT64_C(0x4341C37937E08000), "10000000000000000" },
+    { UINT64_C(0x4376345785D8A000), "1e+17" },
+    { UINT64_C(0x4376345785D89FFF), "99999999999999980" },
+    { UINT64_C(0x437B69B4BA630F35), "1.2345678901234568e+17" },
+    // 2^53 and 2^53 + 2.
+    { UINT64_C(0x4340000000000000), "9007199254740992" },
+    { UINT64_C(0x4340000000000001), "9007199254740994" },
+    // The least subnormal, the greatest subnormal, the least normal, and the greatest finite value.
+    { UINT64_C(0x0000000000000001), "5e-324" },
+    { UINT64_C(0x000FFFFFFFFFFFFF), "2.225073858507201e-308" },
+    { UINT64_C(0x0010000000000000), "2.2250738585072014e-308" },
+    { UINT64_C(0x7FEFFFFFFFFFFFFF), "1.7976931348623157e+308" },
+    { UINT64_C(0xFFEFFFFFFFFFFFFF), "-1.7976931348623157e+308" },
+  };
+  for (dx_size i = 0; i < sizeof(f64) / sizeof(f64[0]); ++i) {
+    if (_dx_string_format_tests_f64(formats->f64, f64[i].bits, f64[i].expected)) {
+      return 1;
+    }
+  }
+  static _dx_string_format_tests_expected const f32[] = {
+    { UINT32_C(0x00000000), "0" },
+    { UINT32_C(0x80000000), "-0" },
+    { UINT32_C(0x3F800000), "1" },
+    { UINT32_C(0x3DCCCCCD), "0.1" },
+    { UINT32_C(0x3EAAAAAB), "0.33333334" },
+    { UINT32_C(0x3727C5AC), "0.00001" },
+    { UINT32_C(0x358637BD), "1e-6" },
+    { UINT32_C(0x5BB1A2BC), "1e+17" },
+    // 2^24 and 2^24 + 2.
+    { UINT32_C(0x4B800000), "16777216" },
+    { UINT32_C(0x4B800001), "16777218" },
+    // The least subnormal, the greatest subnormal, the least normal, and the greatest finite value.
+    { UINT32_C(0x00000001), "1e-45" },
+    { UINT32_C(0x007FFFFF), "1.1754942e-38" },
+    { UINT32_C(0x00800000), "1.1754944e-38" },
+    { UINT32_C(0x7F7FFFFF), "3.4028235e+38" },
+    { UINT32_C(0xFF7FFFFF), "-3.4028235e+38" },
+  };
+  for (dx_size i = 0; i < sizeof(f32) / sizeof(f32[0]); ++i) {
+    if (_dx_string_format_tests_f32(formats->f32, (uint32_t)f32[i].bits, f32[i].expected)) {
+      return 1;
+    }
+  }
+  // Finite values with pseudo-random bits.
+  uint64_t state = UINT64_C(0x9E3779B97F4A7C15);
+  for (dx_size i = 0; i < _DX_STRING_FORMAT_TESTS_NUMBER_OF_RANDOM_VALUES; ++i) {
+    uint64_t bits = _dx_string_format_tests_next(&state);
+    if (0x7FF != ((bits >> 52) & 0x7FF) && _dx_string_format_tests_f64(formats->f64, bits, NULL)) {
+      return 1;
+    }
+    if (0xFF != ((bits >> 23) & 0xFF) && _dx_string_format_tests_f32(formats->f32, (uint32_t)bits, NULL)) {
       return 1;
     }
   }
   return 0;
 }
+
+static int _dx_string_format_tests_integers(_dx_string_format_tests_formats* formats) {
+  if (_dx_string_format_tests_i64(formats->i64, INT64_MIN, "-9223372036854775808") ||
+      _dx_string_format_tests_i64(formats->i64, INT64_MAX, "9223372036854775807") ||
+      _dx_string_format_tests_i64(formats->i64, 0, "0") ||
+      _dx_string_format_tests_i64(formats->i64, -1, "-1") ||
+      _dx_string_format_tests_n64(formats->n64, 0, "0") ||
+      _dx_string_format_tests_n64(formats->n64, UINT64_MAX, "18446744073709551615")) {
+    return 1;
+  }
+  // The boundaries of the numbers of digits: 10^k - 1 and 10^k.
+  dx_n64 power = 1;
+  for (dx_size k = 1; k < 20; ++k) {
+    power *= 10;
+    if (_dx_string_format_tests_n64(formats->n64, power - 1, NULL) || _dx_string_format_tests_n64(formats->n64, power, NULL)) {
+      return 1;
+    }
+    if (k < 19) {
+      if (_dx_string_format_tests_i64(formats->i64, (dx_i64)power - 1, NULL) || _dx_string_format_tests_i64(formats->i64, (dx_i64)power, NULL) ||
+          _dx_string_format_tests_i64(formats->i64, -(dx_i64)power + 1, NULL) || _dx_string_format_tests_i64(formats->i64, -(dx_i64)power, NULL)) {
+        return 1;
+      }
+    }
+  }
+  // Values with pseudo-random bits and numbers of digits.
+  uint64_t state = UINT64_C(0xD1B54A32D192ED03);
+  for (dx_size i = 0; i < _DX_STRING_FORMAT_TESTS_NUMBER_OF_RANDOM_VALUES; ++i) {
+    uint64_t bits = _dx_string_format_tests_next(&state) >> (i % 64);
+    if (_dx_string_format_tests_n64(formats->n64, bits, NULL) || _dx_string_format_tests_i64(formats->i64, (dx_i64)bits, NULL)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+#if defined(DX_STRING_FORMAT_WITH_BENCHMARKS) && 1 == DX_STRING_FORMAT_WITH_BENCHMARKS
+
+// The number of values formatted per benchmark.
+#define _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES (1024 * 1024)
+
+// Compare the formatting of dx_f64 and dx_i64 values with the snprintf path which was used before.
+// "%.17g" is the shortest snprintf format which round-trips all dx_f64 values.
+static int _dx_string_format_tests_benchmark(_dx_string_format_tests_formats* formats) {
+  char bytes[64];
+  dx_size number_of_bytes, total = 0;
+  uint64_t state = UINT64_C(0x9E3779B97F4A7C15);
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES; ++i) {
+    uint64_t bits = _dx_string_format_tests_next(&state) & UINT64_C(0xBFFFFFFFFFFFFFFF);
+    dx_f64 x;
+    memcpy(&x, &bits, sizeof(dx_f64));
+    if (dx_string_format_print_bytes(formats->f64, bytes, sizeof(bytes), &number_of_bytes, x)) {
+      return 1;
+    }
+    total += number_of_bytes;
+  }
+  dx_log_benchmark("dx_string_format_print_bytes ${f64}", dx_os_get_time_ns() - start, _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES);
+  state = UINT64_C(0x9E3779B97F4A7C15);
+  start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES; ++i) {
+    uint64_t bits = _dx_string_format_tests_next(&state) & UINT64_C(0xBFFFFFFFFFFFFFFF);
+    dx_f64 x;
+    memcpy(&x, &bits, sizeof(dx_f64));
+    int result = snprintf(bytes, sizeof(bytes), "%.17g", x);
+    if (result < 0 || (dx_size)result >= sizeof(bytes)) {
+      return 1;
+    }
+    total += (dx_size)result;
+  }
+  dx_log_benchmark("snprintf %.17g", dx_os_get_time_ns() - start, _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES);
+  state = UINT64_C(0xD1B54A32D192ED03);
+  start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES; ++i) {
+    dx_i64 x = (dx_i64)(_dx_string_format_tests_next(&state) >> (i % 64));
+    if (dx_string_format_print_bytes(formats->i64, bytes, sizeof(bytes), &number_of_bytes, x)) {
+      return 1;
+    }
+    total += number_of_bytes;
+  }
+  dx_log_benchmark("dx_string_format_print_bytes ${i64}", dx_os_get_time_ns() - start, _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES);
+  state = UINT64_C(0xD1B54A32D192ED03);
+  start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES; ++i) {
+    dx_i64 x = (dx_i64)(_dx_string_format_tests_next(&state) >> (i % 64));
+    int result = snprintf(bytes, sizeof(bytes), "%"PRIi64, x);
+    if (result < 0 || (dx_size)result >= sizeof(bytes)) {
+      return 1;
+    }
+    total += (dx_size)result;
+  }
+  dx_log_benchmark("snprintf %"PRIi64, dx_os_get_time_ns() - start, _DX_STRING_FORMAT_TESTS_NUMBER_OF_BENCHMARK_VALUES);
+  // Use the total such that the loops are not removed.
+  return 0 == total;
+}
+
+#endif // DX_STRING_FORMAT_WITH_BENCHMARKS
+
+int dx_string_format_tests() {
+  _dx_string_format_tests_formats formats = { NULL, NULL, NULL, NULL };
+  formats.f32 = dx_string_format_create("${f32}", sizeof("${f32}") - 1);
+  formats.f64 = dx_string_format_create("${f64}", sizeof("${f64}") - 1);
+  formats.i64 = dx_string_format_create("${i64}", sizeof("${i64}") - 1);
+  formats.n64 = dx_string_format_create("${n64}", sizeof("${n64}") - 1);
+  int result = !formats.f32 || !formats.f64 || !formats.i64 || !formats.n64;
+  if (!result) {
+    result = _dx_string_format_tests_floats(&formats) || _dx_string_format_tests_integers(&formats);
+  }
+#if defined(DX_STRING_FORMAT_WITH_BENCHMARKS) && 1 == DX_STRING_FORMAT_WITH_BENCHMARKS
+  if (!result) {
+    result = _dx_string_format_tests_benchmark(&formats);
+  }
+#endif
+  if (formats.n64) {
+    DX_UNREFERENCE(formats.n64);
+  }
+  if (formats.i64) {
+    DX_UNREFERENCE(formats.i64);
+  }
+  if (formats.f64) {
+    DX_UNREFERENCE(formats.f64);
+  }
+  if (formats.f32) {
+    DX_UNREFERENCE(formats.f32);
+  }
+  return result;
+}
+
+#endif // DX_STRING_FORMAT_WITH_TESTS
@@ -4,6 +4,48 @@
 #include "dx/core/byte_array.h"
 #include <stdarg.h>
 
-int dx__format_v(dx_byte_array* buffer, char const* start, char const* end, va_list arguments);
+/// @brief The destination of formatted output.
+/// If @a array is not a null pointer, then the output is appended to that dx_byte_array object.
+/// Otherwise the output is written to the array of @a capacity Bytes pointed to by @a bytes
+/// and @a size is the number of Bytes written so far.
+typedef struct dx__format_sink {
+  dx_byte_array* array;
+  char* bytes;
+  dx_size capacity;
+  dx_size size;
+} dx__format_sink;
+
+/// @brief The kind of a dx__format_op which copies literal Bytes.
+#define DX__FORMAT_OP_LITERAL (0)
+
+/// @brief An operation of a compiled format.
+/// If @a kind is DX__FORMAT_OP_LITERAL, then the operation copies @a number_of_bytes Bytes starting at @a offset from the literal Bytes of the format.
+/// Otherwise the operation formats the next argument.
+typedef struct dx__format_op {
+  int kind;
+  dx_size offset;
+  dx_size number_of_bytes;
+} dx__format_op;
+
+int dx__format_v(dx__format_sink* sink, char const* start, char const* end, va_list arguments);
+
+/// @brief Compile a format.
+/// @param start, end The Bytes of the format.
+/// @param ops A pointer to a <code>dx__format_op*</code> variable.
+/// @param number_of_ops A pointer to a <code>dx_size</code> variable.
+/// @param bytes A pointer to a <code>char*</code> variable.
+/// @param number_of_bytes A pointer to a <code>dx_size</code> variable.
+/// @return The zero value on success. A non-zero value on failure.
+/// @success
+/// <code>*ops</code> was assigned a pointer to an array of <code>*number_of_ops</code> operations.
+/// <code>*bytes</code> was assigned a pointer to an array of <code>*number_of_bytes</code> literal Bytes.
+/// Both arrays are stored in a single block which must be deallocated by passing <code>*ops</code> to dx_memory_deallocate.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT the format is not valid
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int dx__format_compile(char const* start, char const* end, dx__format_op** ops, dx_size* number_of_ops, char** bytes, dx_size* number_of_bytes);
+
+/// @brief Execute a compiled format.
+int dx__format_execute_v(dx__format_sink* sink, dx__format_op const* ops, dx_size number_of_ops, char const* bytes, va_list arguments);
 
 #endif // DX_CORE__STRING_FORMAT_H_INCLUDED
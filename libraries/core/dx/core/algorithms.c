@@ -0,0 +1,598 @@
+#include "dx/core/algorithms.h"
+
+#include "dx/core/memory.h"
+#include "dx/core/os.h"
+#include "dx/core/safe_mul_nx.h"
+
+#if defined(_WIN32)
+  // CreateThread, WaitForSingleObject, CloseHandle
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#endif
+
+#if defined(DX_ALGORITHMS_WITH_TESTS) && 1 == DX_ALGORITHMS_WITH_TESTS && defined(DX_ALGORITHMS_WITH_BENCHMARKS) && 1 == DX_ALGORITHMS_WITH_BENCHMARKS
+  // qsort
+  #include <stdlib.h>
+#endif
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief An element and its key.
+/// 32 Bit keys are stored in 64 Bit: The size of an item is the same due to the alignment of the pointer.
+typedef struct _dx_radix_item {
+  uint64_t key;
+  void* element;
+} _dx_radix_item;
+
+/// @brief Sort items by their keys.
+/// @param source A pointer to an array of @a n items to sort.
+/// @param target A pointer to an array of @a n items used as temporary storage.
+/// @param n The number of items.
+/// @param number_of_digits The number of 8 Bit digits of the keys.
+/// @return A pointer to the array (either @a source or @a target) which contains the sorted items.
+static _dx_radix_item* _dx_radix_sort_items(_dx_radix_item* source, _dx_radix_item* target, dx_size n, dx_size number_of_digits) {
+  // The histograms of all digits are computed in a single pass.
+  dx_size counts[8][256] = { 0 };
+  for (dx_size i = 0; i < n; ++i) {
+    uint64_t key = source[i].key;
+    for (dx_size d = 0; d < number_of_digits; ++d) {
+      counts[d][(key >> (d * 8)) & 0xff]++;
+    }
+  }
+  for (dx_size d = 0; d < number_of_digits; ++d) {
+    dx_size* count = counts[d];
+    // If all keys have the same digit, then this pass would not change the order.
+    if (count[(source[0].key >> (d * 8)) & 0xff] == n) {
+      continue;
+    }
+    dx_size offset = 0;
+    for (dx_size i = 0; i < 256; ++i) {
+      dx_size c = count[i];
+      count[i] = offset;
+      offset += c;
+    }
+    for (dx_size i = 0; i < n; ++i) {
+      target[count[(source[i].key >> (d * 8)) & 0xff]++] = source[i];
+    }
+    _dx_radix_item* temporary = source;
+    source = target;
+    target = temporary;
+  }
+  return source;
+}
+
+/// @brief Allocate two arrays of @a n items each.
+static _dx_radix_item* _dx_radix_allocate(dx_size n) {
+  dx_size overflow;
+  dx_size number_of_bytes = dx_mul_sz(n, 2 * sizeof(_dx_radix_item), &overflow);
+  if (overflow) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return NULL;
+  }
+  return dx_memory_allocate(number_of_bytes);
+}
+
+int dx_radix_sort_32(void** elements, dx_size number_of_elements, dx_key_32_callback* key) {
+  if (!elements || !key) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (number_of_elements < 2) {
+    return 0;
+  }
+  _dx_radix_item* items = _dx_radix_allocate(number_of_elements);
+  if (!items) {
+    return 1;
+  }
+  for (dx_size i = 0; i < number_of_elements; ++i) {
+    items[i].key = key(elements[i]);
+    items[i].element = elements[i];
+  }
+  _dx_radix_item* sorted = _dx_radix_sort_items(items, items + number_of_elements, number_of_elements, 4);
+  for (dx_size i = 0; i < number_of_elements; ++i) {
+    elements[i] = sorted[i].element;
+  }
+  dx_memory_deallocate(items);
+  return 0;
+}
+
+int dx_radix_sort_64(void** elements, dx_size number_of_elements, dx_key_64_callback* key) {
+  if (!elements || !key) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (number_of_elements < 2) {
+    return 0;
+  }
+  _dx_radix_item* items = _dx_radix_allocate(number_of_elements);
+  if (!items) {
+    return 1;
+  }
+  for (dx_size i = 0; i < number_of_elements; ++i) {
+    items[i].key = key(elements[i]);
+    items[i].element = elements[i];
+  }
+  _dx_radix_item* sorted = _dx_radix_sort_items(items, items + number_of_elements, number_of_elements, 8);
+  for (dx_size i = 0; i < number_of_elements; ++i) {
+    elements[i] = sorted[i].element;
+  }
+  dx_memory_deallocate(items);
+  return 0;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief The length of the runs sorted by insertion sort.
+#define _DX_MERGE_SORT_RUN_LENGTH (16)
+
+static void _dx_insertion_sort(void** elements, dx_size n, dx_compare_callback* compare) {
+  for (dx_size i = 1; i < n; ++i) {
+    void* x = elements[i];
+    dx_size j = i;
+    while (j > 0 && compare(elements[j - 1], x) > 0) {
+      elements[j] = elements[j - 1];
+      j--;
+    }
+    elements[j] = x;
+  }
+}
+
+/// @brief Merge the sorted ranges [begin, middle) and [middle, end) of @a source into the range [begin, end) of @a target.
+/// If elements are equal, then the element of the first range precedes the element of the second range.
+static void _dx_merge(void** source, void** target, dx_size begin, dx_size middle, dx_size end, dx_compare_callback* compare) {
+  dx_size i = begin, j = middle, k = begin;
+  // If the ranges are already in order, then they are copied.
+  if (i < middle && j < end && compare(source[middle - 1], source[middle]) > 0) {
+    while (i < middle && j < end) {
+      target[k++] = compare(source[j], source[i]) < 0 ? source[j++] : source[i++];
+    }
+  }
+  while (i < middle) {
+    target[k++] = source[i++];
+  }
+  while (j < end) {
+    target[k++] = source[j++];
+  }
+}
+
+/// @brief Sort an array.
+/// @param elements A pointer to an array of @a n elements.
+/// @param temporary A pointer to an array of @a n elements used as temporary storage.
+static void _dx_merge_sort(void** elements, void** temporary, dx_size n, dx_compare_callback* compare) {
+  for (dx_size begin = 0; begin < n; begin += _DX_MERGE_SORT_RUN_LENGTH) {
+    dx_size length = n - begin < _DX_MERGE_SORT_RUN_LENGTH ? n - begin : _DX_MERGE_SORT_RUN_LENGTH;
+    _dx_insertion_sort(elements + begin, length, compare);
+  }
+  void** source = elements, ** target = temporary;
+  for (dx_size width = _DX_MERGE_SORT_RUN_LENGTH; width < n; width *= 2) {
+    for (dx_size begin = 0; begin < n; begin += 2 * width) {
+      dx_size middle = n - begin < width ? n : begin + width;
+      dx_size end = n - middle < width ? n : middle + width;
+      _dx_merge(source, target, begin, middle, end, compare);
+    }
+    void** swap = source;
+    source = target;
+    target = swap;
+  }
+  if (source != elements) {
+    dx_memory_copy(elements, source, n * sizeof(void*));
+  }
+}
+
+/// @brief Allocate an array of @a n pointers.
+static void** _dx_allocate_pointers(dx_size n) {
+  dx_size overflow;
+  dx_size number_of_bytes = dx_mul_sz(n, sizeof(void*), &overflow);
+  if (overflow) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return NULL;
+  }
+  return dx_memory_allocate(number_of_bytes);
+}
+
+int dx_merge_sort(void** elements, dx_size number_of_elements, dx_compare_callback* compare) {
+  if (!elements || !compare) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (number_of_elements <= _DX_MERGE_SORT_RUN_LENGTH) {
+    _dx_insertion_sort(elements, number_of_elements, compare);
+    return 0;
+  }
+  void** temporary = _dx_allocate_pointers(number_of_elements);
+  if (!temporary) {
+    return 1;
+  }
+  _dx_merge_sort(elements, temporary, number_of_elements, compare);
+  dx_memory_deallocate(temporary);
+  return 0;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief The greatest number of parts of an array sorted by dx_parallel_sort.
+#define _DX_PARALLEL_SORT_GREATEST_NUMBER_OF_PARTS (64)
+
+/// @brief A task of dx_parallel_sort.
+typedef struct _dx_sort_task {
+  /// @brief If @a true, then sort the range [begin, end) of @a source using @a target as temporary storage.
+  /// Otherwise merge the ranges [begin, middle) and [middle, end) of @a source into @a target.
+  bool sort;
+  void** source;
+  void** target;
+  dx_size begin;
+  dx_size middle;
+  dx_size end;
+  dx_compare_callback* compare;
+} _dx_sort_task;
+
+static void _dx_sort_task_run(_dx_sort_task* task) {
+  if (task->sort) {
+    _dx_merge_sort(task->source + task->begin, task->target + task->begin, task->end - task->begin, task->compare);
+  } else {
+    _dx_merge(task->source, task->target, task->begin, task->middle, task->end, task->compare);
+  }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI _dx_sort_task_main(LPVOID parameter) {
+  _dx_sort_task_run((_dx_sort_task*)parameter);
+  // The compare callback may allocate.
+  dx_memory_release_thread_cache();
+  return 0;
+}
+#endif
+
+/// @brief Run tasks in parallel.
+/// The first task is run on the calling thread.
+/// If a thread can not be created, then its task is run on the calling thread.
+/// Other environments run all tasks on the calling thread.
+static void _dx_sort_tasks_run(_dx_sort_task* tasks, dx_size number_of_tasks) {
+#if defined(_WIN32)
+  HANDLE threads[_DX_PARALLEL_SORT_GREATEST_NUMBER_OF_PARTS];
+  for (dx_size i = 1; i < number_of_tasks; ++i) {
+    threads[i] = CreateThread(NULL, 0, &_dx_sort_task_main, &tasks[i], 0, NULL);
+    if (!threads[i]) {
+      _dx_sort_task_run(&tasks[i]);
+    }
+  }
+  _dx_sort_task_run(&tasks[0]);
+  for (dx_size i = 1; i < number_of_tasks; ++i) {
+    if (threads[i]) {
+      WaitForSingleObject(threads[i], INFINITE);
+      CloseHandle(threads[i]);
+    }
+  }
+#else
+  for (dx_size i = 0; i < number_of_tasks; ++i) {
+    _dx_sort_task_run(&tasks[i]);
+  }
+#endif
+}
+
+int dx_parallel_sort(void** elements, dx_size number_of_elements, dx_compare_callback* compare) {
+  if (!elements || !compare) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx_error old_error = dx_get_error();
+  dx_size number_of_parts = dx_os_get_number_of_cores();
+  if (!number_of_parts) {
+    dx_set_error(old_error);
+  }
+  if (number_of_elements < DX_PARALLEL_SORT_THRESHOLD || number_of_parts < 2) {
+    return dx_merge_sort(elements, number_of_elements, compare);
+  }
+  if (number_of_parts > _DX_PARALLEL_SORT_GREATEST_NUMBER_OF_PARTS) {
+    number_of_parts = _DX_PARALLEL_SORT_GREATEST_NUMBER_OF_PARTS;
+  }
+  void** temporary = _dx_allocate_pointers(number_of_elements);
+  if (!temporary) {
+    return 1;
+  }
+  _dx_sort_task tasks[_DX_PARALLEL_SORT_GREATEST_NUMBER_OF_PARTS];
+  // bounds[i] is the beginning of the i-th part, bounds[number_of_parts] is the number of elements.
+  dx_size bounds[_DX_PARALLEL_SORT_GREATEST_NUMBER_OF_PARTS + 1];
+  dx_size quotient = number_of_elements / number_of_parts, remainder = number_of_elements % number_of_parts;
+  for (dx_size i = 0; i <= number_of_parts; ++i) {
+    bounds[i] = quotient * i + (i < remainder ? i : remainder);
+  }
+  for (dx_size i = 0; i < number_of_parts; ++i) {
+    tasks[i] = (_dx_sort_task){ .sort = true, .source = elements, .target = temporary,
+                                .begin = bounds[i], .middle = bounds[i + 1], .end = bounds[i + 1], .compare = compare };
+  }
+  _dx_sort_tasks_run(tasks, number_of_parts);
+  // Merge pairs of adjacent parts until there is one part.
+  void** source = elements, ** target = temporary;
+  while (number_of_parts > 1) {
+    dx_size number_of_tasks = 0;
+    for (dx_size i = 0; i < number_of_parts; i += 2) {
+      // If the number of parts is odd, then the last part is merged with an empty part, that is, copied.
+      dx_size middle = bounds[i + 1];
+      dx_size end = i + 2 <= number_of_parts ? bounds[i + 2] : bounds[i + 1];
+      tasks[number_of_tasks] = (_dx_sort_task){ .sort = false, .source = source, .target = target,
+                                                .begin = bounds[i], .middle = middle, .end = end, .compare = compare };
+      bounds[number_of_tasks] = bounds[i];
+      number_of_tasks++;
+    }
+    bounds[number_of_tasks] = number_of_elements;
+    _dx_sort_tasks_run(tasks, number_of_tasks);
+    number_of_parts = number_of_tasks;
+    void** swap = source;
+    source = target;
+    target = swap;
+  }
+  if (source != elements) {
+    dx_memory_copy(elements, source, number_of_elements * sizeof(void*));
+  }
+  dx_memory_deallocate(temporary);
+  return 0;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+dx_size dx_lower_bound(void** elements, dx_size number_of_elements, void* key, dx_compare_callback* compare) {
+  if (!elements || !compare) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 0;
+  }
+  dx_size low = 0, high = number_of_elements;
+  while (low < high) {
+    dx_size middle = low + (high - low) / 2;
+    if (compare(elements[middle], key) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+int dx_binary_search(void** elements, dx_size number_of_elements, void* key, dx_compare_callback* compare, dx_size* index) {
+  if (!elements || !compare || !index) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx_size i = dx_lower_bound(elements, number_of_elements, key, compare);
+  if (i == number_of_elements || compare(elements[i], key) != 0) {
+    dx_set_error(DX_NOT_FOUND);
+    return 1;
+  }
+  *index = i;
+  return 0;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#if defined(DX_ALGORITHMS_WITH_TESTS) && 1 == DX_ALGORITHMS_WITH_TESTS
+
+/// @brief The elements of the tests.
+/// The index is used to check the stability of the sorts.
+typedef struct _dx_algorithms_test_element {
+  uint64_t key;
+  dx_size index;
+} _dx_algorithms_test_element;
+
+static uint32_t _dx_algorithms_test_key_32(void* element) {
+  return (uint32_t)((_dx_algorithms_test_element*)element)->key;
+}
+
+static uint64_t _dx_algorithms_test_key_64(void* element) {
+  return ((_dx_algorithms_test_element*)element)->key;
+}
+
+static int _dx_algorithms_test_compare(void* a, void* b) {
+  uint64_t x = ((_dx_algorithms_test_element*)a)->key, y = ((_dx_algorithms_test_element*)b)->key;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/// @brief Check if an array is sorted by the keys and if elements with equal keys are in their original order.
+static int _dx_algorithms_test_check(void** elements, dx_size n, uint64_t mask) {
+  for (dx_size i = 1; i < n; ++i) {
+    _dx_algorithms_test_element* a = elements[i - 1], * b = elements[i];
+    if ((a->key & mask) > (b->key & mask)) {
+      return 1;
+    }
+    if ((a->key & mask) == (b->key & mask) && a->index > b->index) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/// @brief Test the algorithms with @a n elements of which the keys are masked by @a mask.
+static int _dx_algorithms_test(dx_size n, uint64_t mask, uint64_t* seed) {
+  _dx_algorithms_test_element* storage = NULL;
+  void** elements = NULL;
+  if (n) {
+    storage = dx_memory_allocate(n * sizeof(_dx_algorithms_test_element));
+    if (!storage) {
+      return 1;
+    }
+    elements = dx_memory_allocate(n * sizeof(void*));
+    if (!elements) {
+      dx_memory_deallocate(storage);
+      return 1;
+    }
+  } else {
+    // The functions require a non-null pointer even if the number of elements is zero.
+    static void* empty[1];
+    elements = empty;
+  }
+  int result = 1;
+  for (int algorithm = 0; algorithm < 4; ++algorithm) {
+    for (dx_size i = 0; i < n; ++i) {
+      // xorshift64
+      *seed ^= *seed << 13;
+      *seed ^= *seed >> 7;
+      *seed ^= *seed << 17;
+      storage[i].key = *seed & mask;
+      storage[i].index = i;
+      elements[i] = &storage[i];
+    }
+    uint64_t check_mask = mask;
+    switch (algorithm) {
+      case 0: {
+        check_mask = mask & UINT32_MAX;
+        if (dx_radix_sort_32(elements, n, &_dx_algorithms_test_key_32)) {
+          goto END;
+        }
+      } break;
+      case 1: {
+        if (dx_radix_sort_64(elements, n, &_dx_algorithms_test_key_64)) {
+          goto END;
+        }
+      } break;
+      case 2: {
+        if (dx_merge_sort(elements, n, &_dx_algorithms_test_compare)) {
+          goto END;
+        }
+      } break;
+      case 3: {
+        if (dx_parallel_sort(elements, n, &_dx_algorithms_test_compare)) {
+          goto END;
+        }
+      } break;
+    };
+    if (_dx_algorithms_test_check(elements, n, check_mask)) {
+      goto END;
+    }
+  }
+  // The elements are sorted by dx_parallel_sort: Search for every element and for keys which are not present.
+  for (dx_size i = 0; i < n; ++i) {
+    _dx_algorithms_test_element* element = elements[i];
+    dx_size index;
+    if (dx_binary_search(elements, n, element, &_dx_algorithms_test_compare, &index)) {
+      goto END;
+    }
+    if (_dx_algorithms_test_compare(elements[index], element) || (index > 0 && !_dx_algorithms_test_compare(elements[index - 1], element))) {
+      goto END;
+    }
+  }
+  if (n) {
+    _dx_algorithms_test_element key = { .key = ((_dx_algorithms_test_element*)elements[n - 1])->key + 1, .index = 0 };
+    if (key.key && dx_lower_bound(elements, n, &key, &_dx_algorithms_test_compare) != n) {
+      goto END;
+    }
+    dx_size index;
+    if (key.key && (!dx_binary_search(elements, n, &key, &_dx_algorithms_test_compare, &index) || DX_NOT_FOUND != dx_get_error())) {
+      goto END;
+    }
+    dx_set_error(DX_NO_ERROR);
+  }
+  result = 0;
+END:
+  if (n) {
+    dx_memory_deallocate(elements);
+    dx_memory_deallocate(storage);
+  }
+  return result;
+}
+
+#if defined(DX_ALGORITHMS_WITH_BENCHMARKS) && 1 == DX_ALGORITHMS_WITH_BENCHMARKS
+
+// The number of elements sorted by the benchmarks.
+// Large enough for dx_parallel_sort to sort in parallel.
+#define _DX_ALGORITHMS_TESTS_BENCHMARK_SIZE (4 * DX_PARALLEL_SORT_THRESHOLD)
+
+static int _dx_algorithms_test_qsort_compare(void const* a, void const* b) {
+  return _dx_algorithms_test_compare(*(void* const*)a, *(void* const*)b);
+}
+
+/// @brief Sort the same arbitrary keys with each algorithm and with qsort and report the time per element.
+static int _dx_algorithms_benchmark(uint64_t* seed) {
+  static char const* const names[] = {
+    "dx_radix_sort_32",
+    "dx_radix_sort_64",
+    "dx_merge_sort",
+    "dx_parallel_sort",
+    "qsort",
+  };
+  dx_size const n = _DX_ALGORITHMS_TESTS_BENCHMARK_SIZE;
+  _dx_algorithms_test_element* storage = dx_memory_allocate(n * sizeof(_dx_algorithms_test_element));
+  if (!storage) {
+    return 1;
+  }
+  void** elements = dx_memory_allocate(n * sizeof(void*));
+  if (!elements) {
+    dx_memory_deallocate(storage);
+    return 1;
+  }
+  for (dx_size i = 0; i < n; ++i) {
+    // xorshift64
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    storage[i].key = *seed;
+    storage[i].index = i;
+  }
+  int result = 1;
+  for (int algorithm = 0; algorithm < 5; ++algorithm) {
+    for (dx_size i = 0; i < n; ++i) {
+      elements[i] = &storage[i];
+    }
+    uint64_t check_mask = UINT64_MAX;
+    dx_n64 start = dx_os_get_time_ns();
+    switch (algorithm) {
+      case 0: {
+        check_mask = UINT32_MAX;
+        if (dx_radix_sort_32(elements, n, &_dx_algorithms_test_key_32)) {
+          goto END;
+        }
+      } break;
+      case 1: {
+        if (dx_radix_sort_64(elements, n, &_dx_algorithms_test_key_64)) {
+          goto END;
+        }
+      } break;
+      case 2: {
+        if (dx_merge_sort(elements, n, &_dx_algorithms_test_compare)) {
+          goto END;
+        }
+      } break;
+      case 3: {
+        if (dx_parallel_sort(elements, n, &_dx_algorithms_test_compare)) {
+          goto END;
+        }
+      } break;
+      case 4: {
+        qsort(elements, n, sizeof(void*), &_dx_algorithms_test_qsort_compare);
+      } break;
+    };
+    dx_n64 time = dx_os_get_time_ns() - start;
+    // The keys are distinct with high probability, so the order of qsort is checked as well.
+    if (_dx_algorithms_test_check(elements, n, check_mask)) {
+      goto END;
+    }
+    dx_log_benchmark(names[algorithm], time, n);
+  }
+  result = 0;
+END:
+  dx_memory_deallocate(elements);
+  dx_memory_deallocate(storage);
+  return result;
+}
+
+#endif // DX_ALGORITHMS_WITH_BENCHMARKS
+
+int dx_algorithms_tests() {
+  uint64_t seed = UINT64_C(88172645463325252);
+  static dx_size const sizes[] = { 0, 1, 2, 15, 16, 17, 100, 1000, DX_PARALLEL_SORT_THRESHOLD + 1001 };
+  // Many equal keys, keys with equal digits, and arbitrary keys.
+  static uint64_t const masks[] = { UINT64_C(0x7), UINT64_C(0xff00ff00ff00ff00), UINT64_MAX };
+  for (dx_size i = 0; i < sizeof(sizes) / sizeof(dx_size); ++i) {
+    for (dx_size j = 0; j < sizeof(masks) / sizeof(uint64_t); ++j) {
+      if (_dx_algorithms_test(sizes[i], masks[j], &seed)) {
+        return 1;
+      }
+    }
+  }
+#if defined(DX_ALGORITHMS_WITH_BENCHMARKS) && 1 == DX_ALGORITHMS_WITH_BENCHMARKS
+  if (_dx_algorithms_benchmark(&seed)) {
+    return 1;
+  }
+#endif
+  return 0;
+}
+
+#endif // DX_ALGORITHMS_WITH_TESTS
@@ -0,0 +1,111 @@
+#if !defined(DX_CORE_ALGORITHMS_H_INCLUDED)
+#define DX_CORE_ALGORITHMS_H_INCLUDED
+
+#include "dx/core/core.h"
+
+/// @brief Type of a callback function comparing two elements.
+/// @param a The first element.
+/// @param b The second element.
+/// @return A negative value if @a a is less than @a b, zero if @a a is equal to @a b, and a positive value if @a a is greater than @a b.
+typedef int (dx_compare_callback)(void* a, void* b);
+
+/// @brief Type of a callback function computing the 32 Bit key of an element.
+/// @param element The element.
+/// @return The key.
+typedef uint32_t (dx_key_32_callback)(void* element);
+
+/// @brief Type of a callback function computing the 64 Bit key of an element.
+/// @param element The element.
+/// @return The key.
+typedef uint64_t (dx_key_64_callback)(void* element);
+
+/// @ingroup core
+/// @brief Sort pointers by 32 Bit keys.
+/// @param elements A pointer to an array of @a number_of_elements pointers, for example the elements of a dx_pointer_array or a dx_object_array.
+/// @param number_of_elements The number of pointers in the array pointed to by @a elements.
+/// @param key A pointer to a function computing the key of an element.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a elements or @a key is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks
+/// This is a stable least significant digit radix sort with 8 Bit digits.
+/// The key of each element is computed once.
+/// Digits for which all keys are equal are skipped.
+int dx_radix_sort_32(void** elements, dx_size number_of_elements, dx_key_32_callback* key);
+
+/// @ingroup core
+/// @brief Sort pointers by 64 Bit keys.
+/// @param elements A pointer to an array of @a number_of_elements pointers.
+/// @param number_of_elements The number of pointers in the array pointed to by @a elements.
+/// @param key A pointer to a function computing the key of an element.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a elements or @a key is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks See dx_radix_sort_32.
+int dx_radix_sort_64(void** elements, dx_size number_of_elements, dx_key_64_callback* key);
+
+/// @ingroup core
+/// @brief Sort pointers.
+/// @param elements A pointer to an array of @a number_of_elements pointers.
+/// @param number_of_elements The number of pointers in the array pointed to by @a elements.
+/// @param compare A pointer to a function comparing two elements.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a elements or @a compare is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks
+/// This is a stable bottom-up merge sort.
+/// Runs of up to 16 elements are sorted by insertion sort before they are merged.
+int dx_merge_sort(void** elements, dx_size number_of_elements, dx_compare_callback* compare);
+
+/// @ingroup core
+/// @brief Sort pointers using multiple threads.
+/// @param elements A pointer to an array of @a number_of_elements pointers.
+/// @param number_of_elements The number of pointers in the array pointed to by @a elements.
+/// @param compare A pointer to a function comparing two elements. Must be safe to call from multiple threads.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a elements or @a compare is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks
+/// The array is split into one part per core. The parts are sorted by dx_merge_sort and then merged, all in parallel.
+/// The result is the same as the result of dx_merge_sort.
+/// Arrays with less than DX_PARALLEL_SORT_THRESHOLD elements are sorted by dx_merge_sort on the calling thread.
+int dx_parallel_sort(void** elements, dx_size number_of_elements, dx_compare_callback* compare);
+
+/// @brief The least number of elements of an array which dx_parallel_sort sorts using multiple threads.
+#define DX_PARALLEL_SORT_THRESHOLD (1 << 16)
+
+/// @ingroup core
+/// @brief Get the index of the first element of a sorted array which is not less than a key.
+/// @param elements A pointer to an array of @a number_of_elements pointers sorted with respect to @a compare.
+/// @param number_of_elements The number of pointers in the array pointed to by @a elements.
+/// @param key The key.
+/// @param compare A pointer to a function comparing an element (first argument) and the key (second argument).
+/// @return The index. @a number_of_elements if all elements are less than the key.
+/// The zero value is also returned on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a elements or @a compare is a null pointer
+dx_size dx_lower_bound(void** elements, dx_size number_of_elements, void* key, dx_compare_callback* compare);
+
+/// @ingroup core
+/// @brief Search a sorted array for an element equal to a key.
+/// @param elements A pointer to an array of @a number_of_elements pointers sorted with respect to @a compare.
+/// @param number_of_elements The number of pointers in the array pointed to by @a elements.
+/// @param key The key.
+/// @param compare A pointer to a function comparing an element (first argument) and the key (second argument).
+/// @param index A pointer to a <code>dx_size</code> variable.
+/// @return The zero value on success. A non-zero value on failure.
+/// @success <code>*index</code> was assigned the index of the first element equal to the key.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a elements, @a compare, or @a index is a null pointer
+/// - #DX_NOT_FOUND no element is equal to the key
+int dx_binary_search(void** elements, dx_size number_of_elements, void* key, dx_compare_callback* compare, dx_size* index);
+
+#if defined(DX_ALGORITHMS_WITH_TESTS) && 1 == DX_ALGORITHMS_WITH_TESTS
+int dx_algorithms_tests();
+#endif
+
+#endif // DX_CORE_ALGORITHMS_H_INCLUDED
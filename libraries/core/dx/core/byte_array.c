@@ -7,38 +7,43 @@ int dx_byte_array_initialize(dx_byte_array* byte_array) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  byte_array->elements = dx_memory_allocate(0);
-  if (!byte_array->elements) {
-    return 1;
-  }
+  byte_array->elements = byte_array->inline_elements;
   byte_array->size = 0;
-  byte_array->capacity = 0;
+  byte_array->capacity = DX_BYTE_ARRAY_INLINE_CAPACITY;
   return 0;
 }
 
 void dx_byte_array_uninitialize(dx_byte_array* byte_array) {
-  dx_memory_deallocate(byte_array->elements);
+  if (byte_array->elements != byte_array->inline_elements) {
+    dx_memory_deallocate(byte_array->elements);
+  }
   byte_array->elements = NULL;
 }
 
 int dx_byte_array_steal(dx_byte_array* byte_array, char **bytes, dx_size *number_of_bytes) {
-  if (byte_array->size < byte_array->capacity) {
-    char *new_elements = dx_memory_reallocate(byte_array->elements, byte_array->size);
-    if (!new_elements) {
+  char* stolen_elements = NULL;
+  if (byte_array->elements == byte_array->inline_elements) {
+    stolen_elements = dx_memory_allocate(byte_array->size);
+    if (!stolen_elements) {
       return 1;
     }
-    byte_array->elements = new_elements;
-    byte_array->capacity = byte_array->size;
-  }
-  char *new_elements = dx_memory_allocate(0);
-  if (!new_elements) {
-    return 1;
+    dx_memory_copy(stolen_elements, byte_array->inline_elements, byte_array->size);
+  } else {
+    if (byte_array->size < byte_array->capacity) {
+      char *new_elements = dx_memory_reallocate(byte_array->elements, byte_array->size);
+      if (!new_elements) {
+        return 1;
+      }
+      byte_array->elements = new_elements;
+      byte_array->capacity = byte_array->size;
+    }
+    stolen_elements = byte_array->elements;
   }
-  *bytes = byte_array->elements;
+  *bytes = stolen_elements;
   *number_of_bytes = byte_array->size;
   byte_array->size = 0;
-  byte_array->capacity = 0;
-  byte_array->elements = new_elements;
+  byte_array->capacity = DX_BYTE_ARRAY_INLINE_CAPACITY;
+  byte_array->elements = byte_array->inline_elements;
   return 0;
 }
 
@@ -63,9 +68,18 @@ int dx_byte_array_increase_capacity(dx_byte_array* self, dx_size additional) {
   if (new < best_new) {
     new = best_new;
   }
-  char* new_elements = dx_memory_reallocate(self->elements, new);
-  if (!new_elements) {
-    return 1;
+  char* new_elements = NULL;
+  if (self->elements == self->inline_elements) {
+    new_elements = dx_memory_allocate(new);
+    if (!new_elements) {
+      return 1;
+    }
+    dx_memory_copy(new_elements, self->inline_elements, self->size);
+  } else {
+    new_elements = dx_memory_reallocate(self->elements, new);
+    if (!new_elements) {
+      return 1;
+    }
   }
   self->elements = new_elements;
   self->capacity = new;
@@ -81,6 +95,41 @@ int dx_byte_array_ensure_free_capacity(dx_byte_array* self, dx_size required) {
   return dx_byte_array_increase_capacity(self, additional);
 }
 
+int dx_byte_array_reserve(dx_byte_array* self, dx_size required) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (self->capacity >= required) {
+    return 0;
+  }
+  return dx_byte_array_increase_capacity(self, required - self->capacity);
+}
+
+int dx_byte_array_shrink_to_fit(dx_byte_array* self) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (self->elements == self->inline_elements || self->size == self->capacity) {
+    return 0;
+  }
+  if (self->size <= DX_BYTE_ARRAY_INLINE_CAPACITY) {
+    dx_memory_copy(self->inline_elements, self->elements, self->size);
+    dx_memory_deallocate(self->elements);
+    self->elements = self->inline_elements;
+    self->capacity = DX_BYTE_ARRAY_INLINE_CAPACITY;
+    return 0;
+  }
+  char* new_elements = dx_memory_reallocate(self->elements, self->size);
+  if (!new_elements) {
+    return 1;
+  }
+  self->elements = new_elements;
+  self->capacity = self->size;
+  return 0;
+}
+
 int dx_byte_array_prepend(dx_byte_array* self, char const* bytes, dx_size number_of_bytes) {
   return dx_byte_array_insert(self, 0, bytes, number_of_bytes);
 }
@@ -94,7 +143,7 @@ int dx_byte_array_append(dx_byte_array* self, char const* bytes, dx_size number_
 }
  
 int dx_byte_array_insert(dx_byte_array* self, dx_size index, char const* bytes, dx_size number_of_bytes) {
-  if (!self || !bytes) {
+  if (!self || !bytes || index > self->size) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
@@ -102,7 +151,7 @@ int dx_byte_array_insert(dx_byte_array* self, dx_size index, char const* bytes,
     return 1;
   }
   if (index < self->size) {
-    dx_memory_move(self->elements + index + number_of_bytes, self->elements + index, number_of_bytes);
+    dx_memory_move(self->elements + index + number_of_bytes, self->elements + index, self->size - index);
   }
   dx_memory_copy(self->elements + index, bytes, number_of_bytes);
   self->size += number_of_bytes;
@@ -3,10 +3,19 @@
 
 #include "dx/core/core.h"
 
+/// @brief The number of Bytes a dx_byte_array object stores without allocating.
+#define DX_BYTE_ARRAY_INLINE_CAPACITY (32)
+
+/// @brief A dynamic array of Bytes.
+/// @remarks
+/// The first DX_BYTE_ARRAY_INLINE_CAPACITY Bytes are stored in the dx_byte_array object itself.
+/// The Bytes are moved to the heap if the capacity is increased beyond that.
+/// As @a elements may point into the dx_byte_array object, a dx_byte_array object must not be copied.
 typedef struct dx_byte_array {
 
   /// @brief A pointer to an array of @a capacity @a (char) elements.
   /// The first @a size @a (char) elements are the contents of the buffer.
+  /// Either @a inline_elements or an array allocated by dx_memory_allocate.
   char *elements;
 
   /// @brief The size, in elements, of this buffer.
@@ -15,6 +24,9 @@ typedef struct dx_byte_array {
   /// @brief The capacity, in elements, of this buffer.
   dx_size capacity;
 
+  /// @brief The inline elements.
+  char inline_elements[DX_BYTE_ARRAY_INLINE_CAPACITY];
+
 } dx_byte_array;
 
 /// @brief Initialize this dx_byte_array object.
@@ -41,7 +53,7 @@ void dx_byte_array_uninitialize(dx_byte_array* self);
 /// @success
 /// <code>*bytes</code> was assigned a pointer to an array of <code>*number_of_bytes</code> Bytes.
 /// <code>*number_of_bytes</code> was assigned the number of Bytes.
-/// The array pointed to by <code>*bytes</code> must be deallocated using <code>free(void*)</code>.
+/// The array pointed to by <code>*bytes</code> must be deallocated using <code>dx_memory_deallocate(void*)</code>.
 int dx_byte_array_steal(dx_byte_array* self, char **bytes, dx_size *number_of_bytes);
 
 /// @brief Increase the capacity.
@@ -65,6 +77,24 @@ int dx_byte_array_increase_capacity(dx_byte_array* self, dx_size additional);
 /// - #DX_ALLOCATION_FAILED an allocation failed
 int dx_byte_array_ensure_free_capacity(dx_byte_array* self, dx_size required);
 
+/// @brief Ensure the capacity is greater than or equal to a specified value.
+/// @param self A pointer to this dx_byte_array object.
+/// @param required The required capacity.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED @a required is too big
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int dx_byte_array_reserve(dx_byte_array* self, dx_size required);
+
+/// @brief Decrease the capacity to the size (or to DX_BYTE_ARRAY_INLINE_CAPACITY if the size is smaller).
+/// @param self A pointer to this dx_byte_array object.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int dx_byte_array_shrink_to_fit(dx_byte_array* self);
+
 /// @brief Prepend Bytes.
 /// @param self A pointer to this dx_byte_array object.
 /// @param bytes A pointer to an array of @a number_of_bytes Bytes.
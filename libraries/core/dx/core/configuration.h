@@ -25,6 +25,50 @@
 /// Otherwise it is disabled, that is, non-atomic reference counting is performed.
 #define DX_ATOMIC_REFERENCE_COUNTING_ENABLED (1)
 
+/// If defined and evaluating to @a 1,
+/// then objects can be marked as thread-confined by dx_object_set_thread_confined
+/// and the reference counts of such objects are incremented and decremented non-atomically.
+/// Otherwise dx_object_set_thread_confined has no effect.
+#define DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED (1)
+
+/// If defined and evaluating to @a 1,
+/// then dx_memory_allocate serves blocks of up to 512 Bytes from per-thread caches of fixed-size blocks.
+/// Otherwise all blocks are allocated from the system heap.
+#define DX_MEMORY_SLAB_ALLOCATOR_ENABLED (1)
+
+/// If defined and evaluating to @a 1,
+/// then objects allocated by dx_object_alloc_pooled are recycled by a per-type object pool.
+/// Otherwise dx_object_alloc_pooled allocates from and dx_object_unreference deallocates to dx_memory_allocate.
+#define DX_OBJECT_POOLS_ENABLED (1)
+
+/// If defined and evaluating to @a 1,
+/// then dx_memory_allocate and dx_memory_reallocate record their call sites,
+/// dx_object_unreference records the types of destroyed objects,
+/// and dx_memory_profiler_report writes a report of the heap profile.
+/// The live blocks are reported when the runtime type system is uninitialized.
+/// Otherwise the heap profiler is not available.
+#define DX_MEMORY_PROFILER_ENABLED (0)
+
+/// If defined and evaluating to @a 1,
+/// then allocations between dx_memory_enter_frame and dx_memory_leave_frame are counted
+/// and frames exceeding the allocation budget set by dx_memory_set_frame_budget are reported.
+/// This is only available if _DEBUG evaluates to @a 1.
+#if defined(_DEBUG) && 1 == _DEBUG
+  #define DX_MEMORY_FRAME_BUDGET_ENABLED (0)
+#endif
+
+/// If defined and evaluating to @a 1,
+/// then the Bytes of a string are validated once when the string is created
+/// and the string records if its Bytes are ASCII or valid UTF-8.
+/// Scans of such strings can skip decoding.
+#define DX_STRING_VALIDATE_ON_CREATION_ENABLED (1)
+
+/// If defined and evaluating to @a 1,
+/// then dx_pointer_hashmap grows incrementally:
+/// The entries of the old table are migrated to the new table in small steps by subsequent additions.
+/// Otherwise all entries are migrated at once when the capacity is increased.
+#define DX_POINTER_HASHMAP_INCREMENTAL_RESIZE_ENABLED (1)
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /// If defined and evaluating to @a 1,
@@ -33,12 +77,90 @@
 /// This function succeeds if all such tests succeed, otherwise it fails.
 #define DX_MATH_WITH_TESTS (1)
 
+/// If defined and evaluating to @a 1,
+/// then a function dx_convert_tests() is provided
+/// which performs tests on functionality provided by "dx/core/convert.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_CONVERT_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_CONVERT_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_convert_tests() also performs benchmarks on functionality provided by "dx/core/convert.h".
+/// Keep this disabled unless you measure: The benchmarks delay the startup.
+#define DX_CONVERT_WITH_BENCHMARKS (0)
+
+/// If defined and evaluating to @a 1,
+/// then a function dx_string_format_tests() is provided
+/// which performs tests on the formatting of numbers by dx_string_printf and dx_string_format_* provided by "dx/core/string.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_STRING_FORMAT_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_STRING_FORMAT_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_string_format_tests() also compares the formatting of numbers with snprintf.
+/// Keep this disabled unless you measure: The benchmarks delay the startup.
+#define DX_STRING_FORMAT_WITH_BENCHMARKS (0)
+
 /// If defined and evaluating to @a 1,
 /// the a function dx_safe_add_nx_tests() is provided
 /// which performs tests on functionality provided by dx/core/safe_add_nx.h".
 /// This function succeeds if all such tests succeed, otherwise it fails.
 #define DX_SAFE_ADD_NX_WITH_TESTS (1)
 
+/// If defined and evaluating to @a 1,
+/// then a function dx_algorithms_tests() is provided
+/// which performs tests on functionality provided by "dx/core/algorithms.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_ALGORITHMS_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_ALGORITHMS_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_algorithms_tests() also performs benchmarks on functionality provided by "dx/core/algorithms.h".
+/// Keep this disabled unless you measure: The benchmarks considerably delay the startup.
+#define DX_ALGORITHMS_WITH_BENCHMARKS (0)
+
+/// If defined and evaluating to @a 1,
+/// then a function dx_msg_queue_tests() is provided
+/// which performs tests on functionality provided by "dx/core/msgs.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_MSG_QUEUE_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1,
+/// then a function dx_object_tests() is provided
+/// which performs tests on functionality provided by "dx/core/object.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_OBJECT_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_OBJECT_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_object_tests() also performs benchmarks on functionality provided by "dx/core/object.h".
+/// Keep this disabled unless you measure: The benchmarks delay the startup.
+#define DX_OBJECT_WITH_BENCHMARKS (0)
+
+/// If defined and evaluating to @a 1,
+/// then a function dx_hash_tests() is provided
+/// which performs tests on the dx_hash_* functions provided by "dx/core/core.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_HASH_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_HASH_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_hash_tests() also reports the collisions and the throughput of the dx_hash_* functions provided by "dx/core/core.h".
+/// Keep this disabled unless you measure: The benchmarks delay the startup.
+#define DX_HASH_WITH_BENCHMARKS (0)
+
+/// If defined and evaluating to @a 1,
+/// then a function dx_pointer_hashmap_tests() is provided
+/// which performs tests on functionality provided by "dx/core/pointer_hashmap.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_POINTER_HASHMAP_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_POINTER_HASHMAP_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_pointer_hashmap_tests() also reports the time of the operations provided by "dx/core/pointer_hashmap.h".
+/// Keep this disabled unless you measure: The reports clutter the log.
+#define DX_POINTER_HASHMAP_WITH_BENCHMARKS (0)
+
+/// If defined and evaluating to @a 1,
+/// then a function dx_typed_hashmap_tests() is provided
+/// which performs tests on functionality provided by "dx/core/typed_hashmap.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_TYPED_HASHMAP_WITH_TESTS (1)
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /// If defined and evaluating to @a 1,
@@ -91,4 +213,21 @@
 /// This function succeeds if all such tests succeed, otherwise it fails.
 #define DX_DDL_PARSER_WITH_TESTS (1)
 
+/// If defined and evaluating to @a 1,
+/// then a function dx_ddl_node_tests() is provided
+/// which performs tests on the map nodes provided by "dx/ddl/node.h".
+/// This function succeeds if all such tests succeed, otherwise it fails.
+#define DX_DDL_NODE_WITH_TESTS (1)
+
+/// If defined and evaluating to @a 1 and DX_DDL_NODE_WITH_TESTS is defined and evaluating to @a 1,
+/// then dx_ddl_node_tests() also performs benchmarks on the map nodes provided by "dx/ddl/node.h".
+/// Keep this disabled unless you measure: The benchmarks delay the startup.
+#define DX_DDL_NODE_WITH_BENCHMARKS (0)
+
+/// If defined and evaluating to @a 1,
+/// then the time of compiling the scenes from DDL and ADL and the time of rendering the frames are written to the log.
+/// For example, compare these times with DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED enabled and disabled.
+/// Keep this disabled unless you measure: The reports clutter the log.
+#define DX_ENGINE_WITH_BENCHMARKS (0)
+
 #endif // DX_CONFIGURATION_H_INCLUDED
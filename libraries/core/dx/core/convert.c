@@ -1,204 +1,190 @@
 #include "dx/core/convert.h"
 
-// atod, atof
+// strtod, strtof
 #include <stdlib.h>
 // memcpy
 #include <memory.h>
+// strlen
+#include <string.h>
+// snprintf
+#include <stdio.h>
+// isinf
+#include <math.h>
+
+#include "dx/core/count_leading_zeroes.h"
+#include "dx/core/safe_mul_nx.h"
+#if defined(DX_CONVERT_WITH_TESTS) && 1 == DX_CONVERT_WITH_TESTS && defined(DX_CONVERT_WITH_BENCHMARKS) && 1 == DX_CONVERT_WITH_BENCHMARKS
+#include "dx/core/os.h"
+#endif
 
 /// @brief Get if the current symbol is a digit.
 /// @param current, end The parser.
 /// @return @a true if the current symbol is a digit. @a false otherwise. 
 static inline bool is_digit(char const* current, char const* end);
 
-/// @brief Parse a floating point literal.
-/// @param p A pointer to the bytes. 
-/// @param n The number of Bytes.
-/// @return The zero value on success. A non-zero value on failure.
-/// @default-failure
-static int dx_parse_flit(char const* p, dx_size n);
-
 static inline bool is_digit(char const* current, char const* end) {
   return (current != end)
       && ('0' <= *current && *current <= '9');
 }
 
-static int dx_parse_flit(char const* p, dx_size n) {
-  char const* start = p;
+// Integer literals of all widths are converted by a single core _dx_parse_integer.
+// It consumes eight digits at a time (SWAR) as long as the value cannot overflow
+// and falls back to one digit at a time with overflow checks for the remaining digits.
+// The width-specific functions check the magnitude against the bounds of their type.
+
+/// @brief Get if eight Bytes are all decimal digits.
+/// @param x The eight Bytes in little-endian order.
+/// @return @a true if all Bytes are decimal digits. @a false otherwise.
+static inline bool _dx_is_eight_digits(uint64_t x) {
+  // '0' to '9' are 0x30 to 0x39. Adding 0x06 to a digit does not carry into the upper nibble.
+  return (((x & UINT64_C(0xF0F0F0F0F0F0F0F0)) | (((x + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) == UINT64_C(0x3333333333333333));
+}
+
+/// @brief Compute the value of eight decimal digits.
+/// @param x The eight digits in little-endian order.
+/// @return The value.
+static inline uint32_t _dx_parse_eight_digits(uint64_t x) {
+  x -= UINT64_C(0x3030303030303030);
+  // Combine pairs, then quadruples, then octuples of digits.
+  x = (x * 10) + (x >> 8);
+  x = (((x & UINT64_C(0x000000FF000000FF)) * (100 + (UINT64_C(1000000) << 32)))
+     + (((x >> 16) & UINT64_C(0x000000FF000000FF)) * (1 + (UINT64_C(10000) << 32)))) >> 32;
+  return (uint32_t)x;
+}
+
+/// @brief Parse an integer literal.
+/// @param p A pointer to the Bytes.
+/// @param n The number of Bytes.
+/// @param [out] negative A pointer to a variable receiving @a true if the literal has a minus sign and @a false otherwise.
+/// @param [out] magnitude A pointer to a variable receiving the magnitude of the literal.
+/// @return The zero value on success. A non-zero value on failure.
+/// This function fails if the literal is not of the form <code>[+-]?[0-9]+</code> or its magnitude is greater than DX_N64_GREATEST.
+/// @default-failure
+static int _dx_parse_integer(char const* p, dx_size n, bool* negative, uint64_t* magnitude) {
   char const* end = p + n;
   char const* current = p;
-
+  *negative = false;
   if (current != end) {
     if (*current == '-') {
+      *negative = true;
       current++;
     } else if (*current == '+') {
       current++;
     }
   }
-  if (is_digit(current, end)) {
-    do {
-      current++;
-    } while (is_digit(current, end));
-    if (dx_get_error()) return 1;
-    if (current != end && *current == '.') {
-      current++;
-      while (is_digit(current, end)) {
-        current++;
-      }
-    }
-  } else if (current != end && *current == '.') {
-    current++;
-    if (!is_digit(current, end)) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    do {
-      current++;
-    } while (is_digit(current, end));
-    if (dx_get_error()) return 1;
-  } else {
+  // digit+
+  if (!is_digit(current, end)) {
+    dx_set_error(DX_CONVERSION_FAILED);
     return 1;
   }
-  if (current != end && (*current == 'e' || *current == 'E')) {
+  while (current != end && *current == '0') {
     current++;
-    if (current != end && (*current == '+' || *current == '-')) {
-      current++;
+  }
+  uint64_t value = 0;
+  dx_size number_of_digits = 0;
+  // As long as at most 19 digits were consumed, the value is less than 10^19 and does not overflow.
+  while (end - current >= 8 && number_of_digits + 8 <= 19) {
+    uint64_t x;
+    memcpy(&x, current, 8);
+    if (!_dx_is_eight_digits(x)) {
+      break;
     }
-    if (!is_digit(current, end)) {
+    value = value * 100000000 + _dx_parse_eight_digits(x);
+    number_of_digits += 8;
+    current += 8;
+  }
+  while (is_digit(current, end)) {
+    uint64_t x = (uint64_t)(*current - '0');
+    if (value > (DX_N64_GREATEST - x) / 10) {
       dx_set_error(DX_CONVERSION_FAILED);
       return 1;
     }
-    do {
-      current++;
-    } while (is_digit(current, end));
-    if (dx_get_error()) return 1;
+    value = value * 10 + x;
+    current++;
+  }
+  if (current != end) {
+    dx_set_error(DX_CONVERSION_FAILED);
+    return 1;
   }
+  *magnitude = value;
   return 0;
 }
 
-int dx_convert_utf8bytes_to_i8(char const* p, dx_size n, dx_i8* target) {
-  if (!p || !target) {
-    dx_set_error(DX_INVALID_ARGUMENT);
+/// @brief Convert an integer literal to a signed value.
+/// @param p A pointer to the Bytes.
+/// @param n The number of Bytes.
+/// @param greatest The greatest value of the signed type. The least value of the type is <code>-greatest - 1</code>.
+/// @param [out] target A pointer to the variable receiving the value.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+static int _dx_convert_to_signed(char const* p, dx_size n, uint64_t greatest, int64_t* target) {
+  bool negative;
+  uint64_t magnitude;
+  if (_dx_parse_integer(p, n, &negative, &magnitude)) {
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  bool negative = false;
-  if (current != end) {
-    if (*current == '-') {
-      negative = true;
-      current++;
-    } else if (*current == '+') {
-      current++;
+  if (negative) {
+    if (magnitude > greatest + 1) {
+      dx_set_error(DX_CONVERSION_FAILED);
+      return 1;
+    }
+    // -(magnitude - 1) - 1 does not overflow for magnitude = greatest + 1.
+    *target = magnitude ? -(int64_t)(magnitude - 1) - 1 : 0;
+  } else {
+    if (magnitude > greatest) {
+      dx_set_error(DX_CONVERSION_FAILED);
+      return 1;
     }
+    *target = (int64_t)magnitude;
   }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  return 0;
+}
+
+/// @brief Convert an integer literal to an unsigned value.
+/// @param p A pointer to the Bytes.
+/// @param n The number of Bytes.
+/// @param greatest The greatest value of the unsigned type.
+/// @param [out] target A pointer to the variable receiving the value.
+/// @return The zero value on success. A non-zero value on failure.
+/// This function fails if the literal has a minus sign.
+/// @default-failure
+static int _dx_convert_to_unsigned(char const* p, dx_size n, uint64_t greatest, uint64_t* target) {
+  bool negative;
+  uint64_t magnitude;
+  if (_dx_parse_integer(p, n, &negative, &magnitude)) {
     return 1;
   }
-  dx_i8 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
+  if (negative || magnitude > greatest) {
     dx_set_error(DX_CONVERSION_FAILED);
     return 1;
   }
-  if (negative) {
-    do {
-      //
-      static const dx_i8 BASE = 10;
-      static const dx_i8 MIN1 = DX_I8_GREATEST + 8; // 128 / 10 = 12.8 = 12.
-                                                    // 12 * 10 = 120 is no overflow.
-      if (value == MIN1) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value = value * BASE;
-      //
-      static const dx_i8 MIN2 = DX_I8_LEAST;
-      dx_i8 x = *current - '0';
-      if (value < MIN2 + x) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value -= x;
-      //
-      current++;
-    } while (is_digit(current, end));
-  } else {
-    do {
-      //
-      static const dx_i8 BASE = 10;
-      static const dx_i8 MAX1 = DX_I8_GREATEST - 7; // 127 / 10 = 12.7 = 12.
-                                                    // 12 * 10 = 120 is no overflow.
-      if (value == MAX1) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value = value * BASE;
-      //
-      static const dx_i8 MAX2 = DX_I8_GREATEST;
-      dx_i8 x = *current - '0';
-      if (MAX2 - x < value) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value += x;
-      //
-      current++;
-    } while (is_digit(current, end));
-  }
-  *target = value;
+  *target = magnitude;
   return 0;
 }
 
-int dx_convert_utf8bytes_to_n8(char const* p, dx_size n, dx_n8* target) {
+int dx_convert_utf8bytes_to_i8(char const* p, dx_size n, dx_i8* target) {
   if (!p || !target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  if (current != end) {
-    if (*current == '-') {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    } else if (*current == '+') {
-      current++;
-    }
+  int64_t value;
+  if (_dx_convert_to_signed(p, n, DX_I8_GREATEST, &value)) {
+    return 1;
   }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  *target = (dx_i8)value;
+  return 0;
+}
+
+int dx_convert_utf8bytes_to_n8(char const* p, dx_size n, dx_n8* target) {
+  if (!p || !target) {
+    dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  dx_n8 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  uint64_t value;
+  if (_dx_convert_to_unsigned(p, n, DX_N8_GREATEST, &value)) {
     return 1;
   }
-  do {
-    //
-    static const dx_n8 BASE = 10;
-    static const dx_n8 MAX1 = DX_N8_GREATEST - 5; // 255 / 10 = 25.5 = 25.
-                                                  // 25 * 10 = 250 is no overflow.
-    if (value == MAX1) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    value = value * BASE;
-    //
-    static const dx_n8 MAX2 = DX_N8_GREATEST;
-    dx_n8 x = *current - '0';
-    if (MAX2 - x < value) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    value += x;
-    //
-    current++;
-  } while (is_digit(current, end));
-  *target = value;
+  *target = (dx_n8)value;
   return 0;
 }
 
@@ -207,74 +193,11 @@ int dx_convert_utf8bytes_to_i16(char const* p, dx_size n, dx_i16* target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  bool negative = false;
-  if (current != end) {
-    if (*current == '-') {
-      negative = true;
-      current++;
-    } else if (*current == '+') {
-      current++;
-    }
-  }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  dx_i16 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  int64_t value;
+  if (_dx_convert_to_signed(p, n, DX_I16_GREATEST, &value)) {
     return 1;
   }
-  if (negative) {
-    do {
-      //
-      static const dx_i16 BASE = 10;
-      static const dx_i16 MIN1 = DX_I16_LEAST - 8; // 32768 / 10 = 3276.8 = 3276.
-                                                   // 3276 * 10 = 32760 is no overflow.
-      if (value == MIN1) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value = value * BASE;
-      //
-      static const dx_i16 MIN2 = DX_I16_LEAST;
-      dx_i16 x = *current - '0';
-      if (value < MIN2 + x) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value -= x;
-      //
-      current++;
-    } while (is_digit(current, end));
-  } else {
-    do {
-      //
-      static const dx_i16 BASE = 10;
-      static const dx_i16 MAX1 = DX_I16_GREATEST - 7; // 32767 / 10 = 3276.7 = 3276.
-                                                      // 3276 * 10 = 32760 is no overflow.
-      if (value == MAX1) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value = value * BASE;
-      //
-      static const dx_i16 MAX2 = DX_I16_GREATEST;
-      dx_i16 x = *current - '0';
-      if (MAX2 - x < value) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value += x;
-      //
-      current++;
-    } while (is_digit(current, end));
-  }
-  *target = value;
+  *target = (dx_i16)value;
   return 0;
 }
 
@@ -283,49 +206,11 @@ int dx_convert_utf8bytes_to_n16(char const* p, dx_size n, dx_n16* target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  if (current != end) {
-    if (*current == '-') {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    } else if (*current == '+') {
-      current++;
-    }
-  }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  dx_n16 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  uint64_t value;
+  if (_dx_convert_to_unsigned(p, n, DX_N16_GREATEST, &value)) {
     return 1;
   }
-  do {
-    //
-    static const dx_n16 BASE = 10;
-    static const dx_n16 MAX1 = DX_N16_GREATEST - 5; // 65535 / 10 = 6553.5 = 6553.
-                                                    // 6553*10 = 65530 is no overflow.
-    if (value == MAX1) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    value = value * BASE;
-    //
-    static const dx_n16 MAX2 = DX_N16_GREATEST;
-    dx_n16 x = *current - '0';
-    if (MAX2 - x < value) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    value += x;
-    //
-    current++;
-  } while (is_digit(current, end));
-  *target = value;
+  *target = (dx_n16)value;
   return 0;
 }
 
@@ -334,74 +219,11 @@ int dx_convert_utf8bytes_to_i32(char const* p, dx_size n, dx_i32* target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  bool negative = false;
-  if (current != end) {
-    if (*current == '-') {
-      negative = true;
-      current++;
-    } else if (*current == '+') {
-      current++;
-    }
-  }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  dx_i32 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  int64_t value;
+  if (_dx_convert_to_signed(p, n, DX_I32_GREATEST, &value)) {
     return 1;
   }
-  if (negative) {
-    do {
-      //
-      static const dx_i32 BASE = 10;
-      static const dx_i32 MIN1 = DX_I32_LEAST + 8; // 2147483648 / 10 = 214748364.8 = 214748364.
-                                                   // 214748364 * 10 = 2147483640 is no overflow.
-      if (value == MIN1) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value = value * BASE;
-      //
-      static const dx_i32 MIN2 = DX_I32_LEAST;
-      dx_i32 x = *current - '0';
-      if (value < MIN2 + x) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value -= x;
-      //
-      current++;
-    } while (is_digit(current, end));
-  } else {
-    do {
-      //
-      static const dx_i32 BASE = 10;
-      static const dx_i32 MAX1 = DX_I32_GREATEST - 7; // 2147483647 / 10 = 214748364.7 = 214748364.
-                                                      // 214748364 * 10 = 2147483640 is no overflow.
-      if (value == MAX1) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value = value * BASE;
-      //
-      static const dx_i32 MAX2 = DX_I32_GREATEST;
-      dx_i32 x = *current - '0';
-      if (MAX2 - x < value) {
-        dx_set_error(DX_CONVERSION_FAILED);
-        return 1;
-      }
-      value += x;
-      //
-      current++;
-    } while (is_digit(current, end));
-  }
-  *target = value;
+  *target = (dx_i32)value;
   return 0;
 }
 
@@ -410,49 +232,11 @@ int dx_convert_utf8bytes_to_n32(char const* p, dx_size n, dx_n32* target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  if (current != end) {
-    if (*current == '-') {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    } else if (*current == '+') {
-      current++;
-    }
-  }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  dx_n32 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  uint64_t value;
+  if (_dx_convert_to_unsigned(p, n, DX_N32_GREATEST, &value)) {
     return 1;
   }
-  do {
-    //
-    static const dx_n32 BASE = 10;
-    static const dx_n32 MAX1 = DX_N32_GREATEST - 5; // 4294967295 / 10 = 429496729.5 = 429496729.
-                                                    // 429496729 * 10 = 4294967290 is no overflow.
-    if (value == MAX1) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    value = value * BASE;
-    //
-    static const uint32_t MAX2 = DX_N32_GREATEST;
-    dx_n32 x = *current - '0';
-    if (MAX2 - x < value) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    value += x;
-    //
-    current++;
-  } while (is_digit(current, end));
-  *target = value;
+  *target = (dx_n32)value;
   return 0;
 }
 
@@ -461,160 +245,748 @@ int dx_convert_utf8bytes_to_i64(char const* p, dx_size n, dx_i64* target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  bool negative = false;
-  if (current != end) {
-    if (*current == '-') {
-      negative = true;
-      current++;
-    } else if (*current == '+') {
-      current++;
-    }
-  }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  return _dx_convert_to_signed(p, n, DX_I64_GREATEST, target);
+}
+
+int dx_convert_utf8bytes_to_n64(char const* p, dx_size n, dx_n64* target) {
+  if (!p || !target) {
+    dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  dx_i64 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  return _dx_convert_to_unsigned(p, n, DX_N64_GREATEST, target);
+}
+
+int dx_convert_utf8bytes_to_sz(char const* p, dx_size n, dx_size* target) {
+#if defined(_M_X64)
+  return dx_convert_utf8bytes_to_n64(p, n, target);
+#elif defined(_M_IX86)
+  return dx_convert_utf8bytes_to_n32(p, n, target);
+#else
+  #error("environment not supported")
+#endif
+}
+
+
+// Floating point literals are converted by the Eisel-Lemire algorithm as described in
+// "Number Parsing at a Gigabyte per Second" by Daniel Lemire, Software: Practice and Experience 51 (8), 2021.
+// The literal is parsed in place. Its first 19 significant digits and its decimal exponent are computed in one pass.
+// If the value is exactly representable (Clinger's fast path), it is computed by a single multiplication or division.
+// Otherwise, the product of the digits and a 128 bit approximation of the power of ten is rounded to the target format.
+// If more than 19 significant digits were given and that rounding is ambiguous, strtod/strtof is invoked on a canonical copy of the literal.
+
+/// @brief The maximal number of significant digits in a canonical copy of a literal.
+/// Any further digits do not affect the rounding of a dx_f64 or dx_f32 value.
+#define DX_CONVERT_MAX_DIGITS (768)
+
+/// @brief A decimal floating point literal.
+typedef struct _dx_decimal {
+  /// @brief @a true if the literal is negative.
+  bool negative;
+  /// @brief The first (at most) 19 significant digits.
+  uint64_t mantissa;
+  /// @brief The number of digits in the mantissa.
+  dx_size number_of_digits;
+  /// @brief The value is <code>mantissa * 10^exponent</code> if the literal was not truncated.
+  int64_t exponent;
+  /// @brief @a true if non-zero digits beyond the first 19 significant digits were dropped.
+  bool truncated;
+} _dx_decimal;
+
+static inline void _dx_decimal_on_digit(_dx_decimal* self, uint8_t x, bool fractional) {
+  if (!self->number_of_digits && !x) {
+    // Leading zero.
+    if (fractional) {
+      self->exponent--;
+    }
+  } else if (self->number_of_digits < 19) {
+    self->mantissa = self->mantissa * 10 + x;
+    self->number_of_digits++;
+    if (fractional) {
+      self->exponent--;
+    }
+  } else {
+    if (x) {
+      self->truncated = true;
+    }
+    if (!fractional) {
+      self->exponent++;
+    }
+  }
+}
+
+/// @brief Parse a floating point literal.
+/// @param self A pointer to the decimal.
+/// @param p A pointer to the Bytes.
+/// @param n The number of Bytes.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+static int _dx_decimal_parse(_dx_decimal* self, char const* p, dx_size n) {
+  char const* end = p + n;
+  char const* current = p;
+  self->negative = false;
+  self->mantissa = 0;
+  self->number_of_digits = 0;
+  self->exponent = 0;
+  self->truncated = false;
+  if (current != end) {
+    if (*current == '-') {
+      self->negative = true;
+      current++;
+    } else if (*current == '+') {
+      current++;
+    }
+  }
+  bool has_digits = false;
+  while (is_digit(current, end)) {
+    _dx_decimal_on_digit(self, *current - '0', false);
+    has_digits = true;
+    current++;
+  }
+  if (current != end && *current == '.') {
+    current++;
+    while (is_digit(current, end)) {
+      _dx_decimal_on_digit(self, *current - '0', true);
+      has_digits = true;
+      current++;
+    }
+  }
+  if (!has_digits) {
+    dx_set_error(DX_CONVERSION_FAILED);
     return 1;
   }
-  if (negative) {
+  if (current != end && (*current == 'e' || *current == 'E')) {
+    current++;
+    bool negative = false;
+    if (current != end && (*current == '+' || *current == '-')) {
+      negative = *current == '-';
+      current++;
+    }
+    if (!is_digit(current, end)) {
+      dx_set_error(DX_CONVERSION_FAILED);
+      return 1;
+    }
+    int64_t exponent = 0;
     do {
-      //
-      static dx_i64 const BASE = 10;
-      static dx_i64 const MIN1 = DX_I64_LEAST + 8; // 9223372036854775808 / 10 = 922337203685477580.8 = 922337203685477580.
-                                                   // 922337203685477580 * 10 = 9223372036854775800 is no overflow.
-      if (value == MIN1) {
+      // Saturate. Such exponents yield zero or infinity anyway.
+      if (exponent < 0x10000000) {
+        exponent = exponent * 10 + (*current - '0');
+      }
+      current++;
+    } while (is_digit(current, end));
+    self->exponent += negative ? -exponent : exponent;
+  }
+  if (current != end) {
+    dx_set_error(DX_CONVERSION_FAILED);
+    return 1;
+  }
+  return 0;
+}
+
+/// @brief The parameters of a binary floating point format.
+typedef struct _dx_binary_format {
+  int32_t mantissa_explicit_bits;
+  int32_t minimum_exponent;
+  int32_t infinite_power;
+  int32_t min_exponent_round_to_even;
+  int32_t max_exponent_round_to_even;
+  int32_t smallest_power_of_ten;
+  int32_t largest_power_of_ten;
+} _dx_binary_format;
+
+static _dx_binary_format const g_binary32 = { 23, -127, 0xFF, -17, 10, -65, 38 };
+
+static _dx_binary_format const g_binary64 = { 52, -1023, 0x7FF, -4, 23, -342, 308 };
+
+/// @brief The smallest power of ten in g_powers_of_five.
+#define DX_CONVERT_SMALLEST_POWER_OF_FIVE (-342)
+
+/// @brief The 128 bit approximations of 5^q for q in [-342, 308].
+static uint64_t const g_powers_of_five[] = {
+#define DEFINE(HIGH, LOW) UINT64_C(HIGH), UINT64_C(LOW),
+#include "dx/core/_convert_powers_of_five.i"
+#undef DEFINE
+};
+
+/// @brief The powers of ten exactly representable by dx_f64 values.
+static dx_f64 const g_powers_of_ten_f64[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/// @brief The powers of ten exactly representable by dx_f32 values.
+static dx_f32 const g_powers_of_ten_f32[] = {
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+
+/// @brief A binary floating point value in the making.
+typedef struct _dx_adjusted_mantissa {
+  uint64_t mantissa;
+  int32_t power2;
+} _dx_adjusted_mantissa;
+
+/// @brief Compute the binary floating point value nearest to <code>w * 10^q</code>.
+/// @param format A pointer to the binary floating point format.
+/// @param q The decimal exponent.
+/// @param w The decimal mantissa.
+/// @return The value. Its biased exponent is <code>format->infinite_power</code> on overflow.
+static _dx_adjusted_mantissa _dx_compute_float(_dx_binary_format const* format, int64_t q, uint64_t w) {
+  _dx_adjusted_mantissa answer;
+  if (w == 0 || q < format->smallest_power_of_ten) {
+    answer.power2 = 0;
+    answer.mantissa = 0;
+    return answer;
+  }
+  if (q > format->largest_power_of_ten) {
+    answer.power2 = format->infinite_power;
+    answer.mantissa = 0;
+    return answer;
+  }
+  dx_size lz = dx_count_leading_zeroes_n64(w);
+  w <<= lz;
+  // Compute the product of w and 5^q with (at least) mantissa_explicit_bits + 3 bits of precision.
+  dx_size index = 2 * (dx_size)(q - DX_CONVERT_SMALLEST_POWER_OF_FIVE);
+  uint64_t precision_mask = UINT64_C(0xFFFFFFFFFFFFFFFF) >> (format->mantissa_explicit_bits + 3);
+  uint64_t high, low;
+  low = dx_mul_u64(w, g_powers_of_five[index], &high);
+  if ((high & precision_mask) == precision_mask) {
+    uint64_t high2;
+    dx_mul_u64(w, g_powers_of_five[index + 1], &high2);
+    low += high2;
+    if (high2 > low) {
+      high++;
+    }
+  }
+  int32_t upperbit = (int32_t)(high >> 63);
+  int32_t shift = upperbit + 64 - format->mantissa_explicit_bits - 3;
+  answer.mantissa = high >> shift;
+  // floor(log2(10^q)) + 63 = floor(q * log2(10)) + 63
+  int32_t power = ((((152170 + 65536) * (int32_t)q) >> 16) + 63);
+  answer.power2 = power + upperbit - (int32_t)lz - format->minimum_exponent;
+  if (answer.power2 <= 0) {
+    // Subnormal or zero.
+    if (-answer.power2 + 1 >= 64) {
+      answer.power2 = 0;
+      answer.mantissa = 0;
+      return answer;
+    }
+    answer.mantissa >>= -answer.power2 + 1;
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+    answer.power2 = (answer.mantissa < (UINT64_C(1) << format->mantissa_explicit_bits)) ? 0 : 1;
+    return answer;
+  }
+  // Ties are rounded to even. Ties are only possible for small exponents.
+  if (low <= 1 && q >= format->min_exponent_round_to_even && q <= format->max_exponent_round_to_even && (answer.mantissa & 3) == 1) {
+    if ((answer.mantissa << shift) == high) {
+      answer.mantissa &= ~UINT64_C(1);
+    }
+  }
+  answer.mantissa += (answer.mantissa & 1);
+  answer.mantissa >>= 1;
+  if (answer.mantissa >= (UINT64_C(2) << format->mantissa_explicit_bits)) {
+    answer.mantissa = (UINT64_C(1) << format->mantissa_explicit_bits);
+    answer.power2++;
+  }
+  answer.mantissa &= ~(UINT64_C(1) << format->mantissa_explicit_bits);
+  if (answer.power2 >= format->infinite_power) {
+    answer.power2 = format->infinite_power;
+    answer.mantissa = 0;
+  }
+  return answer;
+}
+
+/// @brief Compute the binary floating point value of a decimal.
+/// @param format A pointer to the binary floating point format.
+/// @param decimal A pointer to the decimal.
+/// @param [out] answer A pointer to the value.
+/// @return @a true if the value was computed. @a false if the decimal was truncated and the rounding is ambiguous.
+static bool _dx_compute_float_decimal(_dx_binary_format const* format, _dx_decimal const* decimal, _dx_adjusted_mantissa* answer) {
+  *answer = _dx_compute_float(format, decimal->exponent, decimal->mantissa);
+  if (decimal->truncated) {
+    // The value is in [mantissa * 10^exponent, (mantissa + 1) * 10^exponent).
+    _dx_adjusted_mantissa other = _dx_compute_float(format, decimal->exponent, decimal->mantissa + 1);
+    if (answer->mantissa != other.mantissa || answer->power2 != other.power2) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief Write a canonical copy of a floating point literal.
+/// The copy consists of an optional sign, at most DX_CONVERT_MAX_DIGITS + 1 digits, and an exponent.
+/// It contains no decimal point, hence its conversion does not depend on the locale.
+/// @param p A pointer to the Bytes of the literal.
+/// @param n The number of Bytes of the literal.
+/// @param buffer A pointer to a buffer of @a size Bytes.
+/// @param size The number of Bytes of the buffer. Must be at least DX_CONVERT_MAX_DIGITS + 32.
+static void _dx_decimal_canonicalize(char const* p, dx_size n, char* buffer, dx_size size) {
+  char const* end = p + n;
+  char const* current = p;
+  dx_size m = 0;
+  if (current != end && (*current == '+' || *current == '-')) {
+    if (*current == '-') {
+      buffer[m++] = '-';
+    }
+    current++;
+  }
+  dx_size number_of_digits = 0;
+  int64_t exponent = 0;
+  bool fractional = false, dropped = false;
+  for (; current != end; ++current) {
+    if (*current == '.') {
+      fractional = true;
+      continue;
+    }
+    if (!is_digit(current, end)) {
+      break;
+    }
+    if (!number_of_digits && *current == '0') {
+      if (fractional) {
+        exponent--;
+      }
+    } else if (number_of_digits < DX_CONVERT_MAX_DIGITS) {
+      buffer[m++] = *current;
+      number_of_digits++;
+      if (fractional) {
+        exponent--;
+      }
+    } else {
+      if (*current != '0') {
+        dropped = true;
+      }
+      if (!fractional) {
+        exponent++;
+      }
+    }
+  }
+  if (!number_of_digits) {
+    buffer[m++] = '0';
+  }
+  if (dropped) {
+    // A sticky digit so that the copy is not a tie if the original is not.
+    buffer[m++] = '1';
+    exponent--;
+  }
+  if (current != end) {
+    // The exponent is well-formed as the literal was parsed before.
+    current++;
+    bool negative = false;
+    if (*current == '+' || *current == '-') {
+      negative = *current == '-';
+      current++;
+    }
+    int64_t explicit_exponent = 0;
+    for (; current != end; ++current) {
+      if (explicit_exponent < 0x10000000) {
+        explicit_exponent = explicit_exponent * 10 + (*current - '0');
+      }
+    }
+    exponent += negative ? -explicit_exponent : explicit_exponent;
+  }
+  // m is at most DX_CONVERT_MAX_DIGITS + 2 (sign, digits, sticky digit).
+  // The remaining Bytes suffice for "e", a sign, the digits of the exponent, and the zero terminator.
+  snprintf(buffer + m, size - m, "e%lld", (long long)exponent);
+}
+
+int dx_convert_utf8bytes_to_f32(char const* p, dx_size n, dx_f32* target) {
+  if (!p || !target) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  _dx_decimal decimal;
+  if (_dx_decimal_parse(&decimal, p, n)) {
+    return 1;
+  }
+  dx_f32 v;
+  if (!decimal.truncated && -10 <= decimal.exponent && decimal.exponent <= 10 && decimal.mantissa <= (UINT64_C(1) << 24)) {
+    // Clinger's fast path: The mantissa and the power of ten are exact, so is the result of the operation.
+    v = (dx_f32)decimal.mantissa;
+    v = decimal.exponent < 0 ? v / g_powers_of_ten_f32[-decimal.exponent] : v * g_powers_of_ten_f32[decimal.exponent];
+    if (decimal.negative) {
+      v = -v;
+    }
+  } else {
+    _dx_adjusted_mantissa answer;
+    if (_dx_compute_float_decimal(&g_binary32, &decimal, &answer)) {
+      if (answer.power2 == g_binary32.infinite_power) {
         dx_set_error(DX_CONVERSION_FAILED);
         return 1;
       }
-      value = value * BASE;
-      //
-      static dx_i64 const MIN2 = DX_I64_LEAST;
-      dx_i64 x = ((dx_i64)*current) - ((dx_i64)'0');
-      if (value < MIN2 + x) {
+      uint32_t bits = (uint32_t)answer.mantissa
+                    | ((uint32_t)answer.power2 << g_binary32.mantissa_explicit_bits)
+                    | ((uint32_t)decimal.negative << 31);
+      memcpy(&v, &bits, sizeof(dx_f32));
+    } else {
+      char buffer[DX_CONVERT_MAX_DIGITS + 32];
+      _dx_decimal_canonicalize(p, n, buffer, sizeof(buffer));
+      v = strtof(buffer, NULL);
+      if (isinf(v)) {
         dx_set_error(DX_CONVERSION_FAILED);
         return 1;
       }
-      value -= x;
-      //
-      current++;
-    } while (is_digit(current, end));
+    }
+  }
+  *target = v;
+  return 0;
+}
+
+int dx_convert_utf8bytes_to_f64(char const* p, dx_size n, dx_f64* target) {
+  if (!p || !target) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  _dx_decimal decimal;
+  if (_dx_decimal_parse(&decimal, p, n)) {
+    return 1;
+  }
+  dx_f64 v;
+  if (!decimal.truncated && -22 <= decimal.exponent && decimal.exponent <= 22 && decimal.mantissa <= (UINT64_C(1) << 53)) {
+    // Clinger's fast path: The mantissa and the power of ten are exact, so is the result of the operation.
+    v = (dx_f64)decimal.mantissa;
+    v = decimal.exponent < 0 ? v / g_powers_of_ten_f64[-decimal.exponent] : v * g_powers_of_ten_f64[decimal.exponent];
+    if (decimal.negative) {
+      v = -v;
+    }
   } else {
-    do {
-      //
-      static dx_i64 const BASE = 10;
-      static dx_i64 const MAX1 = DX_I64_GREATEST - 7; // 9223372036854775807 / 10 = 922337203685477580.7 = 922337203685477580.
-                                                      // 922337203685477580 * 10 = 9223372036854775800 is no overflow.
-      if (value == MAX1) {
+    _dx_adjusted_mantissa answer;
+    if (_dx_compute_float_decimal(&g_binary64, &decimal, &answer)) {
+      if (answer.power2 == g_binary64.infinite_power) {
         dx_set_error(DX_CONVERSION_FAILED);
         return 1;
       }
-      value = value * BASE;
-      //
-      static dx_i64 const MAX2 = DX_I64_GREATEST;
-      dx_i64 x = ((dx_i64)*current) - ((dx_i64)'0');
-      if (MAX2 - x < value) {
+      uint64_t bits = answer.mantissa
+                    | ((uint64_t)answer.power2 << g_binary64.mantissa_explicit_bits)
+                    | ((uint64_t)decimal.negative << 63);
+      memcpy(&v, &bits, sizeof(dx_f64));
+    } else {
+      char buffer[DX_CONVERT_MAX_DIGITS + 32];
+      _dx_decimal_canonicalize(p, n, buffer, sizeof(buffer));
+      v = strtod(buffer, NULL);
+      if (isinf(v)) {
         dx_set_error(DX_CONVERSION_FAILED);
         return 1;
       }
-      value += x;
-      //
-      current++;
-    } while (is_digit(current, end));
+    }
   }
-  *target = value;
+  *target = v;
   return 0;
 }
 
-int dx_convert_utf8bytes_to_n64(char const* p, dx_size n, dx_n64* target) {
+int dx_convert_utf8bytes_to_bool(char const* p, dx_size n, dx_bool* target) {
   if (!p || !target) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  char const* start = p;
-  char const* end = p + n;
-  char const* current = start;
-  if (current != end) {
-    if (*current == '-') {
+  static_assert(sizeof("true") != sizeof("false"), "environment not supported");
+  switch (n) {
+    case sizeof("true") - sizeof(char) : {
+      *target = !memcmp(p, "true", n);
+      return 0;
+    } break;
+    case sizeof("false") - sizeof(char) : {
+      *target = !memcmp(p, "false", n);
+      return 0;
+    } break;
+    default: {
       dx_set_error(DX_CONVERSION_FAILED);
       return 1;
-    } else if (*current == '+') {
-      current++;
+    } break;
+  };
+}
+
+#if defined(DX_CONVERT_WITH_TESTS) && 1 == DX_CONVERT_WITH_TESTS
+
+// Test if a literal converts to the expected value or fails to convert as expected.
+#define DX_CONVERT_TEST(TYPE, LITERAL, EXPECT_FAILURE, EXPECTED) \
+  { \
+    dx_##TYPE v; \
+    char const* p = LITERAL; \
+    int result = dx_convert_utf8bytes_to_##TYPE(p, strlen(p), &v); \
+    if (EXPECT_FAILURE) { \
+      if (!result) { \
+        return 1; \
+      } \
+      dx_set_error(DX_NO_ERROR); \
+    } else if (result || v != (EXPECTED)) { \
+      return 1; \
+    } \
+  }
+
+// Exhaustive tests for the 8 bit and 16 bit types: Every value and the values just out of range.
+static int dx_convert_8_16_tests() {
+  char buffer[32];
+  for (int32_t i = DX_I16_LEAST - 1; i <= DX_I16_GREATEST + 1; ++i) {
+    snprintf(buffer, sizeof(buffer), "%" PRId32, i);
+    bool i8_ok = DX_I8_LEAST <= i && i <= DX_I8_GREATEST;
+    bool n8_ok = 0 <= i && i <= DX_N8_GREATEST;
+    bool i16_ok = DX_I16_LEAST <= i && i <= DX_I16_GREATEST;
+    DX_CONVERT_TEST(i8, buffer, !i8_ok, (dx_i8)i);
+    DX_CONVERT_TEST(n8, buffer, !n8_ok, (dx_n8)i);
+    DX_CONVERT_TEST(i16, buffer, !i16_ok, (dx_i16)i);
+  }
+  for (int32_t i = -1; i <= DX_N16_GREATEST + 1; ++i) {
+    snprintf(buffer, sizeof(buffer), "%" PRId32, i);
+    bool n16_ok = 0 <= i && i <= DX_N16_GREATEST;
+    DX_CONVERT_TEST(n16, buffer, !n16_ok, (dx_n16)i);
+  }
+  return 0;
+}
+
+// Tests for the 32 bit and 64 bit types: The values around the bounds and around powers of ten.
+static int dx_convert_32_64_tests() {
+  char buffer[64];
+  for (int64_t d = -16; d <= 16; ++d) {
+    // Around the least and the greatest dx_i32 value.
+    int64_t i = (int64_t)DX_I32_LEAST + d;
+    snprintf(buffer, sizeof(buffer), "%" PRId64, i);
+    DX_CONVERT_TEST(i32, buffer, i < DX_I32_LEAST, (dx_i32)i);
+    i = (int64_t)DX_I32_GREATEST + d;
+    snprintf(buffer, sizeof(buffer), "%" PRId64, i);
+    DX_CONVERT_TEST(i32, buffer, i > DX_I32_GREATEST, (dx_i32)i);
+    // Around the greatest dx_n32 value.
+    i = (int64_t)DX_N32_GREATEST + d;
+    snprintf(buffer, sizeof(buffer), "%" PRId64, i);
+    DX_CONVERT_TEST(n32, buffer, i > DX_N32_GREATEST, (dx_n32)i);
+    // Around the least and the greatest dx_i64 value.
+    if (d >= 0) {
+      i = DX_I64_LEAST + d;
+      snprintf(buffer, sizeof(buffer), "%" PRId64, i);
+      DX_CONVERT_TEST(i64, buffer, false, i);
+      i = DX_I64_GREATEST - d;
+      snprintf(buffer, sizeof(buffer), "%" PRId64, i);
+      DX_CONVERT_TEST(i64, buffer, false, i);
+      uint64_t u = DX_N64_GREATEST - (uint64_t)d;
+      snprintf(buffer, sizeof(buffer), "%" PRIu64, u);
+      DX_CONVERT_TEST(n64, buffer, false, u);
     }
   }
-  if (current == end) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
+  // Just out of range.
+  DX_CONVERT_TEST(i64, "-9223372036854775809", true, 0);
+  DX_CONVERT_TEST(i64, "9223372036854775808", true, 0);
+  DX_CONVERT_TEST(n64, "18446744073709551616", true, 0);
+  DX_CONVERT_TEST(n64, "18446744073709551620", true, 0);
+  DX_CONVERT_TEST(n64, "99999999999999999999", true, 0);
+  DX_CONVERT_TEST(n64, "184467440737095516150", true, 0);
+  // Every power of ten and its predecessor: Covers numbers of digits around the blocks of eight digits.
+  uint64_t u = 1;
+  for (int k = 0; k < 20; ++k) {
+    snprintf(buffer, sizeof(buffer), "%" PRIu64, u);
+    DX_CONVERT_TEST(n64, buffer, false, u);
+    snprintf(buffer, sizeof(buffer), "%" PRIu64, u - 1);
+    DX_CONVERT_TEST(n64, buffer, false, u - 1);
+    if (k < 19) {
+      u *= 10;
+    }
   }
-  dx_n64 value = 0;
-  // digit+
-  if (!is_digit(current, end)) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
+  return 0;
+}
+
+// Tests for the syntax.
+static int dx_convert_syntax_tests() {
+  DX_CONVERT_TEST(i32, "0", false, 0);
+  DX_CONVERT_TEST(i32, "-0", false, 0);
+  DX_CONVERT_TEST(i32, "+0", false, 0);
+  DX_CONVERT_TEST(i32, "+17", false, 17);
+  DX_CONVERT_TEST(n8, "-0", true, 0);
+  DX_CONVERT_TEST(n64, "00000000000000000000000000000001", false, 1);
+  DX_CONVERT_TEST(i64, "-00000000000000000000009223372036854775808", false, DX_I64_LEAST);
+  DX_CONVERT_TEST(n64, "1234567812345678", false, UINT64_C(1234567812345678));
+  DX_CONVERT_TEST(i32, "", true, 0);
+  DX_CONVERT_TEST(i32, "-", true, 0);
+  DX_CONVERT_TEST(i32, "+", true, 0);
+  DX_CONVERT_TEST(i32, "+-1", true, 0);
+  DX_CONVERT_TEST(i32, " 1", true, 0);
+  DX_CONVERT_TEST(i32, "1 ", true, 0);
+  DX_CONVERT_TEST(i32, "1a", true, 0);
+  DX_CONVERT_TEST(i32, "1.0", true, 0);
+  // A non-digit in every position of a block of eight digits.
+  char buffer[] = "1234567812345678";
+  for (dx_size i = 0; i < sizeof(buffer) - 1; ++i) {
+    char c = buffer[i];
+    buffer[i] = '/';
+    DX_CONVERT_TEST(n64, buffer, true, 0);
+    buffer[i] = ':';
+    DX_CONVERT_TEST(n64, buffer, true, 0);
+    buffer[i] = c;
   }
-  do {
-    //
-    static dx_n64 const BASE = 10;
-    static dx_n64 const MAX1 = DX_N64_GREATEST - 5; // 18446744073709551615	/ 10 = 1844674407370955161.5 = 1844674407370955161.
-                                                    // 1844674407370955161 * 10 = 18446744073709551610 is no overflow.
-    if (value == MAX1) {
-      dx_set_error(DX_CONVERSION_FAILED);
+  return 0;
+}
+
+#undef DX_CONVERT_TEST
+
+// A floating point literal and the bits of the dx_f64 value and of the dx_f32 value it converts to.
+typedef struct _dx_convert_tests_float_literal {
+  char const* literal;
+  // @a true if the conversion to dx_f64 is expected to fail.
+  bool f64_fails;
+  uint64_t f64;
+  // @a true if the conversion to dx_f32 is expected to fail.
+  bool f32_fails;
+  uint32_t f32;
+} _dx_convert_tests_float_literal;
+
+static _dx_convert_tests_float_literal const _dx_convert_tests_float_test_literals[] = {
+  // Signed zeroes.
+  { "0", false, UINT64_C(0x0000000000000000), false, UINT32_C(0x00000000) },
+  { "-0", false, UINT64_C(0x8000000000000000), false, UINT32_C(0x80000000) },
+  { "0e999999999", false, UINT64_C(0x0000000000000000), false, UINT32_C(0x00000000) },
+  // More than 19 significant digits.
+  { "3.14159265358979323846264338327950288", false, UINT64_C(0x400921fb54442d18), false, UINT32_C(0x40490fdb) },
+  { "123456789012345678901234567890", false, UINT64_C(0x45f8ee90ff6c373e), false, UINT32_C(0x6fc77488) },
+  { "0.1000000000000000000000000001", false, UINT64_C(0x3fb999999999999a), false, UINT32_C(0x3dcccccd) },
+  { "18446744073709551616", false, UINT64_C(0x43f0000000000000), false, UINT32_C(0x5f800000) },
+  // Ties are rounded to even. Digits beyond a tie decide the rounding.
+  { "9007199254740993", false, UINT64_C(0x4340000000000000), false, UINT32_C(0x5a000000) },
+  { "9007199254740995", false, UINT64_C(0x4340000000000002), false, UINT32_C(0x5a000000) },
+  { "9007199254740993.0000000000001", false, UINT64_C(0x4340000000000001), false, UINT32_C(0x5a000000) },
+  { "1.00000000000000011102230246251565404236316680908203125", false, UINT64_C(0x3ff0000000000000), false, UINT32_C(0x3f800000) },
+  { "1.00000000000000011102230246251565404236316680908203126", false, UINT64_C(0x3ff0000000000001), false, UINT32_C(0x3f800000) },
+  { "16777217", false, UINT64_C(0x4170000010000000), false, UINT32_C(0x4b800000) },
+  { "16777219", false, UINT64_C(0x4170000030000000), false, UINT32_C(0x4b800002) },
+  { "16777217.000000000001", false, UINT64_C(0x4170000010000000), false, UINT32_C(0x4b800001) },
+  { "1.000000059604644775390625", false, UINT64_C(0x3ff0000010000000), false, UINT32_C(0x3f800000) },
+  { "1.000000178813934326171875", false, UINT64_C(0x3ff0000030000000), false, UINT32_C(0x3f800002) },
+  // Subnormal values and values too small for the format.
+  { "4.9406564584124654e-324", false, UINT64_C(0x0000000000000001), false, UINT32_C(0x00000000) },
+  { "2.4703282292062327e-324", false, UINT64_C(0x0000000000000000), false, UINT32_C(0x00000000) },
+  { "2.4703282292062328e-324", false, UINT64_C(0x0000000000000001), false, UINT32_C(0x00000000) },
+  { "2.2250738585072009e-308", false, UINT64_C(0x000fffffffffffff), false, UINT32_C(0x00000000) },
+  { "2.2250738585072014e-308", false, UINT64_C(0x0010000000000000), false, UINT32_C(0x00000000) },
+  { "1.40129846e-45", false, UINT64_C(0x369ffffffe57d2bc), false, UINT32_C(0x00000001) },
+  { "7.00649232e-46", false, UINT64_C(0x368fffffffe0245c), false, UINT32_C(0x00000000) },
+  { "1.17549421e-38", false, UINT64_C(0x380fffffbfaf0a2a), false, UINT32_C(0x007fffff) },
+  { "1e-39", false, UINT64_C(0x37d5c72fb1552d83), false, UINT32_C(0x000ae398) },
+  { "1e-400", false, UINT64_C(0x0000000000000000), false, UINT32_C(0x00000000) },
+  // The greatest values and values too great for the format.
+  { "1.7976931348623157e308", false, UINT64_C(0x7fefffffffffffff), true, 0 },
+  { "1.7976931348623158e308", false, UINT64_C(0x7fefffffffffffff), true, 0 },
+  { "1.7976931348623159e308", true, 0, true, 0 },
+  { "1e309", true, 0, true, 0 },
+  { "-1e309", true, 0, true, 0 },
+  { "1e99999999999", true, 0, true, 0 },
+  { "3.4028235e38", false, UINT64_C(0x47efffffe54daff8), false, UINT32_C(0x7f7fffff) },
+  { "3.40282357e38", false, UINT64_C(0x47effffff058f701), true, 0 },
+  { "1e39", false, UINT64_C(0x48078287f49c4a1d), true, 0 },
+};
+
+#define _DX_CONVERT_TESTS_NUMBER_OF_FLOAT_TEST_LITERALS (sizeof(_dx_convert_tests_float_test_literals) / sizeof(_dx_convert_tests_float_literal))
+
+// A literal of more than 200 Bytes: A prefix, a digit repeated a number of times, and a suffix.
+typedef struct _dx_convert_tests_long_float_literal {
+  char const* prefix;
+  char digit;
+  dx_size number_of_digits;
+  char const* suffix;
+  _dx_convert_tests_float_literal expected;
+} _dx_convert_tests_long_float_literal;
+
+static _dx_convert_tests_long_float_literal const _dx_convert_tests_long_float_test_literals[] = {
+  { "1", '0', 250, "e-250", { NULL, false, UINT64_C(0x3ff0000000000000), false, UINT32_C(0x3f800000) } },
+  { "0.", '0', 300, "1e301", { NULL, false, UINT64_C(0x3ff0000000000000), false, UINT32_C(0x3f800000) } },
+  // More than DX_CONVERT_MAX_DIGITS digits: Only a non-zero digit beyond the tie rounds up.
+  { "1.00000000000000011102230246251565404236316680908203125", '0', 800, "", { NULL, false, UINT64_C(0x3ff0000000000000), false, UINT32_C(0x3f800000) } },
+  { "1.00000000000000011102230246251565404236316680908203125", '0', 800, "1", { NULL, false, UINT64_C(0x3ff0000000000001), false, UINT32_C(0x3f800000) } },
+  { "16777217.", '0', 300, "1", { NULL, false, UINT64_C(0x4170000010000000), false, UINT32_C(0x4b800001) } },
+  { "", '1', 250, "", { NULL, false, UINT64_C(0x73a3dd3c26a4baaf), true, 0 } },
+  { "0.", '1', 250, "", { NULL, false, UINT64_C(0x3fbc71c71c71c71c), false, UINT32_C(0x3de38e39) } },
+};
+
+#define _DX_CONVERT_TESTS_NUMBER_OF_LONG_FLOAT_TEST_LITERALS (sizeof(_dx_convert_tests_long_float_test_literals) / sizeof(_dx_convert_tests_long_float_literal))
+
+// Test if a literal converts to the expected bits or fails to convert as expected.
+static int _dx_convert_tests_float_literal_run(char const* p, dx_size n, _dx_convert_tests_float_literal const* expected) {
+  dx_f64 u;
+  if (dx_convert_utf8bytes_to_f64(p, n, &u)) {
+    if (!expected->f64_fails || dx_get_error() != DX_CONVERSION_FAILED) {
       return 1;
     }
-    value = value * BASE;
-    //
-    static dx_n64 const MAX2 = DX_N64_GREATEST;
-    dx_n64 x = ((dx_n64)*current) - (dx_n64)'0';
-    if (MAX2 - x < value) {
-      dx_set_error(DX_CONVERSION_FAILED);
+    dx_set_error(DX_NO_ERROR);
+  } else {
+    uint64_t bits;
+    memcpy(&bits, &u, sizeof(dx_f64));
+    if (expected->f64_fails || bits != expected->f64) {
       return 1;
     }
-    value += x;
-    //
-    current++;
-  } while (is_digit(current, end));
-  *target = value;
+  }
+  dx_f32 v;
+  if (dx_convert_utf8bytes_to_f32(p, n, &v)) {
+    if (!expected->f32_fails || dx_get_error() != DX_CONVERSION_FAILED) {
+      return 1;
+    }
+    dx_set_error(DX_NO_ERROR);
+  } else {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(dx_f32));
+    if (expected->f32_fails || bits != expected->f32) {
+      return 1;
+    }
+  }
   return 0;
 }
 
-int dx_convert_utf8bytes_to_sz(char const* p, dx_size n, dx_size* target) {
-#if defined(_M_X64)
-  return dx_convert_utf8bytes_to_n64(p, n, target);
-#elif defined(_M_IX86)
-  return dx_convert_utf8bytes_to_n32(p, n, target);
-#else
-  #error("environment not supported")
-#endif
+// Tests for the conversions to dx_f64 and dx_f32: Many digits, ties, subnormal values, overflow, and long literals.
+static int dx_convert_float_tests() {
+  for (dx_size i = 0; i < _DX_CONVERT_TESTS_NUMBER_OF_FLOAT_TEST_LITERALS; ++i) {
+    _dx_convert_tests_float_literal const* literal = &_dx_convert_tests_float_test_literals[i];
+    if (_dx_convert_tests_float_literal_run(literal->literal, strlen(literal->literal), literal)) {
+      return 1;
+    }
+  }
+  char buffer[1024];
+  for (dx_size i = 0; i < _DX_CONVERT_TESTS_NUMBER_OF_LONG_FLOAT_TEST_LITERALS; ++i) {
+    _dx_convert_tests_long_float_literal const* literal = &_dx_convert_tests_long_float_test_literals[i];
+    dx_size n = 0;
+    memcpy(buffer + n, literal->prefix, strlen(literal->prefix));
+    n += strlen(literal->prefix);
+    memset(buffer + n, literal->digit, literal->number_of_digits);
+    n += literal->number_of_digits;
+    memcpy(buffer + n, literal->suffix, strlen(literal->suffix));
+    n += strlen(literal->suffix);
+    if (_dx_convert_tests_float_literal_run(buffer, n, &literal->expected)) {
+      return 1;
+    }
+  }
+  return 0;
 }
 
+#if defined(DX_CONVERT_WITH_BENCHMARKS) && 1 == DX_CONVERT_WITH_BENCHMARKS
 
-int dx_convert_utf8bytes_to_f32(char const* p, dx_size n, dx_f32* target) {
-  if (dx_parse_flit(p, n)) {
-    return 1;
-  }
+// The number of times the literals are converted by a benchmark.
+#define _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS (64 * 1024)
+
+// Number-heavy literals as found in ADL files. Most of them take Clinger's fast path.
+static char const* const _dx_convert_tests_float_literals[] = {
+  "0", "1", "0.5", "-0.5", "255.0", "0.25", "-1.25e-3", "3.14159265358979",
+  "1e10", "0.1", "100", "-2.0", "0.0039215686", "6.5", "1.0e-5", "42",
+};
+
+// Literals which take the Eisel-Lemire path: At most 19 significant digits but outside of Clinger's fast path.
+static char const* const _dx_convert_tests_eisel_lemire_float_literals[] = {
+  "1.7976931348623157e308", "2.2250738585072014e-308", "6.02214076e23", "1.602176634e-19",
+  "6.62607015e-34", "0.30000000000000004", "123456789.123456789", "1e-30",
+};
+
+// Literals which take the strtod fallback: More than 19 significant digits and the rounding is ambiguous.
+static char const* const _dx_convert_tests_strtod_float_literals[] = {
+  "9007199254740993.0000000000001",
+  "1.00000000000000011102230246251565404236316680908203125",
+  "1.00000000000000011102230246251565404236316680908203126",
+  "2.0000000000000002220446049250313080847263336181640625",
+  "0.50000000000000005551115123125782702118158340454101562",
+};
+
+// Convert a literal the way it was done before: Copy it into a zero-terminated buffer and invoke strtod.
+static int _dx_convert_tests_strtod(char const* p, dx_size n, dx_f64* target) {
 #define N_MAX 200
   if (n > N_MAX) {
-    dx_set_error(DX_CONVERSION_FAILED);
     return 1;
   }
-  errno = 0;
   char buffer[N_MAX + 1];
   memcpy(buffer, p, n);
   buffer[n] = '\0';
   char* end;
-  double v = strtof(buffer, &end);
+  double v = strtod(buffer, &end);
   if (end != &buffer[n]) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  if (errno) {
-    dx_set_error(DX_CONVERSION_FAILED);
     return 1;
   }
 #undef N_MAX
@@ -622,52 +994,189 @@ int dx_convert_utf8bytes_to_f32(char const* p, dx_size n, dx_f32* target) {
   return 0;
 }
 
-int dx_convert_utf8bytes_to_f64(char const* p, dx_size n, dx_f64* target) {
-  if (dx_parse_flit(p, n)) {
+// Benchmark dx_convert_utf8bytes_to_f64 against the conversion via strtod.
+static int _dx_convert_float_benchmark(char const* const* literals, dx_size number_of_literals, char const* name, char const* strtod_name) {
+  dx_size lengths[16];
+  if (number_of_literals > 16) {
     return 1;
   }
-#define N_MAX 200
-  if (n > N_MAX) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
+  for (dx_size i = 0; i < number_of_literals; ++i) {
+    lengths[i] = strlen(literals[i]);
+    dx_f64 u, v;
+    if (dx_convert_utf8bytes_to_f64(literals[i], lengths[i], &u)) {
+      return 1;
+    }
+    if (_dx_convert_tests_strtod(literals[i], lengths[i], &v)) {
+      return 1;
+    }
+    if (u != v) {
+      return 1;
+    }
   }
-  errno = 0;
-  char buffer[N_MAX + 1];
-  memcpy(buffer, p, n);
-  buffer[n] = '\0';
-  char* end;
-  double v = strtod(buffer, &end);
-  if (end != &buffer[n]) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  // The sum prevents the conversions from being optimized away.
+  dx_f64 sum = 0.;
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS; ++j) {
+    for (dx_size i = 0; i < number_of_literals; ++i) {
+      dx_f64 v;
+      if (dx_convert_utf8bytes_to_f64(literals[i], lengths[i], &v)) {
+        return 1;
+      }
+      sum += v;
+    }
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  dx_log_benchmark(name, time, _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS * number_of_literals);
+  dx_f64 sum_strtod = 0.;
+  start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS; ++j) {
+    for (dx_size i = 0; i < number_of_literals; ++i) {
+      dx_f64 v;
+      if (_dx_convert_tests_strtod(literals[i], lengths[i], &v)) {
+        return 1;
+      }
+      sum_strtod += v;
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  dx_log_benchmark(strtod_name, time, _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS * number_of_literals);
+  if (sum != sum_strtod) {
     return 1;
   }
-  if (errno) {
-    dx_set_error(DX_CONVERSION_FAILED);
+  return 0;
+}
+
+static int dx_convert_float_benchmarks() {
+#define BENCHMARK(LITERALS, NAME) \
+  if (_dx_convert_float_benchmark(LITERALS, sizeof(LITERALS) / sizeof(char const*), \
+                                  "dx_convert_utf8bytes_to_f64 (" NAME ")", "strtod (" NAME ")")) { \
+    return 1; \
+  }
+  BENCHMARK(_dx_convert_tests_float_literals, "ADL literals");
+  BENCHMARK(_dx_convert_tests_eisel_lemire_float_literals, "Eisel-Lemire literals");
+  BENCHMARK(_dx_convert_tests_strtod_float_literals, "strtod fallback literals");
+#undef BENCHMARK
+  return 0;
+}
+
+// Integer literals of different lengths as found in ADL files.
+static char const* const _dx_convert_tests_integer_literals[] = {
+  "0", "1", "7", "16", "255", "1024", "65535", "123456", "16777216",
+  "4294967295", "1234567812345678", "9223372036854775807", "18446744073709551615",
+};
+
+#define _DX_CONVERT_TESTS_NUMBER_OF_INTEGER_LITERALS (sizeof(_dx_convert_tests_integer_literals) / sizeof(char const*))
+
+// Convert a literal one digit at a time with an overflow check for every digit.
+static int _dx_convert_tests_digit_by_digit(char const* p, dx_size n, dx_n64* target) {
+  if (!n) {
     return 1;
   }
-#undef N_MAX
+  dx_n64 v = 0;
+  for (dx_size i = 0; i < n; ++i) {
+    if (p[i] < '0' || p[i] > '9') {
+      return 1;
+    }
+    dx_n64 d = (dx_n64)(p[i] - '0');
+    if (v > (DX_N64_GREATEST - d) / 10) {
+      return 1;
+    }
+    v = v * 10 + d;
+  }
   *target = v;
   return 0;
 }
 
-int dx_convert_utf8bytes_to_bool(char const* p, dx_size n, dx_bool* target) {
-  if (!p || !target) {
-    dx_set_error(DX_INVALID_ARGUMENT);
+// Benchmark dx_convert_utf8bytes_to_n64 against the conversion one digit at a time.
+static int dx_convert_integer_benchmarks() {
+  dx_size lengths[_DX_CONVERT_TESTS_NUMBER_OF_INTEGER_LITERALS];
+  dx_size number_of_bytes = 0;
+  for (dx_size i = 0; i < _DX_CONVERT_TESTS_NUMBER_OF_INTEGER_LITERALS; ++i) {
+    lengths[i] = strlen(_dx_convert_tests_integer_literals[i]);
+    number_of_bytes += lengths[i];
+    dx_n64 u, v;
+    if (dx_convert_utf8bytes_to_n64(_dx_convert_tests_integer_literals[i], lengths[i], &u)) {
+      return 1;
+    }
+    if (_dx_convert_tests_digit_by_digit(_dx_convert_tests_integer_literals[i], lengths[i], &v)) {
+      return 1;
+    }
+    if (u != v) {
+      return 1;
+    }
+  }
+  // The sum prevents the conversions from being optimized away.
+  dx_n64 sum = 0;
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS; ++j) {
+    for (dx_size i = 0; i < _DX_CONVERT_TESTS_NUMBER_OF_INTEGER_LITERALS; ++i) {
+      dx_n64 v;
+      if (dx_convert_utf8bytes_to_n64(_dx_convert_tests_integer_literals[i], lengths[i], &v)) {
+        return 1;
+      }
+      sum += v;
+    }
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  dx_log_benchmark("dx_convert_utf8bytes_to_n64 (operations are Bytes)", time, _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS * number_of_bytes);
+  dx_n64 sum_i64 = 0;
+  start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS; ++j) {
+    for (dx_size i = 0; i < _DX_CONVERT_TESTS_NUMBER_OF_INTEGER_LITERALS; ++i) {
+      dx_i64 v;
+      if (dx_convert_utf8bytes_to_i64(_dx_convert_tests_integer_literals[i], lengths[i], &v)) {
+        // The literals greater than the greatest dx_i64 value fail to convert.
+        dx_set_error(DX_NO_ERROR);
+        continue;
+      }
+      sum_i64 += (dx_n64)v;
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  dx_log_benchmark("dx_convert_utf8bytes_to_i64 (operations are Bytes)", time, _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS * number_of_bytes);
+  dx_n64 sum_digit_by_digit = 0;
+  start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS; ++j) {
+    for (dx_size i = 0; i < _DX_CONVERT_TESTS_NUMBER_OF_INTEGER_LITERALS; ++i) {
+      dx_n64 v;
+      if (_dx_convert_tests_digit_by_digit(_dx_convert_tests_integer_literals[i], lengths[i], &v)) {
+        return 1;
+      }
+      sum_digit_by_digit += v;
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  dx_log_benchmark("digit by digit (operations are Bytes)", time, _DX_CONVERT_TESTS_NUMBER_OF_ROUNDS * number_of_bytes);
+  if (sum != sum_digit_by_digit || !sum_i64) {
     return 1;
   }
-  static_assert(sizeof("true") != sizeof("false"), "environment not supported");
-  switch (n) {
-    case sizeof("true") - sizeof(char) : {
-      *target = !memcmp(p, "true", n);
-      return 0;
-    } break;
-    case sizeof("false") - sizeof(char) : {
-      *target = !memcmp(p, "false", n);
-      return 0;
-    } break;
-    default: {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    } break;
-  };
+  return 0;
+}
+
+#endif // DX_CONVERT_WITH_BENCHMARKS
+
+int dx_convert_tests() {
+  if (dx_convert_8_16_tests()) {
+    return 1;
+  }
+  if (dx_convert_32_64_tests()) {
+    return 1;
+  }
+  if (dx_convert_syntax_tests()) {
+    return 1;
+  }
+  if (dx_convert_float_tests()) {
+    return 1;
+  }
+#if defined(DX_CONVERT_WITH_BENCHMARKS) && 1 == DX_CONVERT_WITH_BENCHMARKS
+  if (dx_convert_float_benchmarks()) {
+    return 1;
+  }
+  if (dx_convert_integer_benchmarks()) {
+    return 1;
+  }
+#endif
+  return 0;
 }
+
+#endif // DX_CONVERT_WITH_TESTS
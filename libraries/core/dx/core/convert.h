@@ -111,4 +111,10 @@ int dx_convert_utf8bytes_to_f64(char const* p, dx_size n, dx_f64* target);
 /// @default-failure @a target was not dereferenced.
 int dx_convert_utf8bytes_to_bool(char const* p, dx_size n, dx_bool* target);
 
+#if defined(DX_CONVERT_WITH_TESTS) && 1 == DX_CONVERT_WITH_TESTS
+
+int dx_convert_tests();
+
+#endif // DX_CONVERT_WITH_TESTS
+
 #endif // DX_CORE_CONVERT_H_INCLUDED
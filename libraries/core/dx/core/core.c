@@ -8,13 +8,26 @@
 // isnan, fabsf, fabs
 #include <math.h>
 
-// InterlockedIncrement64, InterlockedDecrement64
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
+// memcpy, memset, strlen
+#include <string.h>
+
+#if defined(_M_X64)
+  // _umul128
+  #include <intrin.h>
+#endif
 
 #include "dx/core/safe_mul_nx.h"
 #include "dx/core/safe_add_nx.h"
 
+#if defined(DX_HASH_WITH_TESTS) && 1 == DX_HASH_WITH_TESTS
+#include "dx/core/algorithms.h"
+#include "dx/core/memory.h"
+#endif
+
+#if defined(DX_HASH_WITH_TESTS) && 1 == DX_HASH_WITH_TESTS && defined(DX_HASH_WITH_BENCHMARKS) && 1 == DX_HASH_WITH_BENCHMARKS
+#include "dx/core/os.h"
+#endif
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 DX_THREAD_LOCAL() dx_error g_error = DX_NO_ERROR;
@@ -29,32 +42,6 @@ void dx_set_error(dx_error error) {
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-dx_reference_counter dx_reference_counter_increment(dx_reference_counter* reference_counter) {
-#if 1 == DX_ATOMIC_REFERENCE_COUNTING_ENABLED
-  #if defined(_WIN64)
-    return InterlockedIncrement64(reference_counter);
-  #else
-    return InterlockedIncrement(reference_counter);
-  #endif
-#else
-  return ++(*reference_counter);
-#endif
-}
-
-dx_reference_counter dx_reference_counter_decrement(dx_reference_counter* reference_counter) {
-#if 1 == DX_ATOMIC_REFERENCE_COUNTING_ENABLED
-  #if defined(_WIN64)
-    return InterlockedDecrement64(reference_counter);
-  #else
-    return InterlockedDecrement(reference_counter);
-  #endif
-#else
-  return --(*reference_counter);
-#endif
-}
-
-/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
 void dx_log(char const *p, dx_size n) {
   if (!p || !n) {
     return;
@@ -104,6 +91,12 @@ void dx_log_p(void const* p) {
   fprintf(stdout, "%p", p);
 }
 
+void dx_log_benchmark(char const* name, dx_n64 time, dx_size number_of_operations) {
+  fprintf(stdout, "%s: %"PRIu64" operations in %"PRIu64" ns (%.2f ns per operation)\n",
+          name, (dx_n64)number_of_operations, time,
+          number_of_operations ? (dx_f64)time / (dx_f64)number_of_operations : 0.);
+}
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 bool dx_almost_equal_f32(dx_f32 a, dx_f32 b, int method, dx_f32 epsilon) {
@@ -150,8 +143,68 @@ bool dx_almost_equal_f64(dx_f64 a, dx_f64 b, int method, dx_f64 epsilon) {
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+// The hash functions are based on wyhash (final version 4) by Wang Yi.
+// Every Byte of the input contributes to the hash value.
+// Inputs longer than 48 Bytes are processed in blocks of 48 Bytes by three independent lanes.
+
+/// @brief The secret of the hash functions.
+static uint64_t const g_hash_secret[4] = {
+  UINT64_C(0x2d358dccaa6c78a5),
+  UINT64_C(0x8bb84b93962eacc9),
+  UINT64_C(0x4b33a62ed433d4a3),
+  UINT64_C(0x4d5a2da51de1aa47),
+};
+
+/// @brief Compute the 128 bit product of two 64 bit values.
+/// @param a A pointer to the first value. Assigned the low word of the product.
+/// @param b A pointer to the second value. Assigned the high word of the product.
+static inline void _dx_hash_mum(uint64_t* a, uint64_t* b) {
+#if defined(_M_X64)
+  *a = _umul128(*a, *b, b);
+#else
+  uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+  uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  uint64_t t = rl + (rm0 << 32), c = t < rl;
+  uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+  *a = lo;
+  *b = hi;
+#endif
+}
+
+/// @brief Mix two 64 bit values.
+static inline uint64_t _dx_hash_mix(uint64_t a, uint64_t b) {
+  _dx_hash_mum(&a, &b);
+  return a ^ b;
+}
+
+static inline uint64_t _dx_hash_read_8(uint8_t const* p) {
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static inline uint64_t _dx_hash_read_4(uint8_t const* p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+/// @brief Read 1, 2, or 3 Bytes.
+static inline uint64_t _dx_hash_read_3(uint8_t const* p, dx_size n) {
+  return (((uint64_t)p[0]) << 16) | (((uint64_t)p[n >> 1]) << 8) | p[n - 1];
+}
+
+/// @brief Compute the hash value of a 64 bit value.
+static inline dx_size _dx_hash_u64(uint64_t x) {
+  uint64_t a = x ^ g_hash_secret[0], b = (x >> 32) ^ g_hash_secret[1];
+  _dx_hash_mum(&a, &b);
+  return (dx_size)_dx_hash_mix(a ^ g_hash_secret[0], b ^ g_hash_secret[1]);
+}
+
 dx_size dx_hash_pointer(void const* p) {
-  return (dx_size)(uintptr_t)p;
+  return _dx_hash_u64((uint64_t)(uintptr_t)p);
 }
 
 dx_size dx_hash_bool(dx_bool x) {
@@ -159,12 +212,45 @@ dx_size dx_hash_bool(dx_bool x) {
 }
 
 dx_size dx_hash_bytes(void const* p, dx_size n) {
-  dx_size h = n;
-  dx_size step = (n >> 5) + 1;
-  for (; n >= step; n -= step) {
-    h ^= (h << 5) + (h >> 2) + ((unsigned char)(((char const*)p)[n - 1]));
+  uint8_t const* q = (uint8_t const*)p;
+  uint64_t seed = _dx_hash_mix(g_hash_secret[0], g_hash_secret[1]);
+  uint64_t a, b;
+  if (n <= 16) {
+    if (n >= 4) {
+      a = (_dx_hash_read_4(q) << 32) | _dx_hash_read_4(q + ((n >> 3) << 2));
+      b = (_dx_hash_read_4(q + n - 4) << 32) | _dx_hash_read_4(q + n - 4 - ((n >> 3) << 2));
+    } else if (n > 0) {
+      a = _dx_hash_read_3(q, n);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    dx_size i = n;
+    if (i > 48) {
+      uint64_t seed1 = seed, seed2 = seed;
+      do {
+        seed = _dx_hash_mix(_dx_hash_read_8(q) ^ g_hash_secret[1], _dx_hash_read_8(q + 8) ^ seed);
+        seed1 = _dx_hash_mix(_dx_hash_read_8(q + 16) ^ g_hash_secret[2], _dx_hash_read_8(q + 24) ^ seed1);
+        seed2 = _dx_hash_mix(_dx_hash_read_8(q + 32) ^ g_hash_secret[3], _dx_hash_read_8(q + 40) ^ seed2);
+        q += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (i > 16) {
+      seed = _dx_hash_mix(_dx_hash_read_8(q) ^ g_hash_secret[1], _dx_hash_read_8(q + 8) ^ seed);
+      q += 16;
+      i -= 16;
+    }
+    // As n > 16, the last 16 Bytes are within the array.
+    a = _dx_hash_read_8(q + i - 16);
+    b = _dx_hash_read_8(q + i - 8);
   }
-  return h;
+  a ^= g_hash_secret[1];
+  b ^= seed;
+  _dx_hash_mum(&a, &b);
+  return (dx_size)_dx_hash_mix(a ^ g_hash_secret[0] ^ (uint64_t)n, b ^ g_hash_secret[1]);
 }
 
 dx_size dx_hash_f32(dx_f32 x) {
@@ -183,7 +269,9 @@ dx_size dx_hash_f32(dx_f32 x) {
     default: {
       // The default case handles the case when fpclassify may return an implementation defined type gracefully.
       if (x == 0.0f) x = +0.0f; // +0.0f == -0.0f. Hence, map both to +0.0f.
-      return dx_hash_bytes((void const *)&x, sizeof(dx_f32));
+      uint32_t y;
+      memcpy(&y, &x, sizeof(dx_f32));
+      return _dx_hash_u64(y);
     }
   };
 }
@@ -204,43 +292,231 @@ dx_size dx_hash_f64(dx_f64 x) {
     default: {
       // The default case handles the case when fpclassify may return an implementation defined type gracefully.
       if (x == 0.0) x = +0.0; // +0.0 == -0.0. Hence, map both to +0.0.
-      return dx_hash_bytes((void const *)&x, sizeof(dx_f64));
+      uint64_t y;
+      memcpy(&y, &x, sizeof(dx_f64));
+      return _dx_hash_u64(y);
     }
   };
 }
 
 dx_size dx_hash_i8(dx_i8 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_i8)); }
+{ return _dx_hash_u64((uint64_t)(int64_t)x); }
 
 dx_size dx_hash_i16(dx_i16 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_i16)); }
+{ return _dx_hash_u64((uint64_t)(int64_t)x); }
 
 dx_size dx_hash_i32(dx_i32 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_i32)); }
+{ return _dx_hash_u64((uint64_t)(int64_t)x); }
 
 dx_size dx_hash_i64(dx_i64 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_i64)); }
+{ return _dx_hash_u64((uint64_t)x); }
 
 dx_size dx_hash_n8(dx_n8 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_n8)); }
+{ return _dx_hash_u64(x); }
 
 dx_size dx_hash_n16(dx_n16 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_n16)); }
+{ return _dx_hash_u64(x); }
 
 dx_size dx_hash_n32(dx_n32 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_n32)); }
+{ return _dx_hash_u64(x); }
 
 dx_size dx_hash_n64(dx_n64 x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_n64)); }
+{ return _dx_hash_u64(x); }
 
 dx_size dx_hash_sz(dx_size x)
-{ return dx_hash_bytes((void const*)&x, sizeof(dx_size)); }
+{ return _dx_hash_u64(x); }
 
 dx_size dx_combine_hash(dx_size x, dx_size y) {
-  // This is just another black-magic formula used by boost and glib.
-  return  x + 0x9e3779b9 + (y << 6) + (y >> 2);
+  return (dx_size)_dx_hash_mix((uint64_t)x ^ g_hash_secret[0], (uint64_t)y ^ g_hash_secret[1]);
 }
 
+#if defined(DX_HASH_WITH_TESTS) && 1 == DX_HASH_WITH_TESTS
+
+// The number of keys of a key set.
+#define _DX_HASH_TESTS_NUMBER_OF_KEYS (4096)
+
+// The maximal length of a key.
+#define _DX_HASH_TESTS_KEY_CAPACITY (128)
+
+// The number of buckets the keys are distributed over.
+#define _DX_HASH_TESTS_NUMBER_OF_BUCKETS (8192)
+
+// The size, in Bytes, of the input of the throughput benchmark.
+#define _DX_HASH_TESTS_INPUT_SIZE (64 * 1024)
+
+// The hash function as it was implemented before every Byte contributed to the hash value:
+// Only every ((n >> 5) + 1)-th Byte is sampled.
+static dx_size _dx_hash_tests_hash_sampled(void const* p, dx_size n) {
+  dx_size h = n;
+  dx_size step = (n >> 5) + 1;
+  for (; n >= step; n -= step) {
+    h ^= (h << 5) + (h >> 2) + ((unsigned char)(((char const*)p)[n - 1]));
+  }
+  return h;
+}
+
+// The hash values are stored as pointers such that they can be sorted by dx_radix_sort_64.
+static uint64_t _dx_hash_tests_key(void* element) {
+  return (uint64_t)(uintptr_t)element;
+}
+
+// Write the prefix, the decimal digits of i padded with zeroes to the specified number of digits, and the suffix to a key.
+// Return the length of the key.
+static dx_size _dx_hash_tests_make_key(char* key, char const* prefix, dx_size i, dx_size number_of_digits, char const* suffix) {
+  dx_size n = strlen(prefix);
+  memcpy(key, prefix, n);
+  char digits[20];
+  dx_size m = 0;
+  do {
+    digits[m++] = '0' + (char)(i % 10);
+    i /= 10;
+  } while (i);
+  for (dx_size j = m; j < number_of_digits; ++j) {
+    key[n++] = '0';
+  }
+  while (m) {
+    key[n++] = digits[--m];
+  }
+  dx_size k = strlen(suffix);
+  memcpy(key + n, suffix, k);
+  return n + k;
+}
+
+typedef struct _dx_hash_tests_key_set {
+  char (*keys)[_DX_HASH_TESTS_KEY_CAPACITY];
+  dx_size lengths[_DX_HASH_TESTS_NUMBER_OF_KEYS];
+} _dx_hash_tests_key_set;
+
+// Count the keys with the hash value of a preceding key and the keys mapped to the bucket of a preceding key.
+static int _dx_hash_tests_count_collisions(_dx_hash_tests_key_set* key_set, dx_size (*hash)(void const*, dx_size),
+                                           void** hashes, dx_n8* buckets, dx_size* number_of_collisions, dx_size* number_of_bucket_collisions) {
+  memset(buckets, 0, _DX_HASH_TESTS_NUMBER_OF_BUCKETS);
+  *number_of_bucket_collisions = 0;
+  for (dx_size i = 0; i < _DX_HASH_TESTS_NUMBER_OF_KEYS; ++i) {
+    dx_size h = hash(key_set->keys[i], key_set->lengths[i]);
+    hashes[i] = (void*)(uintptr_t)h;
+    dx_size bucket = h % _DX_HASH_TESTS_NUMBER_OF_BUCKETS;
+    if (buckets[bucket]) {
+      (*number_of_bucket_collisions)++;
+    }
+    buckets[bucket] = 1;
+  }
+  if (dx_radix_sort_64(hashes, _DX_HASH_TESTS_NUMBER_OF_KEYS, &_dx_hash_tests_key)) {
+    return 1;
+  }
+  *number_of_collisions = 0;
+  for (dx_size i = 1; i < _DX_HASH_TESTS_NUMBER_OF_KEYS; ++i) {
+    if (hashes[i - 1] == hashes[i]) {
+      (*number_of_collisions)++;
+    }
+  }
+  return 0;
+}
+
+#if defined(DX_HASH_WITH_BENCHMARKS) && 1 == DX_HASH_WITH_BENCHMARKS
+
+static void _dx_hash_tests_log_collisions(char const* name, dx_size number_of_collisions, dx_size number_of_bucket_collisions) {
+  dx_log(name, strlen(name));
+  dx_log(": ", sizeof(": ") - 1);
+  dx_log_n64(number_of_collisions);
+  dx_log(" hash value collisions, ", sizeof(" hash value collisions, ") - 1);
+  dx_log_n64(number_of_bucket_collisions);
+  dx_log(" bucket collisions\n", sizeof(" bucket collisions\n") - 1);
+}
+
+#endif // DX_HASH_WITH_BENCHMARKS
+
+// The names of the reports of a key set.
+typedef struct _dx_hash_tests_names {
+  char const* sampled;
+  char const* hash;
+} _dx_hash_tests_names;
+
+// Measure the collisions of the hash function and of the sampling hash function on a key set.
+// The hash function must not produce collisions of hash values.
+static int _dx_hash_tests_key_set_run(_dx_hash_tests_key_set* key_set, _dx_hash_tests_names const* names, void** hashes, dx_n8* buckets) {
+  dx_size number_of_collisions, number_of_bucket_collisions;
+  if (_dx_hash_tests_count_collisions(key_set, &_dx_hash_tests_hash_sampled, hashes, buckets, &number_of_collisions, &number_of_bucket_collisions)) {
+    return 1;
+  }
+#if defined(DX_HASH_WITH_BENCHMARKS) && 1 == DX_HASH_WITH_BENCHMARKS
+  _dx_hash_tests_log_collisions(names->sampled, number_of_collisions, number_of_bucket_collisions);
+#endif
+  if (_dx_hash_tests_count_collisions(key_set, &dx_hash_bytes, hashes, buckets, &number_of_collisions, &number_of_bucket_collisions)) {
+    return 1;
+  }
+#if defined(DX_HASH_WITH_BENCHMARKS) && 1 == DX_HASH_WITH_BENCHMARKS
+  _dx_hash_tests_log_collisions(names->hash, number_of_collisions, number_of_bucket_collisions);
+#endif
+  if (number_of_collisions) {
+    return 1;
+  }
+#if defined(DX_HASH_WITH_BENCHMARKS) && 1 == DX_HASH_WITH_BENCHMARKS
+  dx_size volatile sink = 0;
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_HASH_TESTS_NUMBER_OF_KEYS; ++i) {
+    sink += dx_hash_bytes(key_set->keys[i], key_set->lengths[i]);
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  dx_log_benchmark(names->hash, time, _DX_HASH_TESTS_NUMBER_OF_KEYS);
+#endif
+  return 0;
+}
+
+static int _dx_hash_tests_run(_dx_hash_tests_key_set* key_set, void** hashes, dx_n8* buckets) {
+  // Names of assets in ADL files.
+  static _dx_hash_tests_names const names = { "names (sampling hash)", "names (dx_hash_bytes)" };
+  for (dx_size i = 0; i < _DX_HASH_TESTS_NUMBER_OF_KEYS; ++i) {
+    key_set->lengths[i] = _dx_hash_tests_make_key(key_set->keys[i], "meshInstance", i, 0, "");
+  }
+  if (_dx_hash_tests_key_set_run(key_set, &names, hashes, buckets)) {
+    return 1;
+  }
+  // Paths of files which differ in a directory in the middle of the path.
+  static _dx_hash_tests_names const paths = { "paths (sampling hash)", "paths (dx_hash_bytes)" };
+  for (dx_size i = 0; i < _DX_HASH_TESTS_NUMBER_OF_KEYS; ++i) {
+    key_set->lengths[i] = _dx_hash_tests_make_key(key_set->keys[i], "assets/scenes/mesh-viewer/", i, 4, "/textures/checkerboard-texture.adl");
+  }
+  if (_dx_hash_tests_key_set_run(key_set, &paths, hashes, buckets)) {
+    return 1;
+  }
+#if defined(DX_HASH_WITH_BENCHMARKS) && 1 == DX_HASH_WITH_BENCHMARKS
+  // Throughput for long inputs.
+  char* input = (char*)key_set->keys;
+  for (dx_size i = 0; i < _DX_HASH_TESTS_INPUT_SIZE; ++i) {
+    input[i] = (char)(i * 31);
+  }
+  dx_size volatile sink = 0;
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < 16; ++i) {
+    sink += dx_hash_bytes(input, _DX_HASH_TESTS_INPUT_SIZE);
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  dx_log_benchmark("dx_hash_bytes (64 KiB input, operations are Bytes)", time, 16 * _DX_HASH_TESTS_INPUT_SIZE);
+#endif
+  return 0;
+}
+
+int dx_hash_tests() {
+  _dx_hash_tests_key_set* key_set = dx_memory_allocate(sizeof(_dx_hash_tests_key_set));
+  void** hashes = dx_memory_allocate(sizeof(void*) * _DX_HASH_TESTS_NUMBER_OF_KEYS);
+  dx_n8* buckets = dx_memory_allocate(_DX_HASH_TESTS_NUMBER_OF_BUCKETS);
+  int result = 1;
+  if (key_set && hashes && buckets) {
+    key_set->keys = dx_memory_allocate(_DX_HASH_TESTS_NUMBER_OF_KEYS * _DX_HASH_TESTS_KEY_CAPACITY);
+    if (key_set->keys) {
+      result = _dx_hash_tests_run(key_set, hashes, buckets);
+      dx_memory_deallocate(key_set->keys);
+    }
+  }
+  dx_memory_deallocate(buckets);
+  dx_memory_deallocate(hashes);
+  dx_memory_deallocate(key_set);
+  return result;
+}
+
+#endif // DX_HASH_WITH_TESTS
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 dx_bool dx_fp32_is_subnormal(dx_f32 x) {
@@ -484,11 +484,45 @@ void dx_set_error(dx_error error);
   typedef int32_t dx_reference_counter;
 #endif
 
+#if 1 == DX_ATOMIC_REFERENCE_COUNTING_ENABLED
+  // The intrinsics used by dx_reference_counter_increment and dx_reference_counter_decrement.
+  // They are declared here such that <intrin.h> is not included by every translation unit.
+  #if defined(_WIN64)
+    __int64 _InterlockedIncrement64(__int64 volatile* addend);
+    __int64 _InterlockedDecrement64(__int64 volatile* addend);
+    #pragma intrinsic(_InterlockedIncrement64, _InterlockedDecrement64)
+  #else
+    long _InterlockedIncrement(long volatile* addend);
+    long _InterlockedDecrement(long volatile* addend);
+    #pragma intrinsic(_InterlockedIncrement, _InterlockedDecrement)
+  #endif
+#endif
+
 // @return The resulting incremented value.
-dx_reference_counter dx_reference_counter_increment(dx_reference_counter* reference_counter);
+static inline dx_reference_counter dx_reference_counter_increment(dx_reference_counter* reference_counter) {
+#if 1 == DX_ATOMIC_REFERENCE_COUNTING_ENABLED
+  #if defined(_WIN64)
+    return _InterlockedIncrement64(reference_counter);
+  #else
+    return _InterlockedIncrement((long volatile*)reference_counter);
+  #endif
+#else
+  return ++(*reference_counter);
+#endif
+}
 
 // @return The resulting decremented value.
-dx_reference_counter dx_reference_counter_decrement(dx_reference_counter* reference_counter);
+static inline dx_reference_counter dx_reference_counter_decrement(dx_reference_counter* reference_counter) {
+#if 1 == DX_ATOMIC_REFERENCE_COUNTING_ENABLED
+  #if defined(_WIN64)
+    return _InterlockedDecrement64(reference_counter);
+  #else
+    return _InterlockedDecrement((long volatile*)reference_counter);
+  #endif
+#else
+  return --(*reference_counter);
+#endif
+}
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -531,6 +565,13 @@ void dx_log_n8(dx_n8 value);
 /// @param p The pointer.
 void dx_log_p(void const* p);
 
+/// @brief Write the result of a benchmark to standard output.
+/// @warning There is no guarantee that the log message is written.
+/// @param name A pointer to the name of the benchmark, a zero-terminated utf-8 string.
+/// @param time The time, in nanoseconds, the benchmark took.
+/// @param number_of_operations The number of operations the benchmark performed.
+void dx_log_benchmark(char const* name, dx_n64 time, dx_size number_of_operations);
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /// @{
@@ -571,6 +612,7 @@ dx_size dx_hash_bool(dx_bool x);
 /// @param p A pointer to the array of Bytes.
 /// @param n The length of the array.
 /// @return The hash value.
+/// @remarks Every Byte of the array contributes to the hash value.
 dx_size dx_hash_bytes(void const* p, dx_size n);
 
 /// @ingroup core
@@ -646,6 +688,10 @@ dx_size dx_hash_sz(dx_size x);
 /// @return The combination of the first hash value and the second hash value.
 dx_size dx_combine_hash(dx_size x, dx_size y);
 
+#if defined(DX_HASH_WITH_TESTS) && 1 == DX_HASH_WITH_TESTS
+int dx_hash_tests();
+#endif
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /// @{
@@ -78,7 +78,7 @@ typedef enum DX_NON_EXISTING_FILE_POLICY {
 /// @success
 /// <code>*number_of_bytes</code> was assigned the length, in Bytes, of the contents.
 /// <code>*bytes</code> was assigned a pointer to an array of that length.
-/// That array must be deallocated using free() when no long required.
+/// That array must be deallocated using dx_memory_deallocate() when no long required.
 /// @failure
 /// The error variable was set.
 int dx_get_file_contents(char const *path, char **bytes, dx_size*number_of_bytes);
@@ -3,9 +3,25 @@
 // malloc, realloc, free
 #include <malloc.h>
 
-// memmove, memcpy, memset
+// memmove, memcpy, memset, strlen
 #include <string.h>
 
+// qsort
+#include <stdlib.h>
+
+// vsnprintf
+#include <stdio.h>
+
+// va_list, va_start, va_end
+#include <stdarg.h>
+
+// SRWLOCK, InterlockedExchangeAdd64, InterlockedCompareExchange64
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+// _ReturnAddress
+#include <intrin.h>
+
 int dx_memory_copy(void* p, void const* q, dx_size n) {
   if (!p || !q) {
     dx_set_error(DX_INVALID_ARGUMENT);
@@ -33,40 +49,1116 @@ int dx_memory_zero(void* p, dx_size n) {
   return 0;
 }
 
-void* dx_memory_allocate(dx_size n) {
-  void* p = malloc(n > 0 ? n : 1);
-  if (!p) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+// Each block is preceeded by a header storing the size class of the block and the number of Bytes requested.
+// The header is HEADER_SIZE Bytes wide such that the alignment provided by the system heap is preserved.
+typedef struct _dx_memory_block_header _dx_memory_block_header;
+
+// The number of bits of the number of Bytes requested for a block.
+// The remaining bit of the dx_size value stores if the block is marked as a pooled block.
+#define NUMBER_OF_BYTES_BITS (sizeof(dx_size) * 8 - 1)
+
+// The greatest number of Bytes which can be requested for a block.
+#define GREATEST_NUMBER_OF_BYTES (DX_SIZE_GREATEST / 2 - HEADER_SIZE)
+
+struct _dx_memory_block_header {
+  /// @brief The number of Bytes requested for this block.
+  dx_size number_of_bytes : NUMBER_OF_BYTES_BITS;
+  /// @brief @a 1 if this block was marked by dx_memory_mark_pooled_block, @a 0 otherwise.
+  dx_size is_pooled : 1;
+  /// @brief The index of the size class of this block if this block was allocated from a slab,
+  /// LARGE_SIZE_CLASS if this block was allocated from the system heap,
+  /// or the address of the dx_memory_arena object if this block was allocated from an arena.
+  dx_size size_class;
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  /// @brief A pointer to the call site which allocated this block.
+  struct _dx_memory_profiler_site* site;
+  /// @brief The previous block in the list of live blocks.
+  _dx_memory_block_header* previous;
+  /// @brief The next block in the list of live blocks.
+  _dx_memory_block_header* next;
+  /// @brief A non-zero value if this block is a dx_object object.
+  dx_size is_object;
+#endif
+};
+
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  #define HEADER_SIZE (48)
+#else
+  #define HEADER_SIZE (16)
+#endif
+
+static_assert(sizeof(_dx_memory_block_header) <= HEADER_SIZE, "header does not fit");
+
+#define LARGE_SIZE_CLASS (DX_SIZE_GREATEST)
+
+// Indices of size classes are below this value.
+// Addresses of dx_memory_arena objects are never below this value.
+#define SIZE_CLASS_LIMIT (256)
+
+static inline bool _dx_memory_is_arena_block(_dx_memory_block_header* header) {
+  return header->size_class >= SIZE_CLASS_LIMIT && header->size_class != LARGE_SIZE_CLASS;
+}
+
+static inline _dx_memory_block_header* _dx_memory_get_header(void* p) {
+  return (_dx_memory_block_header*)(((char*)p) - HEADER_SIZE);
+}
+
+static inline void* _dx_memory_get_block(_dx_memory_block_header* header) {
+  return (void*)(((char*)header) + HEADER_SIZE);
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+// The global statistics.
+// Updated using interlocked operations as blocks may be allocated and deallocated by different threads.
+#if defined(_WIN64)
+  typedef LONG64 _dx_memory_counter;
+  #define _DX_MEMORY_COUNTER_ADD(TARGET, VALUE) InterlockedExchangeAdd64(&(TARGET), (LONG64)(VALUE))
+  #define _DX_MEMORY_COUNTER_COMPARE_EXCHANGE(TARGET, EXCHANGE, COMPARAND) InterlockedCompareExchange64(&(TARGET), (LONG64)(EXCHANGE), (LONG64)(COMPARAND))
+#else
+  typedef LONG _dx_memory_counter;
+  #define _DX_MEMORY_COUNTER_ADD(TARGET, VALUE) InterlockedExchangeAdd(&(TARGET), (LONG)(VALUE))
+  #define _DX_MEMORY_COUNTER_COMPARE_EXCHANGE(TARGET, EXCHANGE, COMPARAND) InterlockedCompareExchange(&(TARGET), (LONG)(EXCHANGE), (LONG)(COMPARAND))
+#endif
+
+static struct {
+  _dx_memory_counter volatile number_of_blocks;
+  _dx_memory_counter volatile number_of_bytes;
+  _dx_memory_counter volatile smallest_block;
+  _dx_memory_counter volatile greatest_block;
+} g_statistics = { 0, 0, (_dx_memory_counter)-1, 0 };
+
+static inline void _dx_memory_on_block_allocated(dx_size n) {
+  _DX_MEMORY_COUNTER_ADD(g_statistics.number_of_blocks, 1);
+  _DX_MEMORY_COUNTER_ADD(g_statistics.number_of_bytes, n);
+  // The smallest and the greatest block are only updated if they change which is rarely the case.
+  _dx_memory_counter old;
+  while ((dx_size)(old = g_statistics.smallest_block) > n) {
+    if (old == _DX_MEMORY_COUNTER_COMPARE_EXCHANGE(g_statistics.smallest_block, n, old)) {
+      break;
+    }
+  }
+  while ((dx_size)(old = g_statistics.greatest_block) < n) {
+    if (old == _DX_MEMORY_COUNTER_COMPARE_EXCHANGE(g_statistics.greatest_block, n, old)) {
+      break;
+    }
+  }
+}
+
+static inline void _dx_memory_on_block_deallocated(dx_size n) {
+  _DX_MEMORY_COUNTER_ADD(g_statistics.number_of_blocks, -1);
+  _DX_MEMORY_COUNTER_ADD(g_statistics.number_of_bytes, -(_dx_memory_counter)n);
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#if defined(DX_MEMORY_SLAB_ALLOCATOR_ENABLED) && 1 == DX_MEMORY_SLAB_ALLOCATOR_ENABLED
+
+// The size classes.
+// Multiples of 16 up to 128 Bytes, multiples of 64 Bytes up to 512 Bytes.
+// Blocks greater than 512 Bytes are allocated from the system heap.
+#define NUMBER_OF_SIZE_CLASSES (14)
+
+#define GREATEST_SIZE_CLASS_SIZE (512)
+
+static dx_size const g_size_class_sizes[NUMBER_OF_SIZE_CLASSES] = {
+  16, 32, 48, 64, 80, 96, 112, 128,
+  192, 256, 320, 384, 448, 512,
+};
+
+// Maps <code>(n + 15) / 16</code> to the index of the smallest size class of a size greater than or equal to <code>n</code>.
+static dx_n8 const g_size_class_indices[(GREATEST_SIZE_CLASS_SIZE + 15) / 16 + 1] = {
+  0,                            //   0
+  0, 1, 2, 3, 4, 5, 6, 7,       //  16 - 128
+  8, 8, 8, 8,                   // 144 - 192
+  9, 9, 9, 9,                   // 208 - 256
+  10, 10, 10, 10,               // 272 - 320
+  11, 11, 11, 11,               // 336 - 384
+  12, 12, 12, 12,               // 400 - 448
+  13, 13, 13, 13,               // 464 - 512
+};
+
+// The size, in Bytes, of a slab.
+#define SLAB_SIZE (64 * 1024)
+
+// The maximal number of blocks a magazine holds before it returns blocks to the depot.
+#define MAGAZINE_CAPACITY (128)
+
+// The number of blocks moved between a magazine and the depot.
+#define MAGAZINE_BATCH_SIZE (MAGAZINE_CAPACITY / 2)
+
+typedef struct _dx_memory_free_block _dx_memory_free_block;
+
+struct _dx_memory_free_block {
+  _dx_memory_free_block* next;
+};
+
+// A per-thread cache of free blocks of a size class.
+typedef struct _dx_memory_magazine {
+  _dx_memory_free_block* head;
+  dx_size size;
+} _dx_memory_magazine;
+
+// A global cache of free blocks of a size class.
+// Magazines are refilled from and drained into the depot.
+typedef struct _dx_memory_depot {
+  SRWLOCK lock;
+  _dx_memory_free_block* head;
+  dx_size size;
+} _dx_memory_depot;
+
+static DX_THREAD_LOCAL() _dx_memory_magazine g_magazines[NUMBER_OF_SIZE_CLASSES];
+
+static _dx_memory_depot g_depots[NUMBER_OF_SIZE_CLASSES] = {
+  { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 },
+  { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 },
+  { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 },
+  { SRWLOCK_INIT, NULL, 0 }, { SRWLOCK_INIT, NULL, 0 },
+};
+
+// Move up to MAGAZINE_BATCH_SIZE blocks from the depot to the magazine.
+// If the depot is empty, allocate a new slab and carve it into blocks.
+static int _dx_memory_magazine_refill(_dx_memory_magazine* magazine, dx_size size_class) {
+  _dx_memory_depot* depot = &g_depots[size_class];
+  AcquireSRWLockExclusive(&depot->lock);
+  while (depot->head && magazine->size < MAGAZINE_BATCH_SIZE) {
+    _dx_memory_free_block* block = depot->head;
+    depot->head = block->next;
+    depot->size--;
+    block->next = magazine->head;
+    magazine->head = block;
+    magazine->size++;
+  }
+  ReleaseSRWLockExclusive(&depot->lock);
+  if (magazine->head) {
+    return 0;
+  }
+  // Slabs are never returned to the system heap.
+  char* slab = malloc(SLAB_SIZE);
+  if (!slab) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return 1;
+  }
+  dx_size stride = HEADER_SIZE + g_size_class_sizes[size_class];
+  dx_size number_of_blocks = SLAB_SIZE / stride;
+  for (dx_size i = number_of_blocks; i > 0; --i) {
+    _dx_memory_free_block* block = (_dx_memory_free_block*)(slab + (i - 1) * stride);
+    block->next = magazine->head;
+    magazine->head = block;
+  }
+  magazine->size += number_of_blocks;
+  return 0;
+}
+
+// Move MAGAZINE_BATCH_SIZE blocks from the magazine to the depot.
+static void _dx_memory_magazine_drain(_dx_memory_magazine* magazine, dx_size size_class, dx_size number_of_blocks) {
+  _dx_memory_depot* depot = &g_depots[size_class];
+  if (!number_of_blocks) {
+    return;
+  }
+  _dx_memory_free_block* first = magazine->head, * last = magazine->head;
+  for (dx_size i = 1; i < number_of_blocks; ++i) {
+    last = last->next;
+  }
+  magazine->head = last->next;
+  magazine->size -= number_of_blocks;
+  AcquireSRWLockExclusive(&depot->lock);
+  last->next = depot->head;
+  depot->head = first;
+  depot->size += number_of_blocks;
+  ReleaseSRWLockExclusive(&depot->lock);
+}
+
+static inline void* _dx_memory_allocate_small(dx_size n) {
+  dx_size size_class = g_size_class_indices[(n + 15) / 16];
+  _dx_memory_magazine* magazine = &g_magazines[size_class];
+  if (DX_UNLIKELY(!magazine->head)) {
+    if (_dx_memory_magazine_refill(magazine, size_class)) {
+      return NULL;
+    }
+  }
+  _dx_memory_free_block* block = magazine->head;
+  magazine->head = block->next;
+  magazine->size--;
+  _dx_memory_block_header* header = (_dx_memory_block_header*)block;
+  header->size_class = size_class;
+  header->number_of_bytes = n;
+  header->is_pooled = 0;
+  return _dx_memory_get_block(header);
+}
+
+static inline void _dx_memory_deallocate_small(_dx_memory_block_header* header) {
+  dx_size size_class = header->size_class;
+  _dx_memory_magazine* magazine = &g_magazines[size_class];
+  _dx_memory_free_block* block = (_dx_memory_free_block*)header;
+  block->next = magazine->head;
+  magazine->head = block;
+  magazine->size++;
+  if (DX_UNLIKELY(magazine->size > MAGAZINE_CAPACITY)) {
+    _dx_memory_magazine_drain(magazine, size_class, MAGAZINE_BATCH_SIZE);
+  }
+}
+
+void dx_memory_release_thread_cache() {
+  for (dx_size i = 0; i < NUMBER_OF_SIZE_CLASSES; ++i) {
+    _dx_memory_magazine_drain(&g_magazines[i], i, g_magazines[i].size);
+  }
+}
+
+#else
+
+void dx_memory_release_thread_cache()
+{/*Intentionally empty.*/}
+
+#endif // DX_MEMORY_SLAB_ALLOCATOR_ENABLED
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+// The size, in Bytes, of an arena chunk.
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+// The size, in Bytes, of the header of an arena chunk.
+#define ARENA_CHUNK_HEADER_SIZE (16)
+
+// Blocks greater than this are allocated from the system heap even if an arena is current.
+#define ARENA_GREATEST_BLOCK_SIZE (4 * 1024)
+
+typedef struct _dx_memory_arena_chunk _dx_memory_arena_chunk;
+
+struct _dx_memory_arena_chunk {
+  _dx_memory_arena_chunk* next;
+};
+
+struct dx_memory_arena {
+  /// @brief The singly-linked list of chunks of this arena.
+  _dx_memory_arena_chunk* chunks;
+  /// @brief Pointer to the first free Byte in the current chunk.
+  char* top;
+  /// @brief Pointer to the end of the current chunk.
+  char* end;
+  /// @brief The number of blocks allocated from this arena plus one if this arena was not yet destroyed.
+  _dx_memory_counter volatile reference_count;
+};
+
+static DX_THREAD_LOCAL() dx_memory_arena* g_current_arena = NULL;
+
+static void _dx_memory_arena_unreference(dx_memory_arena* arena) {
+  if (0 == _DX_MEMORY_COUNTER_ADD(arena->reference_count, -1) - 1) {
+    while (arena->chunks) {
+      _dx_memory_arena_chunk* chunk = arena->chunks;
+      arena->chunks = chunk->next;
+      free(chunk);
+    }
+    free(arena);
+  }
+}
+
+static inline void* _dx_memory_allocate_arena(dx_memory_arena* arena, dx_size n) {
+  // Blocks are rounded up to multiples of 16 Bytes to preserve alignment.
+  dx_size stride = HEADER_SIZE + ((n + 15) & ~(dx_size)15);
+  if (DX_UNLIKELY((dx_size)(arena->end - arena->top) < stride)) {
+    _dx_memory_arena_chunk* chunk = malloc(ARENA_CHUNK_SIZE);
+    if (!chunk) {
+      dx_set_error(DX_ALLOCATION_FAILED);
+      return NULL;
+    }
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    arena->top = ((char*)chunk) + ARENA_CHUNK_HEADER_SIZE;
+    arena->end = ((char*)chunk) + ARENA_CHUNK_SIZE;
+  }
+  _dx_memory_block_header* header = (_dx_memory_block_header*)arena->top;
+  arena->top += stride;
+  _DX_MEMORY_COUNTER_ADD(arena->reference_count, 1);
+  header->size_class = (dx_size)arena;
+  header->number_of_bytes = n;
+  header->is_pooled = 0;
+  return _dx_memory_get_block(header);
+}
+
+static inline void _dx_memory_deallocate_arena(_dx_memory_block_header* header) {
+  // The memory of the block is reclaimed when the arena is released.
+  _dx_memory_arena_unreference((dx_memory_arena*)header->size_class);
+}
+
+dx_memory_arena* dx_memory_arena_create() {
+  dx_memory_arena* arena = malloc(sizeof(dx_memory_arena));
+  if (!arena) {
     dx_set_error(DX_ALLOCATION_FAILED);
     return NULL;
   }
+  arena->chunks = NULL;
+  arena->top = NULL;
+  arena->end = NULL;
+  arena->reference_count = 1;
+  return arena;
+}
+
+void dx_memory_arena_destroy(dx_memory_arena* arena) {
+  DX_DEBUG_ASSERT(NULL != arena);
+  DX_DEBUG_ASSERT(g_current_arena != arena);
+  _dx_memory_arena_unreference(arena);
+}
+
+dx_memory_arena* dx_memory_set_current_arena(dx_memory_arena* arena) {
+  dx_memory_arena* previous = g_current_arena;
+  g_current_arena = arena;
+  return previous;
+}
+
+dx_bool dx_memory_is_arena_block(void* p) {
+  DX_DEBUG_ASSERT(NULL != p);
+  return _dx_memory_is_arena_block(_dx_memory_get_header(p));
+}
+
+void dx_memory_mark_pooled_block(void* p) {
+  DX_DEBUG_ASSERT(NULL != p);
+  _dx_memory_get_header(p)->is_pooled = 1;
+}
+
+dx_bool dx_memory_is_pooled_block(void* p) {
+  DX_DEBUG_ASSERT(NULL != p);
+  return 1 == _dx_memory_get_header(p)->is_pooled;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+static inline void* _dx_memory_allocate_large(dx_size n) {
+  if (DX_UNLIKELY(n > GREATEST_NUMBER_OF_BYTES)) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return NULL;
+  }
+  _dx_memory_block_header* header = malloc(HEADER_SIZE + n);
+  if (!header) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return NULL;
+  }
+  header->size_class = LARGE_SIZE_CLASS;
+  header->number_of_bytes = n;
+  header->is_pooled = 0;
+  return _dx_memory_get_block(header);
+}
+
+static inline void _dx_memory_deallocate(void* p);
+
+static inline void* _dx_memory_allocate(dx_size n) {
+  void* p;
+  if (g_current_arena && n <= ARENA_GREATEST_BLOCK_SIZE) {
+    p = _dx_memory_allocate_arena(g_current_arena, n);
+  }
+#if defined(DX_MEMORY_SLAB_ALLOCATOR_ENABLED) && 1 == DX_MEMORY_SLAB_ALLOCATOR_ENABLED
+  else if (n <= GREATEST_SIZE_CLASS_SIZE) {
+    p = _dx_memory_allocate_small(n);
+  } else {
+    p = _dx_memory_allocate_large(n);
+  }
+#else
+  else {
+    p = _dx_memory_allocate_large(n);
+  }
+#endif
+  if (!p) {
+    return NULL;
+  }
+  _dx_memory_on_block_allocated(n);
   return p;
 }
 
-void* dx_memory_reallocate(void* p, dx_size n) {
+static inline void* _dx_memory_reallocate(void* p, dx_size n) {
   if (!p) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return NULL;
   }
-  void *q = realloc(p, n > 0 ? n : 1);
+  _dx_memory_block_header* old_header = _dx_memory_get_header(p);
+  dx_size old_n = old_header->number_of_bytes;
+  if (old_header->size_class == LARGE_SIZE_CLASS) {
+#if defined(DX_MEMORY_SLAB_ALLOCATOR_ENABLED) && 1 == DX_MEMORY_SLAB_ALLOCATOR_ENABLED
+    if (n > GREATEST_SIZE_CLASS_SIZE)
+#endif
+    {
+      if (DX_UNLIKELY(n > GREATEST_NUMBER_OF_BYTES)) {
+        dx_set_error(DX_ALLOCATION_FAILED);
+        return NULL;
+      }
+      _dx_memory_block_header* new_header = realloc(old_header, HEADER_SIZE + n);
+      if (!new_header) {
+        dx_set_error(DX_ALLOCATION_FAILED);
+        return NULL;
+      }
+      new_header->number_of_bytes = n;
+      new_header->is_pooled = 0;
+      _dx_memory_on_block_deallocated(old_n);
+      _dx_memory_on_block_allocated(n);
+      return _dx_memory_get_block(new_header);
+    }
+  }
+#if defined(DX_MEMORY_SLAB_ALLOCATOR_ENABLED) && 1 == DX_MEMORY_SLAB_ALLOCATOR_ENABLED
+  else if (n <= GREATEST_SIZE_CLASS_SIZE && g_size_class_indices[(n + 15) / 16] == old_header->size_class) {
+    // The new size falls into the same size class.
+    old_header->number_of_bytes = n;
+    old_header->is_pooled = 0;
+    _dx_memory_on_block_deallocated(old_n);
+    _dx_memory_on_block_allocated(n);
+    return p;
+  }
+#endif
+  else if (_dx_memory_is_arena_block(old_header) && n <= ((old_n + 15) & ~(dx_size)15)) {
+    // The new size fits into the block.
+    old_header->number_of_bytes = n;
+    old_header->is_pooled = 0;
+    _dx_memory_on_block_deallocated(old_n);
+    _dx_memory_on_block_allocated(n);
+    return p;
+  }
+  void* q = _dx_memory_allocate(n);
   if (!q) {
-    dx_set_error(DX_ALLOCATION_FAILED);
-    return  NULL;
+    return NULL;
+  }
+  memcpy(q, p, old_n < n ? old_n : n);
+  _dx_memory_deallocate(p);
+  return q;
+}
+
+static inline void _dx_memory_deallocate(void* p) {
+  if (p) {
+    _dx_memory_block_header* header = _dx_memory_get_header(p);
+    _dx_memory_on_block_deallocated(header->number_of_bytes);
+#if defined(DX_MEMORY_SLAB_ALLOCATOR_ENABLED) && 1 == DX_MEMORY_SLAB_ALLOCATOR_ENABLED
+    if (header->size_class < SIZE_CLASS_LIMIT) {
+      _dx_memory_deallocate_small(header);
+      return;
+    }
+#endif
+    if (header->size_class != LARGE_SIZE_CLASS) {
+      _dx_memory_deallocate_arena(header);
+      return;
+    }
+    free(header);
+  }
+}
+
+#if defined(DX_MEMORY_FRAME_BUDGET_ENABLED) && 1 == DX_MEMORY_FRAME_BUDGET_ENABLED
+
+// The maximal number of call sites recorded per frame.
+#define FRAME_SITES_CAPACITY (16)
+
+typedef struct _dx_memory_frame_site {
+  char const* file;
+  int line;
+  void const* return_address;
+  dx_size count;
+} _dx_memory_frame_site;
+
+typedef struct _dx_memory_frame {
+  /// @brief Are we inside a frame?
+  dx_bool started;
+  /// @brief The number of allocations in the current frame.
+  dx_size count;
+  /// @brief The call sites of the allocations in the current frame.
+  /// Recording call sites must not allocate, hence only the first FRAME_SITES_CAPACITY call sites are recorded.
+  _dx_memory_frame_site sites[FRAME_SITES_CAPACITY];
+  dx_size number_of_sites;
+} _dx_memory_frame;
+
+static DX_THREAD_LOCAL() _dx_memory_frame g_frame = { .started = false };
+
+static dx_size g_frame_budget = 0;
+
+static dx_bool g_frame_budget_abort = false;
+
+static void _dx_memory_on_frame_allocation(char const* file, int line, void const* return_address) {
+  if (!g_frame.started) {
+    return;
+  }
+  g_frame.count++;
+  for (dx_size i = 0; i < g_frame.number_of_sites; ++i) {
+    _dx_memory_frame_site* site = &g_frame.sites[i];
+    if (site->file == file && site->line == line && (file || site->return_address == return_address)) {
+      site->count++;
+      return;
+    }
+  }
+  if (g_frame.number_of_sites < FRAME_SITES_CAPACITY) {
+    _dx_memory_frame_site* site = &g_frame.sites[g_frame.number_of_sites++];
+    site->file = file;
+    site->line = line;
+    site->return_address = return_address;
+    site->count = 1;
+  }
+}
+
+void dx_memory_set_frame_budget(dx_size number_of_allocations, dx_bool abort) {
+  g_frame_budget = number_of_allocations;
+  g_frame_budget_abort = abort;
+}
+
+void dx_memory_enter_frame() {
+  g_frame.started = true;
+  g_frame.count = 0;
+  g_frame.number_of_sites = 0;
+}
+
+int dx_memory_leave_frame() {
+  if (!g_frame.started) {
+    dx_set_error(DX_INVALID_OPERATION);
+    return 1;
+  }
+  g_frame.started = false;
+  if (g_frame.count <= g_frame_budget) {
+    return 0;
+  }
+  dx_log("frame allocation budget exceeded: ", sizeof("frame allocation budget exceeded: ") - 1);
+  dx_log_n64(g_frame.count);
+  dx_log(" allocations, budget ", sizeof(" allocations, budget ") - 1);
+  dx_log_n64(g_frame_budget);
+  dx_log("\n", sizeof("\n") - 1);
+  for (dx_size i = 0; i < g_frame.number_of_sites; ++i) {
+    _dx_memory_frame_site* site = &g_frame.sites[i];
+    dx_log("  ", sizeof("  ") - 1);
+    if (site->file) {
+      dx_log(site->file, strlen(site->file));
+      dx_log(":", sizeof(":") - 1);
+      dx_log_i32(site->line);
+    } else {
+      dx_log_p(site->return_address);
+    }
+    dx_log(" ", sizeof(" ") - 1);
+    dx_log_n64(site->count);
+    dx_log("\n", sizeof("\n") - 1);
+  }
+  if (g_frame.number_of_sites == FRAME_SITES_CAPACITY) {
+    dx_log("  ...\n", sizeof("  ...\n") - 1);
   }
+  if (g_frame_budget_abort) {
+    abort();
+  }
+  // Exceeding the budget is reported but is not an error.
+  return 0;
+}
+
+#define _DX_MEMORY_ON_FRAME_ALLOCATION(file, line) _dx_memory_on_frame_allocation(file, line, _ReturnAddress())
+
+#else
+
+void dx_memory_set_frame_budget(dx_size number_of_allocations, dx_bool abort)
+{/*Intentionally empty.*/}
+
+void dx_memory_enter_frame()
+{/*Intentionally empty.*/}
+
+int dx_memory_leave_frame() {
+  return 0;
+}
+
+#define _DX_MEMORY_ON_FRAME_ALLOCATION(file, line)
+
+#endif // DX_MEMORY_FRAME_BUDGET_ENABLED
+
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+
+static void _dx_memory_profiler_on_block_allocated(_dx_memory_block_header* header, char const* file, int line);
+
+static void _dx_memory_profiler_on_block_deallocated(_dx_memory_block_header* header);
+
+void* dx_memory_allocate_at(dx_size n, char const* file, int line) {
+  _DX_MEMORY_ON_FRAME_ALLOCATION(file, line);
+  void* p = _dx_memory_allocate(n);
+  if (!p) {
+    return NULL;
+  }
+  _dx_memory_profiler_on_block_allocated(_dx_memory_get_header(p), file, line);
+  return p;
+}
+
+void* dx_memory_reallocate_at(void* p, dx_size n, char const* file, int line) {
+  if (!p) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return NULL;
+  }
+  // The block is always moved such that the new block is attributed to the call site.
+  void* q = dx_memory_allocate_at(n, file, line);
+  if (!q) {
+    return NULL;
+  }
+  dx_size old_n = _dx_memory_get_header(p)->number_of_bytes;
+  memcpy(q, p, old_n < n ? old_n : n);
+  (dx_memory_deallocate)(p);
   return q;
 }
 
-void dx_memory_deallocate(void* p) {
+void* (dx_memory_allocate)(dx_size n) {
+  return dx_memory_allocate_at(n, NULL, 0);
+}
+
+void* (dx_memory_reallocate)(void* p, dx_size n) {
+  return dx_memory_reallocate_at(p, n, NULL, 0);
+}
+
+void (dx_memory_deallocate)(void* p) {
   if (p) {
-    free(p);
+    _dx_memory_profiler_on_block_deallocated(_dx_memory_get_header(p));
+    _dx_memory_deallocate(p);
+  }
+}
+
+#else
+
+void* (dx_memory_allocate)(dx_size n) {
+  _DX_MEMORY_ON_FRAME_ALLOCATION(NULL, 0);
+  return _dx_memory_allocate(n);
+}
+
+void* (dx_memory_reallocate)(void* p, dx_size n) {
+  _DX_MEMORY_ON_FRAME_ALLOCATION(NULL, 0);
+  return _dx_memory_reallocate(p, n);
+}
+
+void (dx_memory_deallocate)(void* p) {
+  _dx_memory_deallocate(p);
+}
+
+#endif // DX_MEMORY_PROFILER_ENABLED
+
+char* dx_memory_duplicate_string(char const* p) {
+  if (!p) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return NULL;
+  }
+  dx_size n = strlen(p) + 1;
+  char* q = dx_memory_allocate(n);
+  if (!q) {
+    return NULL;
+  }
+  memcpy(q, p, n);
+  return q;
+}
+
+int dx_memory_get_statistics(dx_allocator_statistics* statistics) {
+  if (!statistics) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx_size number_of_blocks = (dx_size)g_statistics.number_of_blocks;
+  dx_size number_of_bytes = (dx_size)g_statistics.number_of_bytes;
+  statistics->number_of_blocks = number_of_blocks;
+  statistics->number_of_kilo_bytes = number_of_bytes / 1000;
+  statistics->number_of_bytes = number_of_bytes % 1000;
+  if (number_of_blocks) {
+    statistics->smallest_block = (dx_size)g_statistics.smallest_block;
+    statistics->greatest_block = (dx_size)g_statistics.greatest_block;
+  } else {
+    statistics->smallest_block = 0;
+    statistics->greatest_block = 0;
+  }
+  return 0;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+
+// The data structures of the profiler are allocated from the system heap such that they are not profiled.
+
+typedef struct _dx_memory_profiler_site _dx_memory_profiler_site;
+
+struct _dx_memory_profiler_site {
+  /// @brief The file name of the call site or the null pointer if the call site is unknown.
+  char const* file;
+  /// @brief The line of the call site or @a 0 if the call site is unknown.
+  int line;
+  /// @brief The number of blocks allocated since the last reset.
+  dx_size count;
+  /// @brief The number of Bytes allocated since the last reset.
+  dx_size bytes;
+  /// @brief The number of live blocks.
+  dx_size live;
+  /// @brief The number of Bytes in live blocks.
+  dx_size live_bytes;
+  /// @brief The greatest number of Bytes in live blocks since the last reset.
+  dx_size peak_live_bytes;
+};
+
+typedef struct _dx_memory_profiler_type _dx_memory_profiler_type;
+
+struct _dx_memory_profiler_type {
+  dx_size hash_value;
+  char* name;
+  dx_size name_length;
+  /// @brief The number of objects destroyed since the last reset.
+  dx_size count;
+  /// @brief The number of Bytes of objects destroyed since the last reset.
+  dx_size bytes;
+  /// @brief The number of live objects. Only valid during a report.
+  dx_size live;
+  /// @brief The number of Bytes in live objects. Only valid during a report.
+  dx_size live_bytes;
+};
+
+// Open addressing hash table of call sites.
+static struct {
+  _dx_memory_profiler_site** elements;
+  dx_size size;
+  dx_size capacity;
+} g_sites = { NULL, 0, 0 };
+
+// Open addressing hash table of types.
+static struct {
+  _dx_memory_profiler_type** elements;
+  dx_size size;
+  dx_size capacity;
+} g_types = { NULL, 0, 0 };
+
+// The list of live blocks.
+static _dx_memory_block_header* g_live_blocks = NULL;
+
+static void (*g_type_name_callback)(void* p, char const** type_name, dx_size* type_name_length) = NULL;
+
+static SRWLOCK g_profiler_lock = SRWLOCK_INIT;
+
+static inline dx_size _dx_memory_profiler_hash_site(char const* file, int line) {
+  return ((dx_size)file >> 4) ^ ((dx_size)line * 2654435761u);
+}
+
+// Get or create the site.
+// Returns the null pointer if the site does not exist and can not be created.
+static _dx_memory_profiler_site* _dx_memory_profiler_get_site(char const* file, int line) {
+  if (g_sites.size * 2 >= g_sites.capacity) {
+    dx_size new_capacity = g_sites.capacity ? g_sites.capacity * 2 : 1024;
+    _dx_memory_profiler_site** new_elements = calloc(new_capacity, sizeof(_dx_memory_profiler_site*));
+    if (!new_elements) {
+      return NULL;
+    }
+    for (dx_size i = 0; i < g_sites.capacity; ++i) {
+      _dx_memory_profiler_site* site = g_sites.elements[i];
+      if (site) {
+        dx_size j = _dx_memory_profiler_hash_site(site->file, site->line) & (new_capacity - 1);
+        while (new_elements[j]) {
+          j = (j + 1) & (new_capacity - 1);
+        }
+        new_elements[j] = site;
+      }
+    }
+    free(g_sites.elements);
+    g_sites.elements = new_elements;
+    g_sites.capacity = new_capacity;
+  }
+  dx_size i = _dx_memory_profiler_hash_site(file, line) & (g_sites.capacity - 1);
+  while (g_sites.elements[i]) {
+    _dx_memory_profiler_site* site = g_sites.elements[i];
+    if (site->file == file && site->line == line) {
+      return site;
+    }
+    i = (i + 1) & (g_sites.capacity - 1);
+  }
+  _dx_memory_profiler_site* site = calloc(1, sizeof(_dx_memory_profiler_site));
+  if (!site) {
+    return NULL;
+  }
+  site->file = file;
+  site->line = line;
+  g_sites.elements[i] = site;
+  g_sites.size++;
+  return site;
+}
+
+// Get or create the type.
+// Returns the null pointer if the type does not exist and can not be created.
+static _dx_memory_profiler_type* _dx_memory_profiler_get_type(char const* name, dx_size name_length) {
+  if (g_types.size * 2 >= g_types.capacity) {
+    dx_size new_capacity = g_types.capacity ? g_types.capacity * 2 : 256;
+    _dx_memory_profiler_type** new_elements = calloc(new_capacity, sizeof(_dx_memory_profiler_type*));
+    if (!new_elements) {
+      return NULL;
+    }
+    for (dx_size i = 0; i < g_types.capacity; ++i) {
+      _dx_memory_profiler_type* type = g_types.elements[i];
+      if (type) {
+        dx_size j = type->hash_value & (new_capacity - 1);
+        while (new_elements[j]) {
+          j = (j + 1) & (new_capacity - 1);
+        }
+        new_elements[j] = type;
+      }
+    }
+    free(g_types.elements);
+    g_types.elements = new_elements;
+    g_types.capacity = new_capacity;
+  }
+  dx_size hash_value = dx_hash_bytes(name, name_length);
+  dx_size i = hash_value & (g_types.capacity - 1);
+  while (g_types.elements[i]) {
+    _dx_memory_profiler_type* type = g_types.elements[i];
+    if (type->hash_value == hash_value && type->name_length == name_length && !memcmp(type->name, name, name_length)) {
+      return type;
+    }
+    i = (i + 1) & (g_types.capacity - 1);
+  }
+  _dx_memory_profiler_type* type = calloc(1, sizeof(_dx_memory_profiler_type));
+  if (!type) {
+    return NULL;
+  }
+  type->name = malloc(name_length > 0 ? name_length : 1);
+  if (!type->name) {
+    free(type);
+    return NULL;
   }
+  memcpy(type->name, name, name_length);
+  type->name_length = name_length;
+  type->hash_value = hash_value;
+  g_types.elements[i] = type;
+  g_types.size++;
+  return type;
 }
 
+static void _dx_memory_profiler_on_block_allocated(_dx_memory_block_header* header, char const* file, int line) {
+  AcquireSRWLockExclusive(&g_profiler_lock);
+  _dx_memory_profiler_site* site = _dx_memory_profiler_get_site(file, line);
+  header->site = site;
+  header->is_object = 0;
+  header->previous = NULL;
+  header->next = g_live_blocks;
+  if (g_live_blocks) {
+    g_live_blocks->previous = header;
+  }
+  g_live_blocks = header;
+  if (site) {
+    site->count++;
+    site->bytes += header->number_of_bytes;
+    site->live++;
+    site->live_bytes += header->number_of_bytes;
+    if (site->peak_live_bytes < site->live_bytes) {
+      site->peak_live_bytes = site->live_bytes;
+    }
+  }
+  ReleaseSRWLockExclusive(&g_profiler_lock);
+}
+
+static void _dx_memory_profiler_on_block_deallocated(_dx_memory_block_header* header) {
+  AcquireSRWLockExclusive(&g_profiler_lock);
+  if (header->previous) {
+    header->previous->next = header->next;
+  } else {
+    g_live_blocks = header->next;
+  }
+  if (header->next) {
+    header->next->previous = header->previous;
+  }
+  _dx_memory_profiler_site* site = header->site;
+  if (site) {
+    site->live--;
+    site->live_bytes -= header->number_of_bytes;
+  }
+  ReleaseSRWLockExclusive(&g_profiler_lock);
+}
+
+void dx_memory_profiler_mark_object(void* p) {
+  _dx_memory_get_header(p)->is_object = 1;
+}
+
+void dx_memory_profiler_on_object_destroyed(void* p, char const* type_name, dx_size type_name_length) {
+  AcquireSRWLockExclusive(&g_profiler_lock);
+  _dx_memory_profiler_type* type = _dx_memory_profiler_get_type(type_name, type_name_length);
+  if (type) {
+    type->count++;
+    type->bytes += _dx_memory_get_header(p)->number_of_bytes;
+  }
+  ReleaseSRWLockExclusive(&g_profiler_lock);
+}
+
+void dx_memory_profiler_set_type_name_callback(void (*callback)(void* p, char const** type_name, dx_size* type_name_length)) {
+  AcquireSRWLockExclusive(&g_profiler_lock);
+  g_type_name_callback = callback;
+  ReleaseSRWLockExclusive(&g_profiler_lock);
+}
+
+void dx_memory_profiler_reset() {
+  AcquireSRWLockExclusive(&g_profiler_lock);
+  for (dx_size i = 0; i < g_sites.capacity; ++i) {
+    _dx_memory_profiler_site* site = g_sites.elements[i];
+    if (site) {
+      site->count = 0;
+      site->bytes = 0;
+      site->peak_live_bytes = site->live_bytes;
+    }
+  }
+  for (dx_size i = 0; i < g_types.capacity; ++i) {
+    _dx_memory_profiler_type* type = g_types.elements[i];
+    if (type) {
+      type->count = 0;
+      type->bytes = 0;
+    }
+  }
+  ReleaseSRWLockExclusive(&g_profiler_lock);
+}
+
+static void _dx_memory_profiler_write(char const* format, ...) {
+  char buffer[512];
+  va_list arguments;
+  va_start(arguments, format);
+  int n = vsnprintf(buffer, sizeof(buffer), format, arguments);
+  va_end(arguments);
+  if (n > 0) {
+    dx_log(buffer, (dx_size)n < sizeof(buffer) ? (dx_size)n : sizeof(buffer) - 1);
+  }
+}
+
+static void _dx_memory_profiler_write_json_string(char const* p, dx_size n) {
+  dx_log("\"", sizeof("\"") - 1);
+  dx_size start = 0;
+  for (dx_size i = 0; i < n; ++i) {
+    if (p[i] == '\\' || p[i] == '"') {
+      dx_log(p + start, i - start);
+      dx_log("\\", sizeof("\\") - 1);
+      start = i;
+    }
+  }
+  dx_log(p + start, n - start);
+  dx_log("\"", sizeof("\"") - 1);
+}
+
+// Sort in descending order by live Bytes and by Bytes.
+static int _dx_memory_profiler_compare_sites(void const* x, void const* y) {
+  _dx_memory_profiler_site const* a = *(_dx_memory_profiler_site const**)x;
+  _dx_memory_profiler_site const* b = *(_dx_memory_profiler_site const**)y;
+  if (a->live_bytes != b->live_bytes) {
+    return a->live_bytes < b->live_bytes ? 1 : -1;
+  }
+  if (a->bytes != b->bytes) {
+    return a->bytes < b->bytes ? 1 : -1;
+  }
+  return 0;
+}
+
+// Sort in descending order by live Bytes and by Bytes.
+static int _dx_memory_profiler_compare_types(void const* x, void const* y) {
+  _dx_memory_profiler_type const* a = *(_dx_memory_profiler_type const**)x;
+  _dx_memory_profiler_type const* b = *(_dx_memory_profiler_type const**)y;
+  if (a->live_bytes != b->live_bytes) {
+    return a->live_bytes < b->live_bytes ? 1 : -1;
+  }
+  if (a->bytes + a->live_bytes != b->bytes + b->live_bytes) {
+    return a->bytes + a->live_bytes < b->bytes + b->live_bytes ? 1 : -1;
+  }
+  return 0;
+}
+
+int dx_memory_profiler_report(dx_bool json) {
+  AcquireSRWLockExclusive(&g_profiler_lock);
+  // Attribute live objects to their types.
+  for (dx_size i = 0; i < g_types.capacity; ++i) {
+    if (g_types.elements[i]) {
+      g_types.elements[i]->live = 0;
+      g_types.elements[i]->live_bytes = 0;
+    }
+  }
+  if (g_type_name_callback) {
+    for (_dx_memory_block_header* header = g_live_blocks; NULL != header; header = header->next) {
+      if (header->is_object) {
+        char const* type_name = NULL;
+        dx_size type_name_length = 0;
+        g_type_name_callback(_dx_memory_get_block(header), &type_name, &type_name_length);
+        // Objects without a type are destroyed objects held by object pools.
+        if (type_name) {
+          _dx_memory_profiler_type* type = _dx_memory_profiler_get_type(type_name, type_name_length);
+          if (type) {
+            type->live++;
+            type->live_bytes += header->number_of_bytes;
+          }
+        }
+      }
+    }
+  }
+  _dx_memory_profiler_site** sites = malloc((g_sites.size > 0 ? g_sites.size : 1) * sizeof(_dx_memory_profiler_site*));
+  _dx_memory_profiler_type** types = malloc((g_types.size > 0 ? g_types.size : 1) * sizeof(_dx_memory_profiler_type*));
+  if (!sites || !types) {
+    free(types);
+    free(sites);
+    ReleaseSRWLockExclusive(&g_profiler_lock);
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return 1;
+  }
+  dx_size number_of_sites = 0;
+  for (dx_size i = 0; i < g_sites.capacity; ++i) {
+    if (g_sites.elements[i]) {
+      sites[number_of_sites++] = g_sites.elements[i];
+    }
+  }
+  dx_size number_of_types = 0;
+  for (dx_size i = 0; i < g_types.capacity; ++i) {
+    if (g_types.elements[i]) {
+      types[number_of_types++] = g_types.elements[i];
+    }
+  }
+  qsort(sites, number_of_sites, sizeof(_dx_memory_profiler_site*), &_dx_memory_profiler_compare_sites);
+  qsort(types, number_of_types, sizeof(_dx_memory_profiler_type*), &_dx_memory_profiler_compare_types);
+  if (json) {
+    _dx_memory_profiler_write("{\n  \"sites\" : [\n");
+    for (dx_size i = 0; i < number_of_sites; ++i) {
+      _dx_memory_profiler_site* site = sites[i];
+      _dx_memory_profiler_write("    { \"file\" : ");
+      if (site->file) {
+        _dx_memory_profiler_write_json_string(site->file, strlen(site->file));
+      } else {
+        _dx_memory_profiler_write("null");
+      }
+      _dx_memory_profiler_write(", \"line\" : %d, \"count\" : %zu, \"bytes\" : %zu, \"live\" : %zu, \"live_bytes\" : %zu, \"peak_live_bytes\" : %zu }%s\n",
+                                site->line, site->count, site->bytes, site->live, site->live_bytes, site->peak_live_bytes,
+                                i + 1 < number_of_sites ? "," : "");
+    }
+    _dx_memory_profiler_write("  ],\n  \"types\" : [\n");
+    for (dx_size i = 0; i < number_of_types; ++i) {
+      _dx_memory_profiler_type* type = types[i];
+      _dx_memory_profiler_write("    { \"name\" : ");
+      _dx_memory_profiler_write_json_string(type->name, type->name_length);
+      _dx_memory_profiler_write(", \"count\" : %zu, \"bytes\" : %zu, \"live\" : %zu, \"live_bytes\" : %zu }%s\n",
+                                type->count + type->live, type->bytes + type->live_bytes, type->live, type->live_bytes,
+                                i + 1 < number_of_types ? "," : "");
+    }
+    _dx_memory_profiler_write("  ]\n}\n");
+  } else {
+    _dx_memory_profiler_write("heap profile: call sites (count, bytes, live, live bytes, peak live bytes)\n");
+    for (dx_size i = 0; i < number_of_sites; ++i) {
+      _dx_memory_profiler_site* site = sites[i];
+      _dx_memory_profiler_write("  %s:%d %zu %zu %zu %zu %zu\n",
+                                site->file ? site->file : "<unknown>", site->line,
+                                site->count, site->bytes, site->live, site->live_bytes, site->peak_live_bytes);
+    }
+    _dx_memory_profiler_write("heap profile: types (count, bytes, live, live bytes)\n");
+    for (dx_size i = 0; i < number_of_types; ++i) {
+      _dx_memory_profiler_type* type = types[i];
+      _dx_memory_profiler_write("  %.*s %zu %zu %zu %zu\n",
+                                (int)type->name_length, type->name,
+                                type->count + type->live, type->bytes + type->live_bytes, type->live, type->live_bytes);
+    }
+  }
+  free(types);
+  free(sites);
+  ReleaseSRWLockExclusive(&g_profiler_lock);
+  return 0;
+}
+
+#else
+
+int dx_memory_profiler_report(dx_bool json) {
+  dx_set_error(DX_NOT_IMPLEMENTED);
+  return 1;
+}
+
+void dx_memory_profiler_reset()
+{/*Intentionally empty.*/}
+
+#endif // DX_MEMORY_PROFILER_ENABLED
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 int dx_memory_compare(void const* p, void const* q, dx_size n) {
   if (!p || !q) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 0;
   }
-  return !memcmp(p, q, n);
+  return memcmp(p, q, n);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -30,6 +30,10 @@ int dx_memory_move(void* p, void const* q, dx_size n);
 int dx_memory_zero(void* p, dx_size n);
 
 /// @brief Allocate an object.
+/// @details
+/// If DX_MEMORY_SLAB_ALLOCATOR_ENABLED is defined and evaluates to @a 1,
+/// then objects of up to 512 Bytes are allocated from per-thread caches of fixed-size blocks.
+/// Greater objects are allocated from the system heap.
 /// @param n The size of the object. The size may be @a 0.
 /// @return A pointer to the object on success. The null pointer on failure.
 /// @default-failure
@@ -53,6 +57,143 @@ void* dx_memory_reallocate(void* p, dx_size n);
 /// @undefined @a p does not point to a object previousl allocated by a call to dx_allocate and is not the null pointer.
 void dx_memory_deallocate(void* p);
 
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+
+/// @brief Allocate an object and attribute the allocation to a call site.
+/// @param n The size of the object. The size may be @a 0.
+/// @param file The file name of the call site. Must point to a string with static storage duration.
+/// @param line The line of the call site.
+/// @return A pointer to the object on success. The null pointer on failure.
+/// @default-failure
+void* dx_memory_allocate_at(dx_size n, char const* file, int line);
+
+/// @brief Reallocate an object and attribute the allocation to a call site.
+/// @param p A pointer to an object previously allocated by a call to dx_allocate.
+/// @param n The number of Bytes to reallocate the object to. The size may be @a 0.
+/// @param file The file name of the call site. Must point to a string with static storage duration.
+/// @param line The line of the call site.
+/// @return A pointer to the reallocated object on success. The null pointer on failure.
+/// @default-failure
+void* dx_memory_reallocate_at(void* p, dx_size n, char const* file, int line);
+
+#define dx_memory_allocate(n) dx_memory_allocate_at(n, __FILE__, __LINE__)
+
+#define dx_memory_reallocate(p, n) dx_memory_reallocate_at(p, n, __FILE__, __LINE__)
+
+/// @brief Mark a block as a dx_object object.
+/// @param p A pointer to a block previously allocated by a call to dx_memory_allocate.
+/// @remarks Live objects are attributed to their types in reports.
+void dx_memory_profiler_mark_object(void* p);
+
+/// @brief Notify the profiler that a dx_object object is about to be destroyed.
+/// @param p A pointer to the object.
+/// @param type_name, type_name_length The name of the type of the object.
+void dx_memory_profiler_on_object_destroyed(void* p, char const* type_name, dx_size type_name_length);
+
+/// @brief Set the callback the profiler invokes to obtain the name of the type of a live dx_object object.
+/// @param callback A pointer to the callback or the null pointer.
+/// The callback assigns the null pointer to <code>*type_name</code> if the object has no type.
+void dx_memory_profiler_set_type_name_callback(void (*callback)(void* p, char const** type_name, dx_size* type_name_length));
+
+#endif // DX_MEMORY_PROFILER_ENABLED
+
+/// @brief Write a report of the heap profiler to the log.
+/// @param json @a true if the report is written in JSON format, @a false if the report is written in text format.
+/// @return The zero value on success. A non-zero value on failure.
+/// @details
+/// The report lists, for each call site and for each object type,
+/// the number of allocations and the number of allocated Bytes since the last reset
+/// as well as the number of live blocks and the number of Bytes in live blocks.
+/// Call sites additionally list the peak number of Bytes in live blocks since the last reset.
+/// Entries are sorted in descending order by the number of Bytes in live blocks.
+/// The live blocks listed in a report at shutdown are leaks.
+/// @default-failure
+/// In particular, the following error codes are returned:
+/// - #DX_NOT_IMPLEMENTED DX_MEMORY_PROFILER_ENABLED is not defined or does not evaluate to @a 1
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int dx_memory_profiler_report(dx_bool json);
+
+/// @brief Set the allocation budget of a frame.
+/// @param number_of_allocations The maximal number of allocations in a frame.
+/// @param abort @a true if the program is aborted if a frame exceeds the budget, @a false otherwise.
+/// @remarks The default budget is @a 0 allocations and frames exceeding the budget do not abort the program.
+void dx_memory_set_frame_budget(dx_size number_of_allocations, dx_bool abort);
+
+/// @brief Enter a frame on the calling thread.
+/// @remarks
+/// If DX_MEMORY_FRAME_BUDGET_ENABLED is defined and evaluates to @a 1,
+/// then calls to dx_memory_allocate and dx_memory_reallocate on the calling thread are counted until the frame is left.
+/// Otherwise this function does nothing.
+void dx_memory_enter_frame();
+
+/// @brief Leave a frame on the calling thread.
+/// @return The zero value on success. A non-zero value on failure.
+/// @details
+/// If the number of allocations in the frame exceeds the allocation budget,
+/// then the number of allocations and the call sites of the allocations are written to the log.
+/// Call sites are reported as file and line if DX_MEMORY_PROFILER_ENABLED evaluates to @a 1
+/// and as return addresses otherwise.
+/// Exceeding the allocation budget is not a failure.
+/// @default-failure
+/// In particular, the following error codes are returned:
+/// - #DX_INVALID_OPERATION the calling thread is not in a frame
+int dx_memory_leave_frame();
+
+/// @brief Reset the number of allocations, the number of allocated Bytes, and the peaks of the heap profiler.
+/// @remarks Call this function at the beginning of an interval of interest (e.g., a frame or a load).
+void dx_memory_profiler_reset();
+
+/// @brief Allocate a copy of a zero-terminated string.
+/// @param p A pointer to the zero-terminated string.
+/// @return A pointer to the copy on success. The null pointer on failure.
+/// The copy must be deallocated using dx_memory_deallocate when no longer required.
+/// @default-failure
+char* dx_memory_duplicate_string(char const* p);
+
+/// @brief Return the cached free blocks of the calling thread to the global caches.
+/// @remark A thread should invoke this function before it terminates.
+void dx_memory_release_thread_cache();
+
+/// @brief An arena from which dx_memory_allocate allocates small blocks while the arena is current.
+/// @details
+/// Blocks are bump-allocated from chunks of the arena.
+/// Deallocating such a block does not reclaim its memory.
+/// The memory of all blocks is reclaimed in one shot when the arena was destroyed and all its blocks were deallocated.
+/// Hence blocks may outlive the arena is destroyed. However, they keep the memory of the arena alive.
+typedef struct dx_memory_arena dx_memory_arena;
+
+/// @brief Create an arena.
+/// @return A pointer to the arena on success. The null pointer on failure.
+/// @default-failure
+dx_memory_arena* dx_memory_arena_create();
+
+/// @brief Destroy an arena.
+/// @param arena A pointer to the arena.
+/// @undefined The arena is the current arena of a thread.
+void dx_memory_arena_destroy(dx_memory_arena* arena);
+
+/// @brief Set the current arena of the calling thread.
+/// @param arena A pointer to the arena or the null pointer.
+/// If this is the null pointer, then blocks are no longer allocated from an arena.
+/// @return A pointer to the previous current arena of the calling thread or the null pointer.
+/// @remarks An arena must not be current for more than one thread at a time.
+dx_memory_arena* dx_memory_set_current_arena(dx_memory_arena* arena);
+
+/// @brief Get if a block was allocated from an arena.
+/// @param p A pointer to a block previously allocated by a call to dx_memory_allocate.
+/// @return @a true if the block was allocated from an arena. @a false otherwise.
+dx_bool dx_memory_is_arena_block(void* p);
+
+/// @brief Mark a block as a block of an object pool.
+/// @param p A pointer to a block previously allocated by a call to dx_memory_allocate.
+/// @remarks The mark is cleared if the block is reallocated.
+void dx_memory_mark_pooled_block(void* p);
+
+/// @brief Get if a block was marked by dx_memory_mark_pooled_block.
+/// @param p A pointer to a block previously allocated by a call to dx_memory_allocate.
+/// @return @a true if the block was marked. @a false otherwise.
+dx_bool dx_memory_is_pooled_block(void* p);
+
 /// @brief Compare the values of objects.
 /// @details This functin compares the Byte values of the objects lexicographically.
 /// @param p A pointer to the first object.
@@ -95,7 +236,7 @@ void dx_allocator_statistics_uninitialize(dx_allocator_statistics* statistics);
 /// @param statistics a pointer to an initialized @a (Spine_CollectorStatistics) object
 /// @param number_of_bytes The number of Bytes that has been allocated.
 /// @return The zero value on success. A non-zero value on failure.
-int dx_allocator_Statistics_on_block_allocated(dx_allocator_statistics* statistics, dx_size number_of_bytes);
+int dx_allocator_statistics_on_block_allocated(dx_allocator_statistics* statistics, dx_size number_of_bytes);
 
 /// @brief Update memory statistics for a deallocation.
 /// @param statistics a pointer to an initialized @a (Spine_CollectorStatistics) object
@@ -103,6 +244,14 @@ int dx_allocator_Statistics_on_block_allocated(dx_allocator_statistics* statisti
 /// @return The zero value on success. A non-zero value on failure.
 int dx_allocator_statistics_on_block_deallocated(dx_allocator_statistics* statistics, dx_size number_of_bytes);
 
+/// @brief Get the statistics of the allocator used by dx_memory_allocate, dx_memory_reallocate, and dx_memory_deallocate.
+/// @param statistics A pointer to an initialized @a dx_allocator_statistics object.
+/// @return The zero value on success. A non-zero value on failure.
+/// @success <code>*statistics</code> was assigned a snapshot of the statistics.
+/// The smallest and the greatest block are the smallest and the greatest block ever allocated.
+/// @default-failure
+int dx_memory_get_statistics(dx_allocator_statistics* statistics);
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #endif // DX_CORE_MEMORY_H_INCLUDED
@@ -4,6 +4,15 @@
 
 #include "dx/core/memory.h"
 
+// _InterlockedExchangePointer, _InterlockedCompareExchangePointer, _InterlockedIncrement
+#include <intrin.h>
+
+#if defined(DX_MSG_QUEUE_WITH_TESTS) && 1 == DX_MSG_QUEUE_WITH_TESTS && defined(_WIN32)
+  // CreateThread, WaitForSingleObject, CloseHandle
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#endif
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #define DX_MSG_TRACE (0)
@@ -85,7 +94,12 @@ static void dx_emit_msg_destruct(dx_emit_msg* emit_msg) {
 
 dx_emit_msg* dx_emit_msg_create(char const* p, dx_size n) {
   TRACE("enter: dx_emit_msg_create\n");
-  dx_emit_msg* self = DX_EMIT_MSG(dx_object_alloc(sizeof(dx_emit_msg)));
+  dx_rti_type* _type = dx_emit_msg_get_type();
+  if (!_type) {
+    TRACE("leave: dx_emit_msg_create\n");
+    return NULL;
+  }
+  dx_emit_msg* self = DX_EMIT_MSG(dx_object_alloc_pooled(_type));
   if (!self) {
     TRACE("leave: dx_emit_msg_create\n");
     return NULL;
@@ -143,7 +157,12 @@ static void dx_quit_msg_destruct(dx_quit_msg* self)
 
 dx_quit_msg* dx_quit_msg_create() {
   TRACE("enter: dx_quit_msg_create\n");
-  dx_quit_msg* self = DX_QUIT_MSG(dx_object_alloc(sizeof(dx_quit_msg)));
+  dx_rti_type* _type = dx_quit_msg_get_type();
+  if (!_type) {
+    TRACE("leave: dx_quit_msg_create\n");
+    return NULL;
+  }
+  dx_quit_msg* self = DX_QUIT_MSG(dx_object_alloc_pooled(_type));
   if (!self) {
     TRACE("leave: dx_quit_msg_create\n");
     return NULL;
@@ -170,12 +189,50 @@ dx_quit_msg* dx_quit_msg_create() {
   #define TRACE(msg)
 #endif
 
+typedef struct dx_msg_queue_node dx_msg_queue_node;
+
+struct dx_msg_queue_node {
+  dx_msg_queue_node* next;
+  dx_msg* msg;
+};
+
+// The producers push onto the "pushed" list using compare and swap.
+// The consumer takes the entire "pushed" list using an exchange and appends it, in reverse order, to the "popped" list.
+// As the consumer never removes individual nodes from the "pushed" list, there is no ABA problem.
 typedef struct dx_msg_queue {
-  dx_msg** elements;
-  dx_size size, capacity;
-  dx_size write, read;
+  // The nodes pushed by the producers. The most recently pushed node first.
+  dx_msg_queue_node* volatile pushed;
+  // The nodes taken by the consumer. The least recently pushed node first.
+  dx_msg_queue_node* popped;
+  // The last node of the "popped" list if that list is not empty.
+  dx_msg_queue_node* popped_last;
 } dx_msg_queue;
 
+// Take the nodes pushed by the producers.
+// @return @a true if nodes were taken, @a false otherwise.
+static bool _dx_msg_queue_take(dx_msg_queue* msg_queue) {
+  dx_msg_queue_node* node = _InterlockedExchangePointer((void* volatile*)&msg_queue->pushed, NULL);
+  if (!node) {
+    return false;
+  }
+  // The most recently pushed node becomes the last node of the "popped" list.
+  dx_msg_queue_node* last = node;
+  dx_msg_queue_node* popped = NULL;
+  while (node) {
+    dx_msg_queue_node* next = node->next;
+    node->next = popped;
+    popped = node;
+    node = next;
+  }
+  if (msg_queue->popped) {
+    msg_queue->popped_last->next = popped;
+  } else {
+    msg_queue->popped = popped;
+  }
+  msg_queue->popped_last = last;
+  return true;
+}
+
 int dx_msg_queue_push(dx_msg_queue* msg_queue, dx_msg* msg) {
   TRACE("enter: dx_msg_queue_push\n");
   if (!msg_queue || !msg) {
@@ -183,34 +240,64 @@ int dx_msg_queue_push(dx_msg_queue* msg_queue, dx_msg* msg) {
     TRACE("leave: dx_msg_queue_push\n");
     return 1;
   }
-  if (msg_queue->size == msg_queue->capacity) {
-    dx_set_error(DX_ALLOCATION_FAILED);
+  dx_msg_queue_node* node = dx_memory_allocate(sizeof(dx_msg_queue_node));
+  if (!node) {
     TRACE("leave: dx_msg_queue_push (failure)\n");
     return 1;
   }
-  msg_queue->elements[msg_queue->write] = msg;
-  msg_queue->write = (msg_queue->write + 1) % msg_queue->capacity;
-  msg_queue->size++;
+  node->msg = msg;
   DX_REFERENCE(msg);
+  dx_msg_queue_node* pushed;
+  do {
+    pushed = msg_queue->pushed;
+    node->next = pushed;
+  } while (_InterlockedCompareExchangePointer((void* volatile*)&msg_queue->pushed, node, pushed) != pushed);
   TRACE("leave: dx_msg_queue_push (success)\n");
   return 0;
 }
 
 int dx_msg_queue_pop(dx_msg_queue* msg_queue, dx_msg** msg) {
   TRACE("enter: dx_msg_queue_pop\n");
-  if (msg_queue->size == 0) {
+  if (!msg_queue->popped && !_dx_msg_queue_take(msg_queue)) {
     *msg = NULL;
     TRACE("leave: dx_msg_queue_pop (success)\n");
     return 0;
   } else {
-    *msg = msg_queue->elements[msg_queue->read];
-    msg_queue->read = (msg_queue->read + 1) % msg_queue->capacity;
-    msg_queue->size--;
+    dx_msg_queue_node* node = msg_queue->popped;
+    msg_queue->popped = node->next;
+    if (!msg_queue->popped) {
+      msg_queue->popped_last = NULL;
+    }
+    *msg = node->msg;
+    dx_memory_deallocate(node);
     TRACE("leave: dx_msg_queue_pop (success)\n");
     return 0;
   }
 }
 
+int dx_msg_queue_pop_all(dx_msg_queue* msg_queue, dx_object_array* msgs) {
+  TRACE("enter: dx_msg_queue_pop_all\n");
+  if (!msg_queue || !msgs) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    TRACE("leave: dx_msg_queue_pop_all (failure)\n");
+    return 1;
+  }
+  _dx_msg_queue_take(msg_queue);
+  while (msg_queue->popped) {
+    dx_msg_queue_node* node = msg_queue->popped;
+    if (dx_object_array_append(msgs, DX_OBJECT(node->msg))) {
+      TRACE("leave: dx_msg_queue_pop_all (failure)\n");
+      return 1;
+    }
+    msg_queue->popped = node->next;
+    DX_UNREFERENCE(node->msg);
+    dx_memory_deallocate(node);
+  }
+  msg_queue->popped_last = NULL;
+  TRACE("leave: dx_msg_queue_pop_all (success)\n");
+  return 0;
+}
+
 dx_msg_queue* dx_msg_queue_create() {
   TRACE("enter: dx_msg_queue_create\n");
   dx_msg_queue* msg_queue = dx_memory_allocate(sizeof(dx_msg_queue));
@@ -219,32 +306,23 @@ dx_msg_queue* dx_msg_queue_create() {
     TRACE("leave: dx_msg_queue_create\n");
     return NULL;
   }
-  msg_queue->size = 0;
-  msg_queue->capacity = 1024;
-  msg_queue->write = 0;
-  msg_queue->read = 0;
-  msg_queue->elements = dx_memory_allocate(sizeof(dx_msg*) * 1024);
-  if (!msg_queue->elements) {
-    dx_log("allocation failed\n", sizeof("allocation failed\n"));
-    dx_memory_deallocate(msg_queue);
-    msg_queue = NULL;
-    TRACE("leave: dx_msg_queue_create (failure)\n");
-    return NULL;
-  }
+  msg_queue->pushed = NULL;
+  msg_queue->popped = NULL;
+  msg_queue->popped_last = NULL;
   TRACE("leave: dx_msg_queue_create (success)\n");
   return msg_queue;
 }
 
 void dx_msg_queue_destroy(dx_msg_queue* msg_queue) {
   TRACE("enter: dx_msg_queue_destroy\n");
-  if (msg_queue->elements) {
-    while (msg_queue->size > 0) {
-      dx_msg* msg = msg_queue->elements[--msg_queue->size];
-      DX_UNREFERENCE(msg);
+  do {
+    while (msg_queue->popped) {
+      dx_msg_queue_node* node = msg_queue->popped;
+      msg_queue->popped = node->next;
+      DX_UNREFERENCE(node->msg);
+      dx_memory_deallocate(node);
     }
-    dx_memory_deallocate(msg_queue->elements);
-    msg_queue->elements = NULL;
-  }
+  } while (_dx_msg_queue_take(msg_queue));
   dx_memory_deallocate(msg_queue);
   msg_queue = NULL;
   TRACE("leave: dx_msg_queue_destroy\n");
@@ -252,4 +330,211 @@ void dx_msg_queue_destroy(dx_msg_queue* msg_queue) {
 
 #undef TRACE
 
+#if defined(DX_MSG_QUEUE_WITH_TESTS) && 1 == DX_MSG_QUEUE_WITH_TESTS
+
+// Push three messages, pop one message, push one message, and pop all messages.
+// The messages must be received in the order in which they were pushed.
+static int _dx_msg_queue_test_order(dx_msg_queue* msg_queue, dx_msg** msgs) {
+  for (dx_size i = 0; i < 3; ++i) {
+    if (dx_msg_queue_push(msg_queue, msgs[i])) {
+      return 1;
+    }
+  }
+  dx_msg* msg = NULL;
+  if (dx_msg_queue_pop(msg_queue, &msg)) {
+    return 1;
+  }
+  if (msg != msgs[0]) {
+    if (msg) {
+      DX_UNREFERENCE(msg);
+    }
+    return 1;
+  }
+  DX_UNREFERENCE(msg);
+  if (dx_msg_queue_push(msg_queue, msgs[3])) {
+    return 1;
+  }
+  dx_object_array received;
+  if (dx_object_array_initialize(&received, 0)) {
+    return 1;
+  }
+  if (dx_msg_queue_pop_all(msg_queue, &received)) {
+    dx_object_array_uninitialize(&received);
+    return 1;
+  }
+  if (3 != dx_object_array_get_size(&received)) {
+    dx_object_array_uninitialize(&received);
+    return 1;
+  }
+  for (dx_size i = 0; i < 3; ++i) {
+    if (DX_OBJECT(msgs[i + 1]) != dx_object_array_get_at(&received, i)) {
+      dx_object_array_uninitialize(&received);
+      return 1;
+    }
+  }
+  dx_object_array_uninitialize(&received);
+  if (dx_msg_queue_pop(msg_queue, &msg)) {
+    return 1;
+  }
+  if (msg) {
+    DX_UNREFERENCE(msg);
+    return 1;
+  }
+  return 0;
+}
+
+// The number of producers and the number of messages pushed by each producer.
+#define _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS (4)
+#define _DX_MSG_QUEUE_TESTS_NUMBER_OF_MSGS (4 * 1024)
+
+// The payload of a message pushed by a producer.
+typedef struct _dx_msg_queue_tests_payload {
+  dx_size producer;
+  dx_size sequence;
+} _dx_msg_queue_tests_payload;
+
+typedef struct _dx_msg_queue_tests_producer {
+  dx_msg_queue* msg_queue;
+  dx_size index;
+  bool failed;
+  // Incremented by each producer when it is done.
+  long volatile* number_of_done_producers;
+} _dx_msg_queue_tests_producer;
+
+// Create and push _DX_MSG_QUEUE_TESTS_NUMBER_OF_MSGS messages of which the payloads are the producer and their sequence numbers.
+static void _dx_msg_queue_tests_producer_run(_dx_msg_queue_tests_producer* producer) {
+  for (dx_size i = 0; i < _DX_MSG_QUEUE_TESTS_NUMBER_OF_MSGS; ++i) {
+    _dx_msg_queue_tests_payload payload = { .producer = producer->index, .sequence = i };
+    dx_emit_msg* msg = dx_emit_msg_create((char const*)&payload, sizeof(payload));
+    if (!msg) {
+      producer->failed = true;
+      break;
+    }
+    if (dx_msg_queue_push(producer->msg_queue, DX_MSG(msg))) {
+      DX_UNREFERENCE(msg);
+      producer->failed = true;
+      break;
+    }
+    DX_UNREFERENCE(msg);
+  }
+  _InterlockedIncrement(producer->number_of_done_producers);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI _dx_msg_queue_tests_producer_main(LPVOID parameter) {
+  _dx_msg_queue_tests_producer_run((_dx_msg_queue_tests_producer*)parameter);
+  dx_memory_release_thread_cache();
+  return 0;
+}
+#endif
+
+// Pop the messages while _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS producers push messages concurrently.
+// All messages must be received and the messages of each producer must be received in the order in which they were pushed.
+// Other environments run the producers on the calling thread before the messages are popped.
+static int _dx_msg_queue_test_producers(dx_msg_queue* msg_queue) {
+  long volatile number_of_done_producers = 0;
+  _dx_msg_queue_tests_producer producers[_DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS];
+  for (dx_size i = 0; i < _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS; ++i) {
+    producers[i].msg_queue = msg_queue;
+    producers[i].index = i;
+    producers[i].failed = false;
+    producers[i].number_of_done_producers = &number_of_done_producers;
+  }
+#if defined(_WIN32)
+  HANDLE threads[_DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS];
+  for (dx_size i = 0; i < _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS; ++i) {
+    threads[i] = CreateThread(NULL, 0, &_dx_msg_queue_tests_producer_main, &producers[i], 0, NULL);
+    if (!threads[i]) {
+      _dx_msg_queue_tests_producer_run(&producers[i]);
+    }
+  }
+#else
+  for (dx_size i = 0; i < _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS; ++i) {
+    _dx_msg_queue_tests_producer_run(&producers[i]);
+  }
+#endif
+  // The sequence number of the next message expected from each producer.
+  dx_size expected[_DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS] = { 0 };
+  dx_size number_of_received_msgs = 0;
+  bool failed = false;
+  while (!failed && number_of_received_msgs < _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS * _DX_MSG_QUEUE_TESTS_NUMBER_OF_MSGS) {
+    // If all producers were done before the queue is empty, then no more messages are received.
+    bool done = _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS == number_of_done_producers;
+    dx_msg* msg = NULL;
+    if (dx_msg_queue_pop(msg_queue, &msg)) {
+      failed = true;
+      break;
+    }
+    if (!msg) {
+      if (done) {
+        break;
+      }
+      continue;
+    }
+    char const* p;
+    dx_size n;
+    _dx_msg_queue_tests_payload payload;
+    if (DX_MSG_TYPE_EMIT != dx_msg_get_flags(msg) || dx_emit_msg_get(DX_EMIT_MSG(msg), &p, &n) || sizeof(payload) != n) {
+      failed = true;
+    } else {
+      dx_memory_copy(&payload, p, sizeof(payload));
+      if (payload.producer >= _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS || payload.sequence != expected[payload.producer]) {
+        failed = true;
+      } else {
+        expected[payload.producer]++;
+        number_of_received_msgs++;
+      }
+    }
+    DX_UNREFERENCE(msg);
+  }
+#if defined(_WIN32)
+  for (dx_size i = 0; i < _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS; ++i) {
+    if (threads[i]) {
+      WaitForSingleObject(threads[i], INFINITE);
+      CloseHandle(threads[i]);
+    }
+  }
+#endif
+  for (dx_size i = 0; i < _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS; ++i) {
+    if (producers[i].failed) {
+      failed = true;
+    }
+  }
+  if (failed || _DX_MSG_QUEUE_TESTS_NUMBER_OF_PRODUCERS * _DX_MSG_QUEUE_TESTS_NUMBER_OF_MSGS != number_of_received_msgs) {
+    return 1;
+  }
+  return 0;
+}
+
+int dx_msg_queue_tests() {
+  dx_msg* msgs[4] = { NULL, NULL, NULL, NULL };
+  for (dx_size i = 0; i < 4; ++i) {
+    msgs[i] = DX_MSG(dx_quit_msg_create());
+    if (!msgs[i]) {
+      while (i > 0) {
+        DX_UNREFERENCE(msgs[--i]);
+      }
+      return 1;
+    }
+  }
+  dx_msg_queue* msg_queue = dx_msg_queue_create();
+  if (!msg_queue) {
+    for (dx_size i = 0; i < 4; ++i) {
+      DX_UNREFERENCE(msgs[i]);
+    }
+    return 1;
+  }
+  int result = _dx_msg_queue_test_order(msg_queue, msgs);
+  if (!result) {
+    result = _dx_msg_queue_test_producers(msg_queue);
+  }
+  dx_msg_queue_destroy(msg_queue);
+  for (dx_size i = 0; i < 4; ++i) {
+    DX_UNREFERENCE(msgs[i]);
+  }
+  return result;
+}
+
+#endif // DX_MSG_QUEUE_WITH_TESTS
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1,7 +1,7 @@
 #if !defined(DX_CORE_MSGS_H_INCLUDED)
 #define DX_CORE_MSGS_H_INCLUDED
 
-#include "dx/core/object.h"
+#include "dx/core/object_array.h"
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -85,6 +85,10 @@ struct dx_quit_msg {
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 // The opaque type of a message queue.
+// A message queue is an unbounded multiple producer, single consumer queue.
+// dx_msg_queue_push may be invoked concurrently by any number of threads without blocking.
+// dx_msg_queue_pop and dx_msg_queue_pop_all must only be invoked by one thread at a time.
+// @remarks Messages pushed from other threads must not be thread-confined.
 typedef struct dx_msg_queue dx_msg_queue;
 
 // Push a message on the message queue.
@@ -106,6 +110,19 @@ int dx_msg_queue_push(dx_msg_queue* msg_queue, dx_msg* msg);
 // @a 0 on success. A non-zero value on failure
 int dx_msg_queue_pop(dx_msg_queue* msg_queue, dx_msg** msg);
 
+// Pop all messages from the message queue.
+// @param msgs A pointer to a dx_object_array object.
+// The messages are appended to that array in the order in which they were pushed.
+// @post
+// On success:
+// All messages pushed before this call were appended to <code>msgs</code>.
+// The references acquired to the messages when they were added to the message queue were relinquished.
+// On failure:
+// The messages appended to <code>msgs</code> remain appended, the other messages remain in the queue.
+// @return
+// @a 0 on success. A non-zero value on failure
+int dx_msg_queue_pop_all(dx_msg_queue* msg_queue, dx_object_array* msgs);
+
 // Create a message queue.
 // @return pointer to the message queue on success. null pointer on failure.
 dx_msg_queue* dx_msg_queue_create();
@@ -114,6 +131,10 @@ dx_msg_queue* dx_msg_queue_create();
 // The message queue relinquishes all references to messages contained in the queue.
 void dx_msg_queue_destroy(dx_msg_queue* msg_queue);
 
+#if defined(DX_MSG_QUEUE_WITH_TESTS) && 1 == DX_MSG_QUEUE_WITH_TESTS
+int dx_msg_queue_tests();
+#endif
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #endif // DX_CORE_MSGS_H_INCLUDED
\ No newline at end of file
@@ -1,7 +1,13 @@
 #include "dx/core/object.h"
 
 #include "dx/core/memory.h"
+#include "dx/core/os.h"
 #include "dx/core/pointer_hashmap.h"
+#include "dx/core/string.h"
+
+// SRWLOCK
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -31,6 +37,26 @@ static _dx_rti_type_name* _dx_rti_type_name_create(char const* bytes, dx_size nu
 #define _DX_RTI_TYPE_NODE_FLAGS_ENUMERATION (2)
 #define _DX_RTI_TYPE_NODE_FLAGS_OBJECT (4)
 
+// The maximal number of objects an object pool holds.
+// If an object is released to a full object pool, then the object is deallocated.
+#define _DX_RTI_TYPE_POOL_CAPACITY (4096)
+
+typedef struct _dx_rti_type_pool_entry _dx_rti_type_pool_entry;
+
+struct _dx_rti_type_pool_entry {
+  _dx_rti_type_pool_entry* next;
+};
+
+typedef struct _dx_rti_type_pool _dx_rti_type_pool;
+
+struct _dx_rti_type_pool {
+  SRWLOCK lock;
+  bool enabled;
+  _dx_rti_type_pool_entry* head;
+  dx_size population;
+  dx_size high_water_mark;
+};
+
 typedef struct _dx_rti_type _dx_rti_type;
 static inline _dx_rti_type* _DX_RTI_TYPE(void* p) {
   return (_dx_rti_type*)p;
@@ -49,6 +75,16 @@ struct _dx_rti_type {
       _dx_rti_type* parent;
       dx_size value_size;
       void (*destruct)(void*);
+      _dx_rti_type_pool pool;
+      /// @brief The number of ancestors of this type.
+      dx_size depth;
+      /// @brief An array of <code>depth + 1</code> elements.
+      /// The element at index @a i is the ancestor of depth @a i, the element at index @a depth is this type.
+      _dx_rti_type** display;
+      /// @brief The size of the dispatch table.
+      dx_size dispatch_size;
+      /// @brief A pointer to the dispatch table or the null pointer if the dispatch size is @a 0.
+      void* dispatch;
     } object;
   };
 };
@@ -90,18 +126,33 @@ static void _dx_rti_type_reference(_dx_rti_type* a) {
   dx_reference_counter_increment(&a->reference_count);
 }
 
+// Deallocate the objects in the pool of the specified object type.
+static void _dx_rti_type_pool_clear(_dx_rti_type* a) {
+  while (a->object.pool.head) {
+    _dx_rti_type_pool_entry* entry = a->object.pool.head;
+    a->object.pool.head = entry->next;
+    dx_memory_deallocate(entry);
+  }
+  a->object.pool.population = 0;
+}
+
 static void _dx_rti_type_unreference(_dx_rti_type* a) {
   if (0 == dx_reference_counter_decrement(&a->reference_count)) {
     if (a->on_type_destroyed) {
       a->on_type_destroyed();
     }
-    if (_DX_RTI_TYPE_NODE_FLAGS_OBJECT == a->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT) {
+    if (_DX_RTI_TYPE_NODE_FLAGS_OBJECT == (a->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT)) {
+      _dx_rti_type_pool_clear(a);
+      dx_memory_deallocate(a->object.dispatch);
+      a->object.dispatch = NULL;
+      dx_memory_deallocate(a->object.display);
+      a->object.display = NULL;
       if (a->object.parent) {
         _dx_rti_type_unreference(a->object.parent);
         a->object.parent = NULL;
       }
     }
-    DX_UNREFERENCE(a->name);
+    _dx_rti_type_name_unreference(a->name);
     a->name = NULL;
     dx_memory_deallocate(a);
   }
@@ -119,6 +170,23 @@ static void _dx_rti_type_unreference_callback(_dx_rti_type** a) {
 
 static dx_pointer_hashmap* g_types;
 
+// Guards g_types.
+// Held exclusively while types are created or destroyed.
+static SRWLOCK g_types_lock = SRWLOCK_INIT;
+
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+static void _dx_rti_type_name_callback(dx_object* object, char const** type_name, dx_size* type_name_length) {
+  _dx_rti_type* type = (_dx_rti_type*)object->type;
+  if (type) {
+    *type_name = type->name->bytes;
+    *type_name_length = type->name->number_of_bytes;
+  } else {
+    *type_name = NULL;
+    *type_name_length = 0;
+  }
+}
+#endif
+
 int dx_rti_initialize() {
   static DX_POINTER_HASHMAP_CONFIGURATION const configuration = {
    .compare_keys_callback = (bool(*)(dx_pointer_hashmap_key*,dx_pointer_hashmap_key*)) & _dx_rti_type_name_compare_keys_callback,
@@ -137,13 +205,41 @@ int dx_rti_initialize() {
     g_types = NULL;
     return 1;
   }
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  dx_memory_profiler_set_type_name_callback((void(*)(void*, char const**, dx_size*)) & _dx_rti_type_name_callback);
+#endif
   return 0;
 }
 
 void dx_rti_unintialize() {
+  // Atoms are objects. Release them while their types still exist.
+  dx_string_atoms_uninitialize();
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  // The blocks of pooled objects are not leaks. Deallocate them before the report.
+  AcquireSRWLockExclusive(&g_types_lock);
+  dx_pointer_hashmap_iterator iterator;
+  if (!dx_pointer_hashmap_iterator_initialize(&iterator, g_types)) {
+    while (dx_pointer_hashmap_iterator_has_entry(&iterator)) {
+      _dx_rti_type* type = dx_pointer_hashmap_iterator_get_value(&iterator);
+      if (_DX_RTI_TYPE_NODE_FLAGS_OBJECT == (type->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT)) {
+        AcquireSRWLockExclusive(&type->object.pool.lock);
+        _dx_rti_type_pool_clear(type);
+        ReleaseSRWLockExclusive(&type->object.pool.lock);
+      }
+      dx_pointer_hashmap_iterator_next(&iterator);
+    }
+    dx_pointer_hashmap_iterator_uninitialize(&iterator);
+  }
+  ReleaseSRWLockExclusive(&g_types_lock);
+  // The objects still alive at this point are leaks.
+  dx_memory_profiler_report(false);
+  dx_memory_profiler_set_type_name_callback(NULL);
+#endif
+  AcquireSRWLockExclusive(&g_types_lock);
   dx_pointer_hashmap_uninitialize(g_types);
   dx_memory_deallocate(g_types);
   g_types = NULL;
+  ReleaseSRWLockExclusive(&g_types_lock);
 }
 
 dx_bool dx_rti_type_is_fundamental(dx_rti_type* type) {
@@ -158,18 +254,24 @@ dx_bool dx_rti_type_is_object(dx_rti_type* type) {
   return _DX_RTI_TYPE_NODE_FLAGS_OBJECT == (_DX_RTI_TYPE(type)->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT);
 }
 
-dx_rti_type* dx_rti_create_fundamental(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size) {
+static dx_rti_type* _dx_rti_create_fundamental(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size) {
   _dx_rti_type_name* name = _dx_rti_type_name_create(p, n);
   if (!name) {
     return NULL;
   }
   _dx_rti_type* type = dx_pointer_hashmap_get(g_types, name);
+  if (type && type->on_type_destroyed == on_type_destroyed) {
+    // The type was created by a concurrent invocation of the same type definition.
+    _dx_rti_type_name_unreference(name);
+    name = NULL;
+    return (dx_rti_type*)type;
+  }
   if (type) {
     dx_log("a type of the name `", sizeof("a type of the name `") - 1);
     dx_log(p, n);
     dx_log("` already exists", sizeof("` already exists") - 1);
     dx_set_error(DX_EXISTS);
-    DX_UNREFERENCE(name);
+    _dx_rti_type_name_unreference(name);
     name = NULL;
     return NULL;
   }
@@ -194,21 +296,38 @@ dx_rti_type* dx_rti_create_fundamental(char const* p, dx_size n, void (*on_type_
     type = NULL;
     return NULL;
   }
-  return NULL;
+  _dx_rti_type_unreference(type);
+  return (dx_rti_type*)type;
 }
 
-dx_rti_type* dx_rti_create_enumeration(char const* p, dx_size n, void (*on_type_destroyed)()) {
+dx_rti_type* dx_rti_create_fundamental(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size) {
+  // Types outlive any arena.
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  AcquireSRWLockExclusive(&g_types_lock);
+  dx_rti_type* type = _dx_rti_create_fundamental(p, n, on_type_destroyed, value_size);
+  ReleaseSRWLockExclusive(&g_types_lock);
+  dx_memory_set_current_arena(arena);
+  return type;
+}
+
+static dx_rti_type* _dx_rti_create_enumeration(char const* p, dx_size n, void (*on_type_destroyed)()) {
   _dx_rti_type_name* name = _dx_rti_type_name_create(p, n);
   if (!name) {
     return NULL;
   }
   _dx_rti_type* type = dx_pointer_hashmap_get(g_types, name);
+  if (type && type->on_type_destroyed == on_type_destroyed) {
+    // The type was created by a concurrent invocation of the same type definition.
+    _dx_rti_type_name_unreference(name);
+    name = NULL;
+    return (dx_rti_type*)type;
+  }
   if (type) {
     dx_log("a type of the name `", sizeof("a type of the name `") - 1);
     dx_log(p, n);
     dx_log("` already exists", sizeof("` already exists") - 1);
     dx_set_error(DX_EXISTS);
-    DX_UNREFERENCE(name);
+    _dx_rti_type_name_unreference(name);
     name = NULL;
     return NULL;
   }
@@ -232,58 +351,155 @@ dx_rti_type* dx_rti_create_enumeration(char const* p, dx_size n, void (*on_type_
     type = NULL;
     return NULL;
   }
-  return NULL;
+  _dx_rti_type_unreference(type);
+  return (dx_rti_type*)type;
 }
 
-dx_rti_type* dx_rti_create_object(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size, dx_rti_type* parent, void (*destruct)(void*)) {
-  _dx_rti_type_name* name = _dx_rti_type_name_create(p, n);
-  if (!name) {
-    return NULL;
+dx_rti_type* dx_rti_create_enumeration(char const* p, dx_size n, void (*on_type_destroyed)()) {
+  // Types outlive any arena.
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  AcquireSRWLockExclusive(&g_types_lock);
+  dx_rti_type* type = _dx_rti_create_enumeration(p, n, on_type_destroyed);
+  ReleaseSRWLockExclusive(&g_types_lock);
+  dx_memory_set_current_arena(arena);
+  return type;
+}
+
+// Deallocate an object type which was not added to the type registry.
+// Unlike _dx_rti_type_unreference, this does not invoke the on_type_destroyed callback:
+// The callback belongs to the type definition and would reset the type published under the same name.
+static void _dx_rti_object_type_discard(_dx_rti_type* type) {
+  if (type->object.parent) {
+    _dx_rti_type_unreference(type->object.parent);
+    type->object.parent = NULL;
   }
-  _dx_rti_type* type = dx_pointer_hashmap_get(g_types, name);
-  if (type) {
-    dx_log("a type of the name `", sizeof("a type of the name `") - 1);
-    dx_log(p, n);
-    dx_log("` already exists", sizeof("` already exists") - 1);
-    dx_set_error(DX_EXISTS);
-    DX_UNREFERENCE(name);
-    name = NULL;
+  dx_memory_deallocate(type->object.dispatch);
+  type->object.dispatch = NULL;
+  dx_memory_deallocate(type->object.display);
+  type->object.display = NULL;
+  _dx_rti_type_name_unreference(type->name);
+  type->name = NULL;
+  dx_memory_deallocate(type);
+}
+
+// Create an object type which is not yet added to the type registry.
+// This is invoked without holding g_types_lock such that construct_dispatch may create types.
+static _dx_rti_type* _dx_rti_object_type_create(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size, dx_rti_type* parent, void (*destruct)(void*), dx_size dispatch_size, void (*construct_dispatch)(void*)) {
+  dx_size parent_dispatch_size = parent ? _DX_RTI_TYPE(parent)->object.dispatch_size : 0;
+  if (!dispatch_size) {
+    dispatch_size = parent_dispatch_size;
+  } else if (dispatch_size < parent_dispatch_size) {
+    dx_set_error(DX_INVALID_ARGUMENT);
     return NULL;
   }
-  if (dx_get_error() != DX_NOT_FOUND) {
+  _dx_rti_type_name* name = _dx_rti_type_name_create(p, n);
+  if (!name) {
     return NULL;
   }
-  dx_set_error(DX_NO_ERROR);
-  type = dx_memory_allocate(sizeof(_dx_rti_type));
+  _dx_rti_type* type = dx_memory_allocate(sizeof(_dx_rti_type));
   if (!type) {
+    _dx_rti_type_name_unreference(name);
+    name = NULL;
     return NULL;
   }
   type->on_type_destroyed = on_type_destroyed;
   type->flags = _DX_RTI_TYPE_NODE_FLAGS_OBJECT;
   type->name = name;
-  //_dx_rti_type_name_reference(type->name);
   type->reference_count = 1;
   type->object.value_size = value_size;
   type->object.destruct = destruct;
   type->object.parent = _DX_RTI_TYPE(parent);
+  type->object.depth = type->object.parent ? type->object.parent->object.depth + 1 : 0;
+  type->object.dispatch_size = dispatch_size;
+  type->object.dispatch = NULL;
+  InitializeSRWLock(&type->object.pool.lock);
+  type->object.pool.enabled = false;
+  type->object.pool.head = NULL;
+  type->object.pool.population = 0;
+  type->object.pool.high_water_mark = 0;
   if (type->object.parent) {
     _dx_rti_type_reference(type->object.parent);
   }
-  if (dx_pointer_hashmap_set(g_types, name, type)) {
-    if (type->object.parent) {
-      _dx_rti_type_unreference(type->object.parent);
-      type->object.parent = NULL;
+  type->object.display = dx_memory_allocate(sizeof(_dx_rti_type*) * (type->object.depth + 1));
+  if (!type->object.display) {
+    _dx_rti_object_type_discard(type);
+    type = NULL;
+    return NULL;
+  }
+  if (type->object.parent) {
+    dx_memory_copy(type->object.display, type->object.parent->object.display, sizeof(_dx_rti_type*) * type->object.depth);
+  }
+  type->object.display[type->object.depth] = type;
+  if (dispatch_size) {
+    type->object.dispatch = dx_memory_allocate(dispatch_size);
+    if (!type->object.dispatch) {
+      _dx_rti_object_type_discard(type);
+      type = NULL;
+      return NULL;
     }
-    _dx_rti_type_name_unreference(type->name);
-    type->name = NULL;
-    dx_memory_deallocate(type);
+    dx_memory_zero(type->object.dispatch, dispatch_size);
+    if (parent_dispatch_size) {
+      dx_memory_copy(type->object.dispatch, _DX_RTI_TYPE(parent)->object.dispatch, parent_dispatch_size);
+    }
+    if (construct_dispatch) {
+      construct_dispatch(type->object.dispatch);
+    }
+  }
+  return type;
+}
+
+// Add an object type to the type registry.
+// If a type of the same name was created with the same on_type_destroyed callback,
+// then the object type is discarded and that type is returned.
+// Must be invoked while holding g_types_lock exclusively.
+static dx_rti_type* _dx_rti_object_type_add(_dx_rti_type* type, char const* p, dx_size n) {
+  _dx_rti_type* existing = dx_pointer_hashmap_get(g_types, type->name);
+  if (existing && existing->on_type_destroyed == type->on_type_destroyed) {
+    // The type was created by a concurrent invocation of the same type definition.
+    _dx_rti_object_type_discard(type);
+    type = NULL;
+    return (dx_rti_type*)existing;
+  }
+  if (existing) {
+    dx_log("a type of the name `", sizeof("a type of the name `") - 1);
+    dx_log(p, n);
+    dx_log("` already exists", sizeof("` already exists") - 1);
+    dx_set_error(DX_EXISTS);
+    _dx_rti_object_type_discard(type);
+    type = NULL;
+    return NULL;
+  }
+  if (dx_get_error() != DX_NOT_FOUND) {
+    _dx_rti_object_type_discard(type);
+    type = NULL;
+    return NULL;
+  }
+  dx_set_error(DX_NO_ERROR);
+  if (dx_pointer_hashmap_set(g_types, type->name, type)) {
+    _dx_rti_object_type_discard(type);
     type = NULL;
     return NULL;
   }
-  DX_UNREFERENCE(type);
+  _dx_rti_type_unreference(type);
   return (dx_rti_type*)type;
 }
 
+dx_rti_type* dx_rti_create_object(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size, dx_rti_type* parent, void (*destruct)(void*), dx_size dispatch_size, void (*construct_dispatch)(void*)) {
+  // Types outlive any arena.
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  // The dispatch table is constructed without holding the lock.
+  // construct_dispatch may hence create types, for example by invoking *_get_type functions.
+  _dx_rti_type* type = _dx_rti_object_type_create(p, n, on_type_destroyed, value_size, parent, destruct, dispatch_size, construct_dispatch);
+  dx_rti_type* result = NULL;
+  if (type) {
+    AcquireSRWLockExclusive(&g_types_lock);
+    result = _dx_rti_object_type_add(type, p, n);
+    ReleaseSRWLockExclusive(&g_types_lock);
+  }
+  dx_memory_set_current_arena(arena);
+  return result;
+}
+
 static inline bool _dx_rti_type_is_leq(_dx_rti_type* x, _dx_rti_type* y) {
   if (!x || !y) {
     dx_set_error(DX_INVALID_ARGUMENT);
@@ -297,36 +513,89 @@ static inline bool _dx_rti_type_is_leq(_dx_rti_type* x, _dx_rti_type* y) {
   }
   // Otherwise x is an object type.
   // It can be lower than or equal to y only if y is also an object type.
-  if (0 == (x->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT)) {
+  if (0 == (x->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT) || 0 == (y->flags & _DX_RTI_TYPE_NODE_FLAGS_OBJECT)) {
     return false;
   }
-  _dx_rti_type* z = x;
-  do {
-    if (z == y) {
-      return true;
-    }
-    z = _DX_RTI_TYPE(z->object.parent);
-  } while (z != NULL);
-  return false;
+  // x is lower than or equal to y if y is the ancestor of x at the depth of y.
+  dx_size depth = y->object.depth;
+  return depth <= x->object.depth && x->object.display[depth] == y;
 }
 
 bool dx_rti_type_is_leq(dx_rti_type* x, dx_rti_type* y) {
   return _dx_rti_type_is_leq(_DX_RTI_TYPE(x), _DX_RTI_TYPE(y));
 }
 
+void* dx_rti_type_get_dispatch(dx_rti_type* type) {
+  return _DX_RTI_TYPE(type)->object.dispatch;
+}
+
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+
+// Pop an object from the pool of the specified type.
+// Return a null pointer if the pool is empty.
+static void* _dx_rti_type_pool_pop(_dx_rti_type* type) {
+  _dx_rti_type_pool* pool = &type->object.pool;
+  AcquireSRWLockExclusive(&pool->lock);
+  pool->enabled = true;
+  _dx_rti_type_pool_entry* entry = pool->head;
+  if (entry) {
+    pool->head = entry->next;
+    pool->population--;
+  }
+  ReleaseSRWLockExclusive(&pool->lock);
+  return entry;
+}
+
+// Push an object to the pool of the specified type.
+// Return @a false if the pool is disabled or full.
+static bool _dx_rti_type_pool_push(_dx_rti_type* type, void* p) {
+  _dx_rti_type_pool* pool = &type->object.pool;
+  bool pushed = false;
+  AcquireSRWLockExclusive(&pool->lock);
+  if (pool->enabled && pool->population < _DX_RTI_TYPE_POOL_CAPACITY) {
+    _dx_rti_type_pool_entry* entry = (_dx_rti_type_pool_entry*)p;
+    entry->next = pool->head;
+    pool->head = entry;
+    pool->population++;
+    if (pool->high_water_mark < pool->population) {
+      pool->high_water_mark = pool->population;
+    }
+    pushed = true;
+  }
+  ReleaseSRWLockExclusive(&pool->lock);
+  return pushed;
+}
+
+#endif // DX_OBJECT_POOLS_ENABLED
+
+int dx_rti_type_get_pool_statistics(dx_rti_type* type, dx_size* population, dx_size* high_water_mark) {
+  if (!type || !population || !high_water_mark || !dx_rti_type_is_object(type)) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  _dx_rti_type_pool* pool = &_DX_RTI_TYPE(type)->object.pool;
+  AcquireSRWLockShared(&pool->lock);
+  *population = pool->population;
+  *high_water_mark = pool->high_water_mark;
+  ReleaseSRWLockShared(&pool->lock);
+  return 0;
+}
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-static dx_rti_type* g_dx_object_type = NULL;
+static dx_rti_type* volatile g_dx_object_type = NULL;
 
 static void dx_object_on_type_destroyed() {
   g_dx_object_type = NULL;
 }
 
 dx_rti_type* dx_object_get_type() {
-  if (!g_dx_object_type) {
-    g_dx_object_type = dx_rti_create_object("dx.object", sizeof("dx.object") - 1, &dx_object_on_type_destroyed, sizeof(dx_object), NULL, NULL); \
+  dx_rti_type* type = g_dx_object_type;
+  if (!type) {
+    type = dx_rti_create_object("dx.object", sizeof("dx.object") - 1, &dx_object_on_type_destroyed, sizeof(dx_object), NULL, NULL, 0, NULL);
+    g_dx_object_type = type;
   }
-  return g_dx_object_type;
+  return type;
 }
 
 void DX_DEBUG_CHECK_MAGIC_BYTES(void* p) {
@@ -340,7 +609,30 @@ void DX_DEBUG_CHECK_MAGIC_BYTES(void* p) {
 #endif
 }
 
-dx_object* dx_object_alloc(dx_size size) {
+static inline void _dx_object_initialize(dx_object* object, dx_rti_type* type) {
+  object->reference_count = 1;
+  object->type = type;
+#if _DEBUG && 1 == DX_OBJECT_WITH_MAGIC_BYTES
+  object->magic_bytes[0] = 66;
+  object->magic_bytes[1] = 12;
+  object->magic_bytes[2] = 19;
+  object->magic_bytes[3] = 82;
+#endif
+}
+
+static inline void* _dx_object_allocate(dx_size size, char const* file, int line) {
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  void* object = dx_memory_allocate_at(size, file, line);
+  if (object) {
+    dx_memory_profiler_mark_object(object);
+  }
+  return object;
+#else
+  return (dx_memory_allocate)(size);
+#endif
+}
+
+dx_object* dx_object_alloc_at(dx_size size, char const* file, int line) {
   if (size < sizeof(dx_object)) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return NULL;
@@ -349,39 +641,439 @@ dx_object* dx_object_alloc(dx_size size) {
   if (!type) {
     return NULL;
   }
-  dx_object* object = dx_memory_allocate(size);
+  dx_object* object = _dx_object_allocate(size, file, line);
   if (!object) {
     return NULL;
   }
-  object->reference_count = 1;
-  object->type = type;
-#if _DEBUG && 1 == DX_OBJECT_WITH_MAGIC_BYTES
-  object->magic_bytes[0] = 66;
-  object->magic_bytes[1] = 12;
-  object->magic_bytes[2] = 19;
-  object->magic_bytes[3] = 82;
+  _dx_object_initialize(object, type);
+  return object;
+}
+
+dx_object* (dx_object_alloc)(dx_size size) {
+  return dx_object_alloc_at(size, NULL, 0);
+}
+
+dx_object* dx_object_alloc_pooled_at(dx_rti_type* type, char const* file, int line) {
+  if (!type || !dx_rti_type_is_object(type)) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return NULL;
+  }
+  dx_rti_type* object_type = dx_object_get_type();
+  if (!object_type) {
+    return NULL;
+  }
+  dx_object* object = NULL;
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+  object = _dx_rti_type_pool_pop(_DX_RTI_TYPE(type));
+#endif
+  if (!object) {
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+    // Objects of pooled types are reused through the pool of their type, hence they are not allocated from the current arena.
+    dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+    object = _dx_object_allocate(_DX_RTI_TYPE(type)->object.value_size, file, line);
+    dx_memory_set_current_arena(arena);
+    if (object) {
+      dx_memory_mark_pooled_block(object);
+    }
+#else
+    object = _dx_object_allocate(_DX_RTI_TYPE(type)->object.value_size, file, line);
 #endif
+    if (!object) {
+      return NULL;
+    }
+  }
+  _dx_object_initialize(object, object_type);
   return object;
 }
 
+dx_object* (dx_object_alloc_pooled)(dx_rti_type* type) {
+  return dx_object_alloc_pooled_at(type, NULL, 0);
+}
+
+// Assert that a thread-confined object is accessed by the thread which marked it as thread-confined.
+#if _DEBUG && 1 == DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED
+  #define DX_DEBUG_CHECK_OWNER_THREAD(object) DX_DEBUG_ASSERT((object)->owner_thread == GetCurrentThreadId())
+#else
+  #define DX_DEBUG_CHECK_OWNER_THREAD(object)
+#endif
+
+int dx_object_set_thread_confined(dx_object* object, dx_bool thread_confined) {
+  if (!object) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  DX_DEBUG_CHECK_MAGIC_BYTES(object);
+#if defined(DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED) && 1 == DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED
+  // The reference count of a thread-confined object is stored negated.
+  // The sign of the reference count does not change while the object is alive,
+  // hence it can be tested non-atomically.
+  if (thread_confined != (object->reference_count < 0)) {
+    if (thread_confined) {
+#if _DEBUG
+      object->owner_thread = GetCurrentThreadId();
+#endif
+    } else {
+      // Only the owner thread may mark a thread-confined object as shared.
+      DX_DEBUG_CHECK_OWNER_THREAD(object);
+    }
+    object->reference_count = -object->reference_count;
+  }
+#endif
+  return 0;
+}
+
 void dx_object_reference(dx_object *object) {
   DX_DEBUG_CHECK_MAGIC_BYTES(object);
+#if defined(DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED) && 1 == DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED
+  if (object->reference_count < 0) {
+    DX_DEBUG_CHECK_OWNER_THREAD(object);
+    --object->reference_count;
+    return;
+  }
+#endif
   dx_reference_counter_increment(&object->reference_count);
 }
 
+static inline dx_reference_counter _dx_object_decrement(dx_object* object) {
+#if defined(DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED) && 1 == DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED
+  if (object->reference_count < 0) {
+    DX_DEBUG_CHECK_OWNER_THREAD(object);
+    return -(++object->reference_count);
+  }
+#endif
+  return dx_reference_counter_decrement(&object->reference_count);
+}
+
+// Run the destructors of an object and deallocate the object.
+static void _dx_object_destroy(dx_object* object) {
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+  _dx_rti_type* dynamic_type = (_dx_rti_type*)object->type;
+#endif
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  if (object->type) {
+    _dx_rti_type_name* name = ((_dx_rti_type*)object->type)->name;
+    dx_memory_profiler_on_object_destroyed(object, name->bytes, name->number_of_bytes);
+  }
+#endif
+  while (object->type) {
+    _dx_rti_type* type = (_dx_rti_type*)object->type;
+    if (type->object.destruct) {
+      type->object.destruct(object);
+    }
+    object->type = (dx_rti_type*)type->object.parent;
+  }
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+  // Only objects allocated by dx_object_alloc_pooled are pooled:
+  // These are at least as big as a value of their dynamic type and are never allocated from an arena.
+  if (dynamic_type && dx_memory_is_pooled_block(object) && _dx_rti_type_pool_push(dynamic_type, object)) {
+    object = NULL;
+    return;
+  }
+#endif
+  dx_memory_deallocate(object);
+  object = NULL;
+}
+
+// The per-thread queue of objects of which the reference count dropped to zero but which are not destroyed yet.
+// Destructors unreferencing objects only enqueue these objects such that the destruction of deep object graphs
+// is iterative and not recursive.
+typedef struct _dx_object_destruction_queue {
+  /// @brief Is the queue being drained?
+  dx_bool draining;
+  /// @brief Is destruction deferred until dx_object_destroy_pending is invoked?
+  dx_bool deferred;
+  /// @brief The number of objects in the queue.
+  dx_size size;
+  /// @brief The first object in the queue or the null pointer.
+  /// The reference count of an object in the queue stores a pointer to the next object in the queue.
+  dx_object* head;
+} _dx_object_destruction_queue;
+
+static DX_THREAD_LOCAL() _dx_object_destruction_queue g_destruction_queue = { .draining = false, .deferred = false, .size = 0, .head = NULL };
+
+static_assert(sizeof(dx_reference_counter) == sizeof(dx_object*), "reference counter can not store a pointer");
+
+static inline void _dx_object_destruction_queue_push(dx_object* object) {
+  object->reference_count = (dx_reference_counter)(intptr_t)g_destruction_queue.head;
+  g_destruction_queue.head = object;
+  g_destruction_queue.size++;
+}
+
+static dx_size _dx_object_destruction_queue_drain(dx_size n) {
+  dx_size i = 0;
+  g_destruction_queue.draining = true;
+  while (g_destruction_queue.head && i < n) {
+    dx_object* object = g_destruction_queue.head;
+    g_destruction_queue.head = (dx_object*)(intptr_t)object->reference_count;
+    g_destruction_queue.size--;
+    object->reference_count = 0;
+    _dx_object_destroy(object);
+    i++;
+  }
+  g_destruction_queue.draining = false;
+  return i;
+}
+
 void dx_object_unreference(dx_object* object) {
   DX_DEBUG_CHECK_MAGIC_BYTES(object);
-  if (!dx_reference_counter_decrement(&object->reference_count)) {
-    while (object->type) {
-      _dx_rti_type* type = (_dx_rti_type*)object->type;
-      if (type->object.destruct) {
-        type->object.destruct(object);
-      }
-      object->type = (dx_rti_type*)type->object.parent;
+  if (!_dx_object_decrement(object)) {
+    _dx_object_destruction_queue_push(object);
+    if (!g_destruction_queue.draining && !g_destruction_queue.deferred) {
+      _dx_object_destruction_queue_drain(DX_SIZE_GREATEST);
     }
-    dx_memory_deallocate(object);
+  }
+}
+
+void dx_object_set_destruction_deferred(dx_bool deferred) {
+  g_destruction_queue.deferred = deferred;
+  if (!deferred && !g_destruction_queue.draining) {
+    _dx_object_destruction_queue_drain(DX_SIZE_GREATEST);
+  }
+}
+
+dx_size dx_object_destroy_pending(dx_size n) {
+  if (g_destruction_queue.draining) {
+    return 0;
+  }
+  return _dx_object_destruction_queue_drain(n);
+}
+
+dx_size dx_object_get_number_of_pending_objects() {
+  return g_destruction_queue.size;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#if defined(DX_OBJECT_WITH_TESTS) && 1 == DX_OBJECT_WITH_TESTS
+
+// The number of references acquired and relinquished by a reference counting test.
+#define _DX_OBJECT_TESTS_NUMBER_OF_REFERENCES (1024 * 1024)
+
+// Acquire and relinquish references to an object which is thread-confined or not.
+// If DX_OBJECT_WITH_BENCHMARKS is enabled, then the time is reported.
+static int _dx_object_test_reference_counting(dx_bool thread_confined, char const* name) {
+  dx_object* object = dx_object_alloc(sizeof(dx_object));
+  if (!object) {
+    return 1;
+  }
+  if (dx_object_set_thread_confined(object, thread_confined)) {
+    DX_UNREFERENCE(object);
     object = NULL;
+    return 1;
+  }
+#if defined(DX_OBJECT_WITH_BENCHMARKS) && 1 == DX_OBJECT_WITH_BENCHMARKS
+  dx_n64 start = dx_os_get_time_ns();
+#endif
+  for (dx_size i = 0; i < _DX_OBJECT_TESTS_NUMBER_OF_REFERENCES; ++i) {
+    dx_object_reference(object);
   }
+  for (dx_size i = 0; i < _DX_OBJECT_TESTS_NUMBER_OF_REFERENCES; ++i) {
+    dx_object_unreference(object);
+  }
+#if defined(DX_OBJECT_WITH_BENCHMARKS) && 1 == DX_OBJECT_WITH_BENCHMARKS
+  dx_n64 time = dx_os_get_time_ns() - start;
+#endif
+  // Exactly the reference acquired by dx_object_alloc must be left.
+  dx_reference_counter reference_count = object->reference_count < 0 ? -object->reference_count : object->reference_count;
+  DX_UNREFERENCE(object);
+  object = NULL;
+  if (1 != reference_count) {
+    return 1;
+  }
+#if defined(DX_OBJECT_WITH_BENCHMARKS) && 1 == DX_OBJECT_WITH_BENCHMARKS
+  dx_log_benchmark(name, time, 2 * _DX_OBJECT_TESTS_NUMBER_OF_REFERENCES);
+#endif
+  return 0;
 }
 
+// The depth of the type hierarchy of the subtype test.
+#define _DX_OBJECT_TESTS_HIERARCHY_DEPTH (16)
+
+// The number of times each pair of types is tested by the subtype test benchmark.
+#define _DX_OBJECT_TESTS_NUMBER_OF_SUBTYPE_TESTS (16 * 1024)
+
+static void _dx_object_tests_on_type_destroyed()
+{/*Intentionally empty.*/}
+
+static void _dx_object_tests_destruct(void* p)
+{/*Intentionally empty.*/}
+
+// The subtype test as it was implemented before types stored their ancestors:
+// Walk the chain of parents of x until y is found.
+static bool _dx_object_tests_is_leq_by_parents(_dx_rti_type* x, _dx_rti_type* y) {
+  while (x) {
+    if (x == y) {
+      return true;
+    }
+    x = x->object.parent;
+  }
+  return false;
+}
+
+// Create a chain of types below dx_object and compare the subtype test against walking the chain of parents.
+// If DX_OBJECT_WITH_BENCHMARKS is enabled, then the time of both is reported.
+static int _dx_object_test_is_leq() {
+  _dx_rti_type* types[_DX_OBJECT_TESTS_HIERARCHY_DEPTH + 1];
+  types[0] = _DX_RTI_TYPE(dx_object_get_type());
+  if (!types[0]) {
+    return 1;
+  }
+  for (dx_size i = 1; i <= _DX_OBJECT_TESTS_HIERARCHY_DEPTH; ++i) {
+    char name[] = "dx.object_tests.type_00";
+    name[sizeof(name) - 3] = '0' + (char)(i / 10);
+    name[sizeof(name) - 2] = '0' + (char)(i % 10);
+    types[i] = _DX_RTI_TYPE(dx_rti_create_object(name, sizeof(name) - 1, &_dx_object_tests_on_type_destroyed, sizeof(dx_object),
+                                                 (dx_rti_type*)types[i - 1], &_dx_object_tests_destruct, 0, NULL));
+    if (!types[i]) {
+      return 1;
+    }
+  }
+  for (dx_size i = 0; i <= _DX_OBJECT_TESTS_HIERARCHY_DEPTH; ++i) {
+    for (dx_size j = 0; j <= _DX_OBJECT_TESTS_HIERARCHY_DEPTH; ++j) {
+      if (_dx_rti_type_is_leq(types[i], types[j]) != (j <= i)) {
+        return 1;
+      }
+      if (_dx_object_tests_is_leq_by_parents(types[i], types[j]) != (j <= i)) {
+        return 1;
+      }
+    }
+  }
+#if defined(DX_OBJECT_WITH_BENCHMARKS) && 1 == DX_OBJECT_WITH_BENCHMARKS
+  _dx_rti_type* volatile deepest = types[_DX_OBJECT_TESTS_HIERARCHY_DEPTH];
+  dx_size volatile number_of_subtypes = 0;
+  dx_size const number_of_operations = _DX_OBJECT_TESTS_NUMBER_OF_SUBTYPE_TESTS * (_DX_OBJECT_TESTS_HIERARCHY_DEPTH + 1);
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size k = 0; k < _DX_OBJECT_TESTS_NUMBER_OF_SUBTYPE_TESTS; ++k) {
+    for (dx_size j = 0; j <= _DX_OBJECT_TESTS_HIERARCHY_DEPTH; ++j) {
+      number_of_subtypes += _dx_rti_type_is_leq(deepest, types[j]);
+    }
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  dx_log_benchmark("dx_rti_type_is_leq (ancestor display)", time, number_of_operations);
+  start = dx_os_get_time_ns();
+  for (dx_size k = 0; k < _DX_OBJECT_TESTS_NUMBER_OF_SUBTYPE_TESTS; ++k) {
+    for (dx_size j = 0; j <= _DX_OBJECT_TESTS_HIERARCHY_DEPTH; ++j) {
+      number_of_subtypes += _dx_object_tests_is_leq_by_parents(deepest, types[j]);
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  dx_log_benchmark("dx_rti_type_is_leq (chain of parents)", time, number_of_operations);
+  if (number_of_subtypes != 2 * number_of_operations) {
+    return 1;
+  }
+#endif
+  return 0;
+}
+
+static dx_rti_type* g_dx_object_tests_nested_type = NULL;
+
+// Creates a type such that the test can verify that construct_dispatch may create types.
+static void _dx_object_tests_construct_dispatch(void* p) {
+  g_dx_object_tests_nested_type = dx_rti_create_fundamental("dx.object_tests.nested", sizeof("dx.object_tests.nested") - 1,
+                                                            &_dx_object_tests_on_type_destroyed, sizeof(dx_size));
+}
+
+// Verify that the type creation functions return the created type,
+// that creating a type of the same definition again returns the same type,
+// and that construct_dispatch may create types.
+static int _dx_object_test_create_types() {
+  dx_rti_type* a = dx_rti_create_fundamental("dx.object_tests.fundamental", sizeof("dx.object_tests.fundamental") - 1,
+                                             &_dx_object_tests_on_type_destroyed, sizeof(dx_size));
+  if (!a || !dx_rti_type_is_fundamental(a)) {
+    return 1;
+  }
+  if (a != dx_rti_create_fundamental("dx.object_tests.fundamental", sizeof("dx.object_tests.fundamental") - 1,
+                                     &_dx_object_tests_on_type_destroyed, sizeof(dx_size))) {
+    return 1;
+  }
+  dx_rti_type* b = dx_rti_create_enumeration("dx.object_tests.enumeration", sizeof("dx.object_tests.enumeration") - 1,
+                                             &_dx_object_tests_on_type_destroyed);
+  if (!b || !dx_rti_type_is_enumeration(b)) {
+    return 1;
+  }
+  if (b != dx_rti_create_enumeration("dx.object_tests.enumeration", sizeof("dx.object_tests.enumeration") - 1,
+                                     &_dx_object_tests_on_type_destroyed)) {
+    return 1;
+  }
+  dx_rti_type* c = dx_rti_create_object("dx.object_tests.object", sizeof("dx.object_tests.object") - 1,
+                                        &_dx_object_tests_on_type_destroyed, sizeof(dx_object), dx_object_get_type(),
+                                        &_dx_object_tests_destruct, sizeof(dx_size), &_dx_object_tests_construct_dispatch);
+  if (!c || !dx_rti_type_is_object(c) || !g_dx_object_tests_nested_type) {
+    return 1;
+  }
+  if (c != dx_rti_create_object("dx.object_tests.object", sizeof("dx.object_tests.object") - 1,
+                                &_dx_object_tests_on_type_destroyed, sizeof(dx_object), dx_object_get_type(),
+                                &_dx_object_tests_destruct, sizeof(dx_size), &_dx_object_tests_construct_dispatch)) {
+    return 1;
+  }
+  return 0;
+}
+
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+// Verify that objects allocated by dx_object_alloc_pooled are returned to the pool of their type
+// and that other objects of that type are not.
+static int _dx_object_test_pool() {
+  dx_rti_type* type = dx_rti_create_object("dx.object_tests.pooled", sizeof("dx.object_tests.pooled") - 1,
+                                           &_dx_object_tests_on_type_destroyed, sizeof(dx_object), dx_object_get_type(),
+                                           &_dx_object_tests_destruct, 0, NULL);
+  if (!type) {
+    return 1;
+  }
+  dx_size population, high_water_mark;
+  dx_object* object = dx_object_alloc_pooled(type);
+  if (!object) {
+    return 1;
+  }
+  object->type = type;
+  dx_object* pooled = object;
+  DX_UNREFERENCE(object);
+  object = NULL;
+  if (dx_rti_type_get_pool_statistics(type, &population, &high_water_mark) || 1 != population) {
+    return 1;
+  }
+  object = dx_object_alloc_pooled(type);
+  if (object != pooled) {
+    return 1;
+  }
+  object->type = type;
+  DX_UNREFERENCE(object);
+  object = NULL;
+  // An object of the same type which was not allocated by dx_object_alloc_pooled.
+  object = dx_object_alloc(sizeof(dx_object));
+  if (!object) {
+    return 1;
+  }
+  object->type = type;
+  DX_UNREFERENCE(object);
+  object = NULL;
+  if (dx_rti_type_get_pool_statistics(type, &population, &high_water_mark) || 1 != population) {
+    return 1;
+  }
+  return 0;
+}
+#endif
+
+int dx_object_tests() {
+  if (_dx_object_test_create_types()) {
+    return 1;
+  }
+#if defined(DX_OBJECT_POOLS_ENABLED) && 1 == DX_OBJECT_POOLS_ENABLED
+  if (_dx_object_test_pool()) {
+    return 1;
+  }
+#endif
+  if (_dx_object_test_reference_counting(false, "dx_object reference counting")) {
+    return 1;
+  }
+  if (_dx_object_test_reference_counting(true, "dx_object reference counting (thread-confined)")) {
+    return 1;
+  }
+  if (_dx_object_test_is_leq()) {
+    return 1;
+  }
+  return 0;
+}
+
+#endif // DX_OBJECT_WITH_TESTS
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
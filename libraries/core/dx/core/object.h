@@ -52,17 +52,19 @@ dx_rti_type* dx_rti_create_fundamental(char const *p, dx_size n, void(*on_type_d
   dx_rti_type* C_NAME##_get_type(); \
 
 #define DX_DEFINE_FUNDAMENTAL_TYPE(NAME, C_NAME) \
-  static dx_rti_type* _##C_NAME##_type = NULL; \
+  static dx_rti_type* volatile _##C_NAME##_type = NULL; \
 \
   static void C_NAME##_on_type_destroyed() { \
     _##C_NAME##_type = NULL; \
   } \
 \
   dx_rti_type* C_NAME##_get_type() { \
-    if (!_##C_NAME##_type) { \
-      _##C_NAME##_type = dx_rti_create_fundamental(NAME, sizeof(NAME) - 1, &C_NAME##_on_type_destroyed, value_size); \
+    dx_rti_type* type = _##C_NAME##_type; \
+    if (!type) { \
+      type = dx_rti_create_fundamental(NAME, sizeof(NAME) - 1, &C_NAME##_on_type_destroyed, value_size); \
+      _##C_NAME##_type = type; \
     } \
-    return _##C_NAME##_type; \
+    return type; \
   }
 
 /// @brief Used to register enumeration types.
@@ -81,23 +83,33 @@ dx_rti_type* dx_rti_create_enumeration(char const* p, dx_size n, void(*on_type_d
   typedef enum C_NAME C_NAME;
 
 #define DX_DEFINE_ENUMERATION_TYPE(NAME, C_NAME) \
-  static dx_rti_type* _##C_NAME##_type = NULL; \
+  static dx_rti_type* volatile _##C_NAME##_type = NULL; \
 \
   static void C_NAME##_on_type_destroyed() { \
     _##C_NAME##_type = NULL; \
   } \
 \
   dx_rti_type* C_NAME##_get_type() { \
-    if (!_##C_NAME##_type) { \
-      _##C_NAME##_type = dx_rti_create_enumeration(NAME, sizeof(NAME) - 1, &C_NAME##_on_type_destroyed); \
+    dx_rti_type* type = _##C_NAME##_type; \
+    if (!type) { \
+      type = dx_rti_create_enumeration(NAME, sizeof(NAME) - 1, &C_NAME##_on_type_destroyed); \
+      _##C_NAME##_type = type; \
     } \
-    return _##C_NAME##_type; \
+    return type; \
   }
 
 /// @brief Used to register object types.
 /// @param p, n An UTF-8 string. Must be a valid type name.
 /// @param parent A pointer to the parent type or a null pointer.
 /// @param value_size The value size.
+/// @param dispatch_size The size of the dispatch table of the type or @a 0.
+/// If this is @a 0, then the type inherits the dispatch table of its parent type.
+/// Otherwise it must be greater than or equal to the size of the dispatch table of the parent type.
+/// @param construct_dispatch A pointer to a function constructing the dispatch table of the type or the null pointer.
+/// The function is invoked on a dispatch table which is a copy of the dispatch table of the parent type
+/// in which the remaining Bytes are zeroed.
+/// The function overrides methods inherited from the parent type and assigns methods introduced by the type.
+/// The function is invoked without holding the lock of the type registry and may create types.
 /// @return A pointer to the dx_rti_type object representing the type on success. The null pointer on failure.
 /// @undefined The runtime type system is not initialized.
 /// @undefined @a p/@a n is not a valid type name.
@@ -105,14 +117,21 @@ dx_rti_type* dx_rti_create_enumeration(char const* p, dx_size n, void(*on_type_d
 /// In particular, the following error codes are returned:
 /// - #DX_ALLOCATION_FAILED an allocation failed
 /// - #DX_EXISTS a type of the same name already exists
-dx_rti_type* dx_rti_create_object(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size, dx_rti_type* parent, void (*destruct)(void*));
+/// - #DX_INVALID_ARGUMENT @a dispatch_size is smaller than the size of the dispatch table of the parent type
+/// @remarks
+/// dx_rti_create_fundamental, dx_rti_create_enumeration, and dx_rti_create_object may be invoked concurrently.
+/// If a type of the same name was created with the same @a on_type_destroyed callback,
+/// then that type is returned instead of failing with #DX_EXISTS.
+/// Hence the <code>*_get_type</code> functions generated by the DX_DEFINE_*_TYPE macros are thread-safe.
+/// They read the type without synchronization once it is created.
+dx_rti_type* dx_rti_create_object(char const* p, dx_size n, void (*on_type_destroyed)(), dx_size value_size, dx_rti_type* parent, void (*destruct)(void*), dx_size dispatch_size, void (*construct_dispatch)(void*));
 
 #define DX_DECLARE_OBJECT_TYPE(NAME, C_NAME, C_PARENT_NAME) \
   dx_rti_type* C_NAME##_get_type(); \
   typedef struct C_NAME C_NAME;
 
-#define DX_DEFINE_OBJECT_TYPE(NAME, C_NAME, C_PARENT_NAME) \
-  static dx_rti_type* _##C_NAME##_type = NULL; \
+#define _DX_DEFINE_OBJECT_TYPE(NAME, C_NAME, C_PARENT_NAME, DISPATCH_SIZE, CONSTRUCT_DISPATCH) \
+  static dx_rti_type* volatile _##C_NAME##_type = NULL; \
 \
   /** @todo Should be static. To be defined by the developer.*/ \
   void C_NAME##_destruct(C_NAME* self); \
@@ -122,16 +141,31 @@ dx_rti_type* dx_rti_create_object(char const* p, dx_size n, void (*on_type_destr
   } \
 \
   dx_rti_type* C_NAME##_get_type() { \
-    if (!_##C_NAME##_type) { \
+    dx_rti_type* type = _##C_NAME##_type; \
+    if (!type) { \
       dx_rti_type* parent = C_PARENT_NAME##_get_type(); \
       if (!parent) { \
         return NULL; \
       } \
-      _##C_NAME##_type = dx_rti_create_object(NAME, sizeof(NAME) - 1, &C_NAME##_on_type_destroyed, sizeof(C_NAME), parent, (void(*)(void*))&C_NAME##_destruct); \
+      type = dx_rti_create_object(NAME, sizeof(NAME) - 1, &C_NAME##_on_type_destroyed, sizeof(C_NAME), parent, (void(*)(void*))&C_NAME##_destruct, DISPATCH_SIZE, CONSTRUCT_DISPATCH); \
+      _##C_NAME##_type = type; \
     } \
-    return _##C_NAME##_type; \
+    return type; \
   }
 
+/// @brief Define an object type which inherits the dispatch table of its parent type.
+#define DX_DEFINE_OBJECT_TYPE(NAME, C_NAME, C_PARENT_NAME) \
+  _DX_DEFINE_OBJECT_TYPE(NAME, C_NAME, C_PARENT_NAME, 0, NULL)
+
+/// @brief Define an object type with a dispatch table of type @a C_DISPATCH_NAME.
+/// The developer must define <code>static void C_NAME##_construct_dispatch(C_DISPATCH_NAME* self)</code>
+/// which overrides inherited methods and assigns introduced methods.
+/// @remarks @a C_DISPATCH_NAME must begin with the dispatch table type of the parent type (if any).
+#define DX_DEFINE_OBJECT_TYPE_WITH_DISPATCH(NAME, C_NAME, C_PARENT_NAME, C_DISPATCH_NAME) \
+  static void C_NAME##_construct_dispatch(C_DISPATCH_NAME* self); \
+\
+  _DX_DEFINE_OBJECT_TYPE(NAME, C_NAME, C_PARENT_NAME, sizeof(C_DISPATCH_NAME), (void(*)(void*))&C_NAME##_construct_dispatch)
+
 /// @brief Get if a type is a lower than or equal to another type.
 /// @param x The first type.
 /// @param y The second type.
@@ -141,6 +175,23 @@ dx_rti_type* dx_rti_create_object(char const* p, dx_size n, void (*on_type_destr
 /// @default-failure
 bool dx_rti_type_is_leq(dx_rti_type* x, dx_rti_type* y);
 
+/// @brief Get the statistics of the object pool of an object type.
+/// @param type A pointer to the object type.
+/// @param population A pointer to a dx_size variable.
+/// @param high_water_mark A pointer to a dx_size variable.
+/// @return The zero value on success. A non-zero value on failure.
+/// @success
+/// <code>*population</code> was assigned the number of objects currently held by the pool.
+/// <code>*high_water_mark</code> was assigned the greatest number of objects held by the pool so far.
+/// @default-failure
+int dx_rti_type_get_pool_statistics(dx_rti_type* type, dx_size* population, dx_size* high_water_mark);
+
+/// @brief Get the dispatch table of an object type.
+/// @param type A pointer to the object type.
+/// @return A pointer to the dispatch table. The null pointer if the type has no dispatch table.
+/// @undefined @a type does not point to an object type.
+void* dx_rti_type_get_dispatch(dx_rti_type* type);
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /// @brief Get the "DX.Object" type.
@@ -167,6 +218,10 @@ struct dx_object {
 #if _DEBUG && 1 == DX_OBJECT_WITH_MAGIC_BYTES
   char magic_bytes[4];
 #endif
+#if _DEBUG && 1 == DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED
+  /// @brief The identifier of the thread which marked this object as thread-confined.
+  dx_n32 owner_thread;
+#endif
 };
 
 void DX_DEBUG_CHECK_MAGIC_BYTES(void* p);
@@ -182,6 +237,63 @@ void DX_DEBUG_CHECK_MAGIC_BYTES(void* p);
 /// The object is initialized such that <code>dx_object::destructor</code> is assigned a null pointer and <code>dx_object::reference_count</code> is assigned @a 1.
 dx_object* dx_object_alloc(dx_size size);
 
+/// @brief
+/// Allocate a dx_object from the object pool of an object type.
+/// @param type
+/// A pointer to the object type.
+/// The size of the object is the value size of that type.
+/// @return
+/// A pointer to the object on success. A null pointer on failure.
+/// @post
+/// On success, a pointer to dx_object object is returned.
+/// The object is initialized as if it was allocated by dx_object_alloc.
+/// @remarks
+/// The first call to this function enables the object pool of the object type.
+/// Objects of an object type with an enabled object pool are returned to that pool when they are destroyed.
+/// Object pools are only available if DX_OBJECT_POOLS_ENABLED is defined and evaluates to @a 1.
+/// @warning
+/// Objects of that type must not be bigger than the value size of that type.
+dx_object* dx_object_alloc_pooled(dx_rti_type* type);
+
+/// @brief
+/// Allocate a dx_object and attribute the allocation to a call site.
+/// @param size, file, line See dx_object_alloc and dx_memory_allocate_at.
+/// @return
+/// A pointer to the object on success. A null pointer on failure.
+dx_object* dx_object_alloc_at(dx_size size, char const* file, int line);
+
+/// @brief
+/// Allocate a dx_object from the object pool of an object type and attribute the allocation to a call site.
+/// @param type, file, line See dx_object_alloc_pooled and dx_memory_allocate_at.
+/// @return
+/// A pointer to the object on success. A null pointer on failure.
+dx_object* dx_object_alloc_pooled_at(dx_rti_type* type, char const* file, int line);
+
+#if defined(DX_MEMORY_PROFILER_ENABLED) && 1 == DX_MEMORY_PROFILER_ENABLED
+  #define dx_object_alloc(size) dx_object_alloc_at(size, __FILE__, __LINE__)
+  #define dx_object_alloc_pooled(type) dx_object_alloc_pooled_at(type, __FILE__, __LINE__)
+#endif
+
+/// @brief
+/// Mark a dx_object object as thread-confined or as shared.
+/// @param object
+/// A pointer to the dx_object object.
+/// @param thread_confined
+/// @a true to mark the object as thread-confined, @a false to mark it as shared.
+/// @return
+/// The zero value on success. A non-zero value on failure.
+/// @details
+/// Objects are shared when they are created.
+/// The reference count of a thread-confined object is incremented and decremented non-atomically.
+/// If DX_THREAD_CONFINED_REFERENCE_COUNTING_ENABLED is not defined or does not evaluate to @a 1,
+/// then this function has no effect.
+/// @warning
+/// A thread-confined object must only be referenced and unreferenced by the thread which marked it as thread-confined.
+/// That thread must mark the object as shared before the object is passed to another thread.
+/// In debug builds, this is asserted by dx_object_reference and dx_object_unreference.
+/// @default-failure
+int dx_object_set_thread_confined(dx_object* object, dx_bool thread_confined);
+
 /// @brief
 /// Increment the reference count of a dx_object object by @a 1.
 /// @param object
@@ -189,11 +301,40 @@ dx_object* dx_object_alloc(dx_size size);
 void dx_object_reference(dx_object *object);
 
 /// @brief
-/// Increment the reference count of a dx_object object by @a 1.
+/// Decrement the reference count of a dx_object object by @a 1.
 /// @param object
 /// A pointer to the dx_object object.
+/// @remarks
+/// If the reference count drops to zero, then the object is destroyed.
+/// Objects released by destructors are destroyed iteratively and not recursively.
 void dx_object_unreference(dx_object* object);
 
+/// @brief
+/// Set if the destruction of dx_object objects is deferred on the calling thread.
+/// @param deferred
+/// If @a true, then dx_object objects of which the reference count drops to zero on the calling thread
+/// are not destroyed until dx_object_destroy_pending is invoked on the calling thread.
+/// If @a false, then such objects are destroyed immediately and pending objects are destroyed.
+/// @remarks
+/// Use this to move the destruction of large object graphs to a safe point (e.g., the end of a frame)
+/// and to spread it over several frames.
+void dx_object_set_destruction_deferred(dx_bool deferred);
+
+/// @brief
+/// Destroy pending dx_object objects on the calling thread.
+/// @param n
+/// The maximal number of objects to destroy.
+/// Objects released by the destructors of these objects are counted as well.
+/// @return
+/// The number of objects destroyed.
+dx_size dx_object_destroy_pending(dx_size n);
+
+/// @brief
+/// Get the number of pending dx_object objects on the calling thread.
+/// @return
+/// The number of pending objects.
+dx_size dx_object_get_number_of_pending_objects();
+
 static inline void DX_REFERENCE(void *p) {
   dx_object_reference(DX_OBJECT(p));
 }
@@ -202,6 +343,10 @@ static inline void DX_UNREFERENCE(void *p) {
   dx_object_unreference(DX_OBJECT(p));
 }
 
+#if defined(DX_OBJECT_WITH_TESTS) && 1 == DX_OBJECT_WITH_TESTS
+int dx_object_tests();
+#endif
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #endif // DX_CORE_OBJECT_H_INCLUDED
@@ -47,6 +47,48 @@ dx_object_array_ensure_free_capacity
   return dx_pointer_array_ensure_free_capacity(&self->backend, required_free_capacity);
 }
 
+int
+dx_object_array_reserve
+  (
+    dx_object_array* self,
+    dx_size required_capacity
+  )
+{
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dx_pointer_array_reserve(&self->backend, required_capacity);
+}
+
+int
+dx_object_array_shrink_to_fit
+  (
+    dx_object_array* self
+  )
+{
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dx_pointer_array_shrink_to_fit(&self->backend);
+}
+
+int
+dx_object_array_append_range
+  (
+    dx_object_array* self,
+    dx_object* const* pointers,
+    dx_size number_of_pointers
+  )
+{
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dx_pointer_array_append_range(&self->backend, (dx_pointer_array_element const*)pointers, number_of_pointers);
+}
+
 int
 dx_object_array_append
   (
@@ -155,3 +197,17 @@ dx_object_array_clear
   }
   return dx_pointer_array_clear(&self->backend);
 }
+
+int
+dx_object_array_sort
+  (
+    dx_object_array* self,
+    dx_compare_callback* compare
+  )
+{
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dx_pointer_array_sort(&self->backend, compare);
+}
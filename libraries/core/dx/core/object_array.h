@@ -60,6 +60,51 @@ dx_object_array_ensure_free_capacity
     dx_size required_free_capacity
   );
 
+/// @brief Ensure the capacity is greater than or equal to a specified value.
+/// @param self A pointer to this dx_object_array object.
+/// @param required_capacity The required capacity.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED @a required_capacity is too big
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int
+dx_object_array_reserve
+  (
+    dx_object_array* self,
+    dx_size required_capacity
+  );
+
+/// @brief Decrease the capacity to the size (or to DX_POINTER_ARRAY_INLINE_CAPACITY if the size is smaller).
+/// @param self A pointer to this dx_object_array object.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int
+dx_object_array_shrink_to_fit
+  (
+    dx_object_array* self
+  );
+
+/// @brief Append elements.
+/// @param self A pointer to this dx_object_array object.
+/// @param pointers A pointer to an array of @a number_of_pointers elements.
+/// @param number_of_pointers The number of elements in the array pointed to by @a pointers.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_INVALID_ARGUMENT @a pointers is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks The capacity is increased at most once.
+int
+dx_object_array_append_range
+  (
+    dx_object_array* self,
+    dx_object* const* pointers,
+    dx_size number_of_pointers
+  );
+
 /// @brief Append an element.
 /// @param self A pointer to this dx_object_array object.
 /// @param pointer The element.
@@ -165,4 +210,20 @@ dx_object_array_clear
     dx_object_array* self
   );
 
+/// @brief Sort the elements.
+/// @param self A pointer to this dx_object_array object.
+/// @param compare A pointer to a function comparing two elements.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_INVALID_ARGUMENT @a compare is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks See dx_pointer_array_sort.
+int
+dx_object_array_sort
+  (
+    dx_object_array* self,
+    dx_compare_callback* compare
+  );
+
 #endif // DX_CORE_OBJECT_ARRAY_H_INCLUDED
@@ -5,7 +5,7 @@
 #include "dx/core/memory.h"
 #include "dx/core/safe_add_nx.h"
 
-// SYSTEM_INFO, GetSystemInfo
+// SYSTEM_INFO, GetSystemInfo, QueryPerformanceCounter, QueryPerformanceFrequency
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 
@@ -31,6 +31,18 @@ dx_size dx_os_get_number_of_cores() {
   return (dx_size)system_info.dwNumberOfProcessors;
 }
 
+dx_n64 dx_os_get_time_ns() {
+  LARGE_INTEGER frequency, counter;
+  if (!QueryPerformanceFrequency(&frequency) || !QueryPerformanceCounter(&counter)) {
+    dx_set_error(DX_ENVIRONMENT_FAILED);
+    return 0;
+  }
+  // Split the counter into seconds and a remainder such that the multiplication does not overflow.
+  dx_n64 seconds = (dx_n64)counter.QuadPart / (dx_n64)frequency.QuadPart;
+  dx_n64 remainder = (dx_n64)counter.QuadPart % (dx_n64)frequency.QuadPart;
+  return seconds * UINT64_C(1000000000) + (remainder * UINT64_C(1000000000)) / (dx_n64)frequency.QuadPart;
+}
+
 dx_string* dx_os_get_executable_path() {
   HMODULE module = GetModuleHandleA(NULL);
   if (!module) {
@@ -23,6 +23,13 @@ dx_size dx_os_get_number_of_cores();
 /// @success The caller acquired a reference to the string.
 dx_string* dx_os_get_executable_path();
 
+/// @ingroup os
+/// @brief Get the value of a monotonic clock.
+/// @return The value, in nanoseconds, on success. @a 0 on failure.
+/// @remarks Only differences between values of this clock are meaningful.
+/// @default-failure
+dx_n64 dx_os_get_time_ns();
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #endif // DX_CORE_OS_H_INCLUDED
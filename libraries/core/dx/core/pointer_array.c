@@ -61,15 +61,20 @@ dx_pointer_array_initialize
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  dx_size overflow;
-  dx_size initial_capacity_bytes = dx_mul_sz(initial_capacity, sizeof(dx_pointer_array_element), &overflow);
-  if (overflow) {
-    dx_set_error(DX_ALLOCATION_FAILED);
-    return 1;  
-  }
-  void **elements = dx_memory_allocate(initial_capacity_bytes);
-  if (!elements) {
-    return 1;
+  void **elements = self->inline_elements;
+  if (initial_capacity > DX_POINTER_ARRAY_INLINE_CAPACITY) {
+    dx_size overflow;
+    dx_size initial_capacity_bytes = dx_mul_sz(initial_capacity, sizeof(dx_pointer_array_element), &overflow);
+    if (overflow) {
+      dx_set_error(DX_ALLOCATION_FAILED);
+      return 1;  
+    }
+    elements = dx_memory_allocate(initial_capacity_bytes);
+    if (!elements) {
+      return 1;
+    }
+  } else {
+    initial_capacity = DX_POINTER_ARRAY_INLINE_CAPACITY;
   }
  self->size = 0;
  self->elements = elements;
@@ -86,7 +91,9 @@ dx_pointer_array_uninitialize
   )
 {
   dx_pointer_array_clear(self);
-  dx_memory_deallocate(self->elements);
+  if (self->elements != self->inline_elements) {
+    dx_memory_deallocate(self->elements);
+  }
   self->elements = NULL;
   self->capacity = 0;
 }
@@ -116,9 +123,18 @@ dx_pointer_array_increase_capacity
     dx_set_error(DX_ALLOCATION_FAILED);
     return 1;  
   }
-  dx_pointer_array_element *new_elements = dx_memory_reallocate(self->elements, new_capacity_bytes);
-  if (!new_elements) {
-    return 1;    
+  dx_pointer_array_element *new_elements = NULL;
+  if (self->elements == self->inline_elements) {
+    new_elements = dx_memory_allocate(new_capacity_bytes);
+    if (!new_elements) {
+      return 1;
+    }
+    dx_memory_copy(new_elements, self->inline_elements, self->size * sizeof(dx_pointer_array_element));
+  } else {
+    new_elements = dx_memory_reallocate(self->elements, new_capacity_bytes);
+    if (!new_elements) {
+      return 1;    
+    }
   }
   self->capacity = new_capacity;
   self->elements = new_elements;
@@ -137,13 +153,85 @@ dx_pointer_array_ensure_free_capacity
     return 1;   
   }
   dx_size available_free_capacity = self->capacity - self->size;
-  if (available_free_capacity > required_free_capacity) {
+  if (available_free_capacity >= required_free_capacity) {
     return 0;
   }
   dx_size additional_capacity = required_free_capacity - available_free_capacity;
   return dx_pointer_array_increase_capacity(self, additional_capacity);
 }
 
+int
+dx_pointer_array_reserve
+  (
+    dx_pointer_array* self,
+    dx_size required_capacity
+  )
+{
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (self->capacity >= required_capacity) {
+    return 0;
+  }
+  return dx_pointer_array_increase_capacity(self, required_capacity - self->capacity);
+}
+
+int
+dx_pointer_array_shrink_to_fit
+  (
+    dx_pointer_array* self
+  )
+{
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (self->elements == self->inline_elements || self->size == self->capacity) {
+    return 0;
+  }
+  if (self->size <= DX_POINTER_ARRAY_INLINE_CAPACITY) {
+    dx_memory_copy(self->inline_elements, self->elements, self->size * sizeof(dx_pointer_array_element));
+    dx_memory_deallocate(self->elements);
+    self->elements = self->inline_elements;
+    self->capacity = DX_POINTER_ARRAY_INLINE_CAPACITY;
+    return 0;
+  }
+  // The size is at most the capacity. Hence the number of Bytes does not overflow.
+  dx_pointer_array_element* new_elements = dx_memory_reallocate(self->elements, self->size * sizeof(dx_pointer_array_element));
+  if (!new_elements) {
+    return 1;
+  }
+  self->elements = new_elements;
+  self->capacity = self->size;
+  return 0;
+}
+
+int
+dx_pointer_array_append_range
+  (
+    dx_pointer_array* self,
+    dx_pointer_array_element const* pointers,
+    dx_size number_of_pointers
+  )
+{
+  if (!self || !pointers) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  if (dx_pointer_array_ensure_free_capacity(self, number_of_pointers)) {
+    return 1;
+  }
+  for (dx_size i = 0; i < number_of_pointers; ++i) {
+    dx_pointer_array_element pointer = pointers[i];
+    if (self->added_callback) {
+      self->added_callback(&pointer);
+    }
+    self->elements[self->size++] = pointer;
+  }
+  return 0;
+}
+
 int
 dx_pointer_array_append
   (
@@ -252,3 +340,11 @@ int dx_pointer_array_clear(dx_pointer_array* self) {
   }
   return 0;
 }
+
+int dx_pointer_array_sort(dx_pointer_array* self, dx_compare_callback* compare) {
+  if (!self || !compare) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dx_merge_sort(self->elements, self->size, compare);
+}
@@ -3,6 +3,7 @@
 #define DX_CORE_POINTER_ARRAY_H_INCLUDED
 
 #include "dx/core/core.h"
+#include "dx/core/algorithms.h"
 
 /// @brief The elements of a dx_core_pointer_array are pointers.
 typedef void* dx_pointer_array_element;
@@ -15,13 +16,21 @@ typedef void (dx_added_callback)(dx_pointer_array_element* element);
 /// @param element A pointer to the element.
 typedef void (dx_removed_callback)(dx_pointer_array_element* element);
 
+/// @brief The number of elements a dx_pointer_array object stores without allocating.
+#define DX_POINTER_ARRAY_INLINE_CAPACITY (4)
+
 /// @brief A dynamic array of pointers (also null pointers).
 /// Supports callbacks for notifications on additions and removals of pointers.
+/// @remarks
+/// The first DX_POINTER_ARRAY_INLINE_CAPACITY elements are stored in the dx_pointer_array object itself.
+/// The elements are moved to the heap if the capacity is increased beyond that.
+/// As @a elements may point into the dx_pointer_array object, a dx_pointer_array object must not be copied.
 typedef struct dx_pointer_array dx_pointer_array;
 
 struct dx_pointer_array {
 
   /// @brief A pointer to an array of @a capacity @a (void *) elements.
+  /// Either @a inline_elements or an array allocated by dx_memory_allocate.
   void **elements;
   /// @brief The capacity, in elements, of the array pointed to by @a array.
   dx_size capacity;
@@ -33,6 +42,9 @@ struct dx_pointer_array {
   /// @brief A pointer to the @a dx_removed_callback function or  a null pointer.
   dx_removed_callback *removed_callback;
 
+  /// @brief The inline elements.
+  void* inline_elements[DX_POINTER_ARRAY_INLINE_CAPACITY];
+
 }; // struct dx_pointer_array
 
 /// @brief Initialize this dx_pointer_array object.
@@ -95,6 +107,51 @@ dx_pointer_array_ensure_free_capacity
     dx_size required_free_capacity
   );
 
+/// @brief Ensure the capacity is greater than or equal to a specified value.
+/// @param self A pointer to this dx_pointer_array object.
+/// @param required_capacity The required capacity.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED @a required_capacity is too big
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int
+dx_pointer_array_reserve
+  (
+    dx_pointer_array* self,
+    dx_size required_capacity
+  );
+
+/// @brief Decrease the capacity to the size (or to DX_POINTER_ARRAY_INLINE_CAPACITY if the size is smaller).
+/// @param self A pointer to this dx_pointer_array object.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int
+dx_pointer_array_shrink_to_fit
+  (
+    dx_pointer_array* self
+  );
+
+/// @brief Append elements.
+/// @param self A pointer to this dx_pointer_array object.
+/// @param pointers A pointer to an array of @a number_of_pointers elements.
+/// @param number_of_pointers The number of elements in the array pointed to by @a pointers.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_INVALID_ARGUMENT @a pointers is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks The capacity is increased at most once.
+int
+dx_pointer_array_append_range
+  (
+    dx_pointer_array* self,
+    dx_pointer_array_element const* pointers,
+    dx_size number_of_pointers
+  );
+
 /// @brief Append an element.
 /// @param self A pointer to this dx_pointer_array object.
 /// @param pointer The element.
@@ -200,4 +257,22 @@ dx_pointer_array_clear
     dx_pointer_array* self
   );
 
+/// @brief Sort the elements.
+/// @param self A pointer to this dx_pointer_array object.
+/// @param compare A pointer to a function comparing two elements.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_INVALID_ARGUMENT @a compare is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+/// @remarks
+/// The elements are sorted by dx_merge_sort, hence the sort is stable.
+/// No added or removed callbacks are invoked.
+int
+dx_pointer_array_sort
+  (
+    dx_pointer_array* self,
+    dx_compare_callback* compare
+  );
+
 #endif // DX_CORE_POINTER_ARRAY_H_INCLUDED
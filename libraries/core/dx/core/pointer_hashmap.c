@@ -2,64 +2,57 @@
 
 #include "dx/core/memory.h"
 #include "dx/core/safe_mul_nx.h"
-#include "dx/core/next_power_of_two.h"
+#include "dx/core/typed_hashmap.h"
+#if defined(DX_POINTER_HASHMAP_WITH_TESTS) && 1 == DX_POINTER_HASHMAP_WITH_TESTS
+#include "dx/core/os.h"
+#endif
 
-/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-static dx_size dx_get_best_array_size(dx_size current, dx_size additional, dx_size least, dx_size greatest, bool saturate);
-
-static dx_size dx_get_best_array_size(dx_size current, dx_size additional, dx_size least, dx_size greatest, bool saturate) {
-  dx_error old_error = dx_get_error();
-  if (least > greatest) {
-    dx_set_error(DX_INVALID_ARGUMENT);
-    return 1;
-  }
-  if (DX_SIZE_GREATEST - current < additional) {
-    dx_set_error(DX_INVALID_ARGUMENT);
-    return 1;
-  }
-  dx_size new = current;
-  if (new < least) {
-    new = least;
-  }
-  new = current + additional;
-  dx_size new1 = dx_next_power_of_two_sz(new);
-  if (dx_get_error()) {
-    dx_set_error(old_error);
-  }
-  new = new1;
-  if (new > greatest) {
-    if (!saturate) {
-      dx_set_error(DX_NOT_FOUND);
-      return 1;
-    }
-    new = greatest;
-    if (new < current + additional) {
-      dx_set_error(DX_NOT_FOUND);
-      return 1;   
-    }
-  }
-  return new;
-}
+// memset
+#include <string.h>
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-typedef struct _dx_impl_node _dx_impl_node;
+// The hashmap is an open addressing hash table with linear probing using the control Bytes from "dx/core/typed_hashmap.h".
+// Lookups scan a group of control Bytes at once and compare only keys in slots with matching control Bytes.
+// Deletion shifts the subsequent entries of the run backwards such that no tombstones are required.
+//
+// If DX_POINTER_HASHMAP_INCREMENTAL_RESIZE_ENABLED is enabled, then growing the hashmap allocates the new table
+// but keeps the old table. Each subsequent addition migrates a bounded number of slots of the old table to the new table.
+// The old table never receives new entries: Its entries are either migrated or removed and are replaced by DX_HASHMAP_CONTROL_DELETED
+// such that the runs of the remaining entries of the old table are not broken.
+
+typedef struct _dx_impl_slot _dx_impl_slot;
 
 typedef struct _dx_impl _dx_impl;
 
 /// @brief Set the capacity of this implemenation.
 /// @param self A pointer to this implementation.
-/// @param new_capacity The new capacity. Must not be @a 0.
+/// @param new_capacity The new capacity. Must be a power of two greater than or equal to DX_HASHMAP_GROUP_WIDTH.
+/// Must be greater than or equal to the size of this implementation.
 /// @return The zero value on success. A non-zero value on failure.
 /// @failure The function has set the error variable. In particular, the following error codes are set:
 /// - #DX_INVALID_ARGUMENT @a self is a null pointer.
-/// - #DX_INVALID_ARGUMENT @a new_capacity is smaller than @a 1 or greater than the greatest capacity.
 /// - #DX_ALLOCATION_FAILED an allocation failed.
 static int _dx_impl_set_capacity(_dx_impl* self, dx_size new_capacity);
 
+/// @brief Ensure there is room for one more entry without exceeding the maximal load factor.
 static int _dx_impl_maybe_resize(_dx_impl* self);
 
+/// @brief Migrate at most @a n slots of the old table (if any) to the new table.
+/// If all slots of the old table were migrated, then the old table is deallocated.
+/// @param self A pointer to this implementation.
+/// @param n The greatest number of slots to migrate.
+static void _dx_impl_migrate(_dx_impl* self, dx_size n);
+
+/// @brief Ensure the capacity is sufficient for a size without exceeding the maximal load factor.
+/// @param self A pointer to this implementation.
+/// @param size The size.
+/// @return The zero value on success. A non-zero value on failure.
+/// @failure The function has set the error variable. In particular, the following error codes are set:
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer.
+/// - #DX_ALLOCATION_FAILED an allocation failed.
+static inline int _dx_impl_reserve(_dx_impl* self, dx_size size);
+
 /// @brief Initialize this implementation.
 /// @param self A pointer to an uninitialized _dx_impl object.
 /// @param configuration A pointer to a DX_POINTER_HASHMAP_CONFIGURATION object.
@@ -122,8 +115,7 @@ static inline dx_size _dx_impl_get_capacity(_dx_impl const* self);
 /// - #DX_INVALID_ARGUMENT @a self was a null pointer.
 static inline dx_size _dx_impl_get_free_capacity(_dx_impl const* self);
 
-struct _dx_impl_node {
-  _dx_impl_node* next;
+struct _dx_impl_slot {
   /// @brief The hash value.
   dx_size hash_value;
   /// @brief The key.
@@ -132,16 +124,31 @@ struct _dx_impl_node {
   dx_pointer_hashmap_value value;
 };
 
-typedef _dx_impl_node* _dx_impl_bucket;
-
-
 struct _dx_impl {
   
-  _dx_impl_bucket* buckets;
+  /// @brief A pointer to an array of @a capacity slots.
+  _dx_impl_slot* slots;
+  /// @brief A pointer to an array of @a capacity + DX_HASHMAP_GROUP_WIDTH - 1 control Bytes.
+  /// The last DX_HASHMAP_GROUP_WIDTH - 1 control Bytes are copies of the first DX_HASHMAP_GROUP_WIDTH - 1 control Bytes
+  /// such that a group can be loaded at any index.
+  /// Stored in the same block as the slots.
+  dx_n8* control;
   /// @brief Size of this hashmap.
+  /// Includes the entries in the old table.
   dx_size size;
   /// @brief The capacity of this hashmap.
+  /// A power of two greater than or equal to DX_HASHMAP_GROUP_WIDTH.
   dx_size capacity;
+
+  /// @brief A pointer to the array of slots of the old table or a null pointer.
+  /// If this is not a null pointer, then the slots of the old table are being migrated to the new table.
+  _dx_impl_slot* old_slots;
+  /// @brief A pointer to the control Bytes of the old table or a null pointer.
+  dx_n8* old_control;
+  /// @brief The capacity of the old table or zero.
+  dx_size old_capacity;
+  /// @brief The index of the first slot of the old table which was not migrated yet.
+  dx_size migrated;
   
   /// @brief A pointer to the @a _dx_key_added_callback_impl1 function or a null pointer.
   dx_key_added_callback* key_added_callback;
@@ -161,78 +168,236 @@ struct _dx_impl {
 
 };
 
-#define _DX_IMPL_LEAST_CAPACITY 1
+#define _DX_IMPL_LEAST_CAPACITY (DX_HASHMAP_GROUP_WIDTH)
+
+#define _DX_IMPL_GREATEST_CAPACITY ((DX_SIZE_GREATEST / 2 + 1) / sizeof(_dx_impl_slot))
+
+/// @brief The number of slots of the old table migrated per addition.
+/// The new table has twice the capacity of the old table and at most 3/4 of the capacity of the old table are added until it must grow again.
+/// Hence the migration is always complete before the new table must grow.
+#define _DX_IMPL_MIGRATION_STEP (16)
+
+/// @brief Set the control Byte of a slot and of its copy (if any) in a table.
+static inline void _dx_impl_set_control_in(dx_n8* control, dx_size capacity, dx_size index, dx_n8 value) {
+  control[index] = value;
+  if (index < DX_HASHMAP_GROUP_WIDTH - 1) {
+    control[capacity + index] = value;
+  }
+}
+
+/// @brief Set the control Byte of a slot and of its copy (if any).
+static inline void _dx_impl_set_control(_dx_impl* self, dx_size index, dx_n8 control) {
+  _dx_impl_set_control_in(self->control, self->capacity, index, control);
+}
+
+/// @brief Get the index of the slot of a key in a table.
+/// @return The index of the slot of the key if it was found. @a capacity otherwise.
+static inline dx_size _dx_impl_find_in(_dx_impl const* self, _dx_impl_slot* slots, dx_n8 const* control, dx_size capacity, dx_size hash_value, dx_pointer_hashmap_key* key) {
+  dx_size const mask = capacity - 1;
+  dx_n8 const h2 = dx_hashmap_h2(hash_value);
+  dx_size position = hash_value & mask;
+  while (true) {
+    dx_hashmap_bitmask match = dx_hashmap_group_match(control + position, h2);
+    while (match) {
+      dx_size index = (position + dx_hashmap_bitmask_first(match)) & mask;
+      _dx_impl_slot* slot = &slots[index];
+      if (slot->hash_value == hash_value && self->compare_keys_callback(&slot->key, key)) {
+        return index;
+      }
+      match = dx_hashmap_bitmask_next(match);
+    }
+    // The run of the key ends at the first empty slot.
+    if (dx_hashmap_group_match_empty(control + position)) {
+      return capacity;
+    }
+    position = (position + DX_HASHMAP_GROUP_WIDTH) & mask;
+  }
+}
+
+/// @brief Get the index of the slot of a key in the new table.
+/// @return The index of the slot of the key if it was found. @a capacity otherwise.
+static inline dx_size _dx_impl_find(_dx_impl const* self, dx_size hash_value, dx_pointer_hashmap_key* key) {
+  return _dx_impl_find_in(self, self->slots, self->control, self->capacity, hash_value, key);
+}
+
+/// @brief Get the index of the slot of a key in the old table.
+/// @return The index of the slot of the key if it was found. @a old_capacity otherwise.
+static inline dx_size _dx_impl_find_old(_dx_impl const* self, dx_size hash_value, dx_pointer_hashmap_key* key) {
+  if (!self->old_slots) {
+    return self->old_capacity;
+  }
+  return _dx_impl_find_in(self, self->old_slots, self->old_control, self->old_capacity, hash_value, key);
+}
 
-#define _DX_IMPL_GREATEST_CAPACITY (DX_SIZE_GREATEST / sizeof(_dx_impl_bucket))
+/// @brief Get the index of the first empty slot at or after the slot of a hash value.
+/// @warning The implementation must have at least one empty slot.
+static inline dx_size _dx_impl_find_empty(_dx_impl const* self, dx_size hash_value) {
+  dx_size const mask = self->capacity - 1;
+  dx_size position = hash_value & mask;
+  while (true) {
+    dx_hashmap_bitmask empty = dx_hashmap_group_match_empty(self->control + position);
+    if (empty) {
+      return (position + dx_hashmap_bitmask_first(empty)) & mask;
+    }
+    position = (position + DX_HASHMAP_GROUP_WIDTH) & mask;
+  }
+}
+
+/// @brief Empty a slot.
+/// The subsequent entries of the run are shifted backwards such that no entry is separated from its home slot by an empty slot.
+/// @param index The index of the slot.
+/// @return The index of the slot that became empty.
+static inline dx_size _dx_impl_erase(_dx_impl* self, dx_size index) {
+  dx_size const mask = self->capacity - 1;
+  dx_size hole = index;
+  for (dx_size current = (hole + 1) & mask; self->control[current] != DX_HASHMAP_CONTROL_EMPTY; current = (current + 1) & mask) {
+    dx_size home = self->slots[current].hash_value & mask;
+    // Move the entry into the hole if the hole is in the cyclic range [home, current).
+    if (((current - home) & mask) >= ((current - hole) & mask)) {
+      self->slots[hole] = self->slots[current];
+      _dx_impl_set_control(self, hole, self->control[current]);
+      hole = current;
+    }
+  }
+  _dx_impl_set_control(self, hole, DX_HASHMAP_CONTROL_EMPTY);
+  self->size--;
+  return hole;
+}
 
-static _dx_impl_node** _dx_impl_allocate_bucket_array(dx_size n) {
+/// @brief Allocate an array of slots followed by their control Bytes.
+/// All control Bytes are set to DX_HASHMAP_CONTROL_EMPTY.
+static int _dx_impl_allocate(dx_size capacity, _dx_impl_slot** slots, dx_n8** control) {
   dx_size overflow;
-  dx_size n_bytes = dx_mul_sz(n, sizeof(_dx_impl_bucket), &overflow);
-  if (overflow) {
+  dx_size n = dx_mul_sz(capacity, sizeof(_dx_impl_slot), &overflow);
+  if (overflow || DX_SIZE_GREATEST - n < capacity + DX_HASHMAP_GROUP_WIDTH - 1) {
     dx_set_error(DX_ALLOCATION_FAILED);
-    return NULL;
-  }
-  _dx_impl_bucket* buckets = dx_memory_allocate(n_bytes);
-  if (!buckets) {
-    return NULL;
+    return 1;
   }
-  for (dx_size i = 0; i < n; ++i) {
-    buckets[i] = NULL;
+  _dx_impl_slot* slots1 = dx_memory_allocate(n + capacity + DX_HASHMAP_GROUP_WIDTH - 1);
+  if (!slots1) {
+    return 1;
   }
-  return buckets;
+  dx_n8* control1 = (dx_n8*)(slots1 + capacity);
+  memset(control1, DX_HASHMAP_CONTROL_EMPTY, capacity + DX_HASHMAP_GROUP_WIDTH - 1);
+  *slots = slots1;
+  *control = control1;
+  return 0;
 }
 
 static int _dx_impl_set_capacity(_dx_impl* self, dx_size new_capacity) {
-  if (!self || !new_capacity) {
+  if (!self || new_capacity < _DX_IMPL_LEAST_CAPACITY || new_capacity > _DX_IMPL_GREATEST_CAPACITY || new_capacity < self->size) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  dx_size old_capacity = self->capacity;
-  _dx_impl_bucket* old_buckets = self->buckets;
-  _dx_impl_bucket* new_buckets = _dx_impl_allocate_bucket_array(new_capacity);
-  if (!new_buckets) {
-    dx_set_error(DX_ALLOCATION_FAILED);
+  _dx_impl_slot* new_slots;
+  dx_n8* new_control;
+  if (_dx_impl_allocate(new_capacity, &new_slots, &new_control)) {
     return 1;
   }
+  // Complete the migration (if any) such that all entries are in the current table.
+  _dx_impl_migrate(self, self->old_capacity);
+  _dx_impl_slot* old_slots = self->slots;
+  dx_n8* old_control = self->control;
+  dx_size old_capacity = self->capacity;
+  self->slots = new_slots;
+  self->control = new_control;
+  self->capacity = new_capacity;
   for (dx_size i = 0; i < old_capacity; ++i) {
-    _dx_impl_bucket* old_bucket = &old_buckets[i];
-    while (*old_bucket) {
-      _dx_impl_node* node = *old_bucket;
-      *old_bucket = node->next;
-      dx_size new_hash_index = node->hash_value % new_capacity;
-      node->next = new_buckets[new_hash_index];
-      new_buckets[new_hash_index] = node;
+    if (dx_hashmap_control_is_full(old_control[i])) {
+      dx_size index = _dx_impl_find_empty(self, old_slots[i].hash_value);
+      self->slots[index] = old_slots[i];
+      _dx_impl_set_control(self, index, old_control[i]);
     }
   }
-  dx_memory_deallocate(old_buckets);
-  self->capacity = new_capacity;
-  self->buckets = new_buckets;
+  dx_memory_deallocate(old_slots);
   return 0;
 }
 
 static int _dx_impl_maybe_resize(_dx_impl* self) {
-  if (self->size > self->capacity) {
-    dx_size new_capacity = dx_get_best_array_size(self->capacity, 1, _DX_IMPL_LEAST_CAPACITY, _DX_IMPL_GREATEST_CAPACITY, true);
-    if (dx_get_error()) {
+  if (self->size + 1 > dx_hashmap_get_greatest_size(self->capacity)) {
+    if (self->capacity > _DX_IMPL_GREATEST_CAPACITY / 2) {
+      dx_set_error(DX_ALLOCATION_FAILED);
       return 1;
     }
-    return _dx_impl_set_capacity(self, new_capacity);
+#if defined(DX_POINTER_HASHMAP_INCREMENTAL_RESIZE_ENABLED) && 1 == DX_POINTER_HASHMAP_INCREMENTAL_RESIZE_ENABLED
+    _dx_impl_slot* new_slots;
+    dx_n8* new_control;
+    if (_dx_impl_allocate(self->capacity * 2, &new_slots, &new_control)) {
+      return 1;
+    }
+    // There is at most one old table.
+    _dx_impl_migrate(self, self->old_capacity);
+    self->old_slots = self->slots;
+    self->old_control = self->control;
+    self->old_capacity = self->capacity;
+    self->migrated = 0;
+    self->slots = new_slots;
+    self->control = new_control;
+    self->capacity = self->capacity * 2;
+    return 0;
+#else
+    return _dx_impl_set_capacity(self, self->capacity * 2);
+#endif
   }
   return 0;
 }
 
+static void _dx_impl_migrate(_dx_impl* self, dx_size n) {
+  if (!self->old_slots) {
+    return;
+  }
+  dx_size end = self->old_capacity - self->migrated > n ? self->migrated + n : self->old_capacity;
+  for (; self->migrated < end; ++self->migrated) {
+    dx_size i = self->migrated;
+    if (dx_hashmap_control_is_full(self->old_control[i])) {
+      dx_size index = _dx_impl_find_empty(self, self->old_slots[i].hash_value);
+      self->slots[index] = self->old_slots[i];
+      _dx_impl_set_control(self, index, self->old_control[i]);
+      _dx_impl_set_control_in(self->old_control, self->old_capacity, i, DX_HASHMAP_CONTROL_DELETED);
+    }
+  }
+  if (self->migrated == self->old_capacity) {
+    dx_memory_deallocate(self->old_slots);
+    self->old_slots = NULL;
+    self->old_control = NULL;
+    self->old_capacity = 0;
+    self->migrated = 0;
+  }
+}
+
+static inline int _dx_impl_reserve(_dx_impl* self, dx_size size) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx_size new_capacity = self->capacity;
+  while (dx_hashmap_get_greatest_size(new_capacity) < size) {
+    if (new_capacity > _DX_IMPL_GREATEST_CAPACITY / 2) {
+      dx_set_error(DX_ALLOCATION_FAILED);
+      return 1;
+    }
+    new_capacity *= 2;
+  }
+  if (new_capacity == self->capacity) {
+    return 0;
+  }
+  return _dx_impl_set_capacity(self, new_capacity);
+}
+
 static inline int _dx_impl_initialize(_dx_impl* self, DX_POINTER_HASHMAP_CONFIGURATION const* configuration) {
   if (!self || !configuration) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  static dx_size const INITIAL_CAPACITY = 8;
-  self->buckets = _dx_impl_allocate_bucket_array(INITIAL_CAPACITY);
-  if (!self->buckets) {
+  if (_dx_impl_allocate(_DX_IMPL_LEAST_CAPACITY, &self->slots, &self->control)) {
     return 1;
   }
   self->size = 0;
-  self->capacity = INITIAL_CAPACITY;
+  self->capacity = _DX_IMPL_LEAST_CAPACITY;
+  self->old_slots = NULL;
+  self->old_control = NULL;
+  self->old_capacity = 0;
+  self->migrated = 0;
   self->key_added_callback = configuration->key_added_callback;
   self->key_removed_callback = configuration->key_removed_callback;
   self->hash_key_callback = configuration->hash_key_callback;
@@ -246,9 +411,26 @@ static inline int _dx_impl_initialize(_dx_impl* self, DX_POINTER_HASHMAP_CONFIGU
 static inline void _dx_impl_uninitialize(_dx_impl* self) {
   DX_DEBUG_ASSERT(NULL != self);
   _dx_impl_clear(self);
-  DX_DEBUG_ASSERT(NULL != self->buckets);
-  dx_memory_deallocate(self->buckets);
-  self->buckets = NULL;
+  DX_DEBUG_ASSERT(NULL != self->slots);
+  dx_memory_deallocate(self->slots);
+  self->slots = NULL;
+  self->control = NULL;
+}
+
+/// @brief Invoke the removed callbacks for the entries of a table.
+static inline void _dx_impl_notify_removed_in(_dx_impl* self, _dx_impl_slot* slots, dx_n8 const* control, dx_size capacity) {
+  for (dx_size i = 0; i < capacity && self->size; ++i) {
+    if (dx_hashmap_control_is_full(control[i])) {
+      _dx_impl_slot* slot = &slots[i];
+      if (self->value_removed_callback) {
+        self->value_removed_callback(&slot->value);
+      }
+      if (self->key_removed_callback) {
+        self->key_removed_callback(&slot->key);
+      }
+      self->size--;
+    }
+  }
 }
 
 static inline int _dx_impl_clear(_dx_impl* self) {
@@ -256,20 +438,20 @@ static inline int _dx_impl_clear(_dx_impl* self) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
-  for (dx_size i = 0, n = self->capacity; i < n; ++i) {
-    _dx_impl_node** bucket = &self->buckets[i];
-    while (*bucket) {
-      _dx_impl_node* node = *bucket;
-      *bucket = node->next;
-      if (self->value_removed_callback) {
-        self->value_removed_callback(&node->value);
-      }
-      if (self->key_removed_callback) {
-        self->key_removed_callback(&node->key);
-      }
-      dx_memory_deallocate(node);
+  if (self->value_removed_callback || self->key_removed_callback) {
+    if (self->old_slots) {
+      _dx_impl_notify_removed_in(self, self->old_slots, self->old_control, self->old_capacity);
     }
+    _dx_impl_notify_removed_in(self, self->slots, self->control, self->capacity);
   }
+  if (self->old_slots) {
+    dx_memory_deallocate(self->old_slots);
+    self->old_slots = NULL;
+    self->old_control = NULL;
+    self->old_capacity = 0;
+    self->migrated = 0;
+  }
+  memset(self->control, DX_HASHMAP_CONTROL_EMPTY, self->capacity + DX_HASHMAP_GROUP_WIDTH - 1);
   self->size = 0;
   return 0;
 }
@@ -279,17 +461,19 @@ static inline int _dx_impl_set(_dx_impl* self, dx_pointer_hashmap_key key, dx_po
     dx_set_error(DX_INVALID_ARGUMENT);
     return 1;
   }
+  _dx_impl_migrate(self, _DX_IMPL_MIGRATION_STEP);
   dx_size hash_value = self->hash_key_callback(&key);
-  dx_size hash_index = hash_value % self->capacity;
-  _dx_impl_node* node;
-  for (node = self->buckets[hash_index]; NULL != node; node = node->next) {
-    if (node->hash_value == hash_value) {
-      if (self->compare_keys_callback(&node->key, &key)) {
-        break;
-      }
+  _dx_impl_slot* slot = NULL;
+  dx_size index = _dx_impl_find(self, hash_value, &key);
+  if (index != self->capacity) {
+    slot = &self->slots[index];
+  } else {
+    index = _dx_impl_find_old(self, hash_value, &key);
+    if (index != self->old_capacity) {
+      slot = &self->old_slots[index];
     }
   }
-  if (node) {
+  if (slot) {
     if (!replace) {
       dx_set_error(DX_EXISTS);
       return 1;
@@ -299,38 +483,34 @@ static inline int _dx_impl_set(_dx_impl* self, dx_pointer_hashmap_key key, dx_po
       self->key_added_callback(&key);
     }
     if (self->key_removed_callback) {
-      self->key_removed_callback(&node->key);
+      self->key_removed_callback(&slot->key);
     }
-    node->key = key;
+    slot->key = key;
     //
     if (self->value_added_callback) {
       self->value_added_callback(&value);
     }
     if (self->value_removed_callback) {
-      self->value_removed_callback(&node->value);
+      self->value_removed_callback(&slot->value);
     }
-    node->value = value;
+    slot->value = value;
   } else {
-    node = dx_memory_allocate(sizeof(_dx_impl_node));
-    if (!node) {
+    if (_dx_impl_maybe_resize(self)) {
       return 1;
     }
+    index = _dx_impl_find_empty(self, hash_value);
+    slot = &self->slots[index];
     if (self->key_added_callback) {
       self->key_added_callback(&key);
     }
-    node->key = key;
+    slot->key = key;
     if (self->value_added_callback) {
       self->value_added_callback(&value);
     }
-    node->value = value;
-    node->hash_value = hash_value;
-    node->next = self->buckets[hash_index];
-    self->buckets[hash_index] = node;
+    slot->value = value;
+    slot->hash_value = hash_value;
+    _dx_impl_set_control(self, index, dx_hashmap_h2(hash_value));
     self->size++;
-    dx_error old_error = dx_get_error();
-    if (_dx_impl_maybe_resize(self)) {
-      dx_set_error(old_error);
-    }
   }
   return 0;
 }
@@ -341,14 +521,13 @@ static inline dx_pointer_hashmap_value _dx_impl_get(_dx_impl* self, dx_pointer_h
     return NULL;
   }
   dx_size hash_value = self->hash_key_callback(&key);
-  dx_size hash_index = hash_value % self->capacity;
-  _dx_impl_node* node;
-  for (node = self->buckets[hash_index]; NULL != node; node = node->next) {
-    if (node->hash_value == hash_value) {
-      if (self->compare_keys_callback(&node->key, &key)) {
-        return node->value;
-      }
-    }
+  dx_size index = _dx_impl_find(self, hash_value, &key);
+  if (index != self->capacity) {
+    return self->slots[index].value;
+  }
+  index = _dx_impl_find_old(self, hash_value, &key);
+  if (index != self->old_capacity) {
+    return self->old_slots[index].value;
   }
   dx_set_error(DX_NOT_FOUND);
   return NULL;
@@ -359,27 +538,31 @@ static inline int _dx_impl_remove(_dx_impl* self, dx_pointer_hashmap_key key) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 0;
   }
+  _dx_impl_migrate(self, _DX_IMPL_MIGRATION_STEP);
   dx_size hash_value = self->hash_key_callback(&key);
-  dx_size hash_index = hash_value % self->capacity;
-  _dx_impl_node** previous;
-  _dx_impl_node* current;
-  for (previous = &self->buckets[hash_index], current = self->buckets[hash_index]; NULL != current; previous = &current->next, current = current->next) {
-    if (current->hash_value == hash_value) {
-      if (self->compare_keys_callback(&current->key, &key)) {
-        *previous = current->next;
-        if (self->value_removed_callback) {
-          self->value_removed_callback(&current->value);
-        }
-        if (self->key_removed_callback) {
-          self->key_removed_callback(&current->key);
-        }
-        dx_memory_deallocate(current);
-        return 0;
-      }
+  _dx_impl_slot slot;
+  dx_size index = _dx_impl_find(self, hash_value, &key);
+  if (index != self->capacity) {
+    slot = self->slots[index];
+    _dx_impl_erase(self, index);
+  } else {
+    index = _dx_impl_find_old(self, hash_value, &key);
+    if (index == self->old_capacity) {
+      dx_set_error(DX_NOT_FOUND);
+      return 1;
     }
+    slot = self->old_slots[index];
+    // Do not break the runs of the old table.
+    _dx_impl_set_control_in(self->old_control, self->old_capacity, index, DX_HASHMAP_CONTROL_DELETED);
+    self->size--;
   }
-  dx_set_error(DX_NOT_FOUND);
-  return 1;
+  if (self->value_removed_callback) {
+    self->value_removed_callback(&slot.value);
+  }
+  if (self->key_removed_callback) {
+    self->key_removed_callback(&slot.key);
+  }
+  return 0;
 }
 
 static inline dx_size _dx_impl_get_size(_dx_impl const* self) {
@@ -403,7 +586,7 @@ static inline dx_size _dx_impl_get_free_capacity(_dx_impl const* self) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 0;
   }
-  return self->capacity - self->size;
+  return dx_hashmap_get_greatest_size(self->capacity) - self->size;
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -469,6 +652,14 @@ int dx_pointer_hashmap_remove(dx_pointer_hashmap* self, dx_pointer_hashmap_key k
   return _dx_impl_remove(_DX_IMPL(self->pimpl), key);
 }
 
+int dx_pointer_hashmap_reserve(dx_pointer_hashmap* self, dx_size size) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return _dx_impl_reserve(_DX_IMPL(self->pimpl), size);
+}
+
 dx_size dx_pointer_hashmap_get_size(dx_pointer_hashmap const* self) {
   if (!self) {
     dx_set_error(DX_INVALID_ARGUMENT);
@@ -501,39 +692,23 @@ static inline _dx_impl_iterator* _DX_IMPL_ITERATOR(void* p) {
 }
 struct _dx_impl_iterator {
   _dx_impl* target;
-  dx_size bucket;
-  _dx_impl_node** previous;
-  _dx_impl_node* current;
+  /// @brief The index of an empty slot.
+  /// The slots are visited in cyclic order starting after this slot.
+  /// As dx_pointer_hashmap_iterator_remove never shifts entries across an empty slot, every entry is visited exactly once.
+  dx_size start;
+  /// @brief The index of the current slot relative to @a start.
+  /// If this is equal to the capacity, then the iterator has no entry.
+  dx_size offset;
 };
 
-static inline void _dx_impl_increment(_dx_impl_iterator* self);
-
-static inline void _dx_impl_increment(_dx_impl_iterator* self) {
-  if (self->current) {
-    self->previous = &self->current->next;
-    self->current = self->current->next;
-    if (!self->current) {
-      self->bucket++; // move to next bucket
-      while (self->bucket < self->target->capacity) {
-        self->previous = &self->target->buckets[self->bucket];
-        self->current = self->target->buckets[self->bucket];
-        if (self->current) {
-          return;
-        }
-        self->bucket++;
-      }
-    }
-  } else {
-    if (self->bucket < self->target->capacity) {
-      do {
-        self->previous = &self->target->buckets[self->bucket];
-        self->current = self->target->buckets[self->bucket];
-        if (self->current != NULL) {
-          break;
-        }
-        self->bucket++;
-      } while (self->bucket < self->target->capacity);
-    }
+static inline dx_size _dx_impl_iterator_get_index(_dx_impl_iterator const* self) {
+  return (self->start + self->offset) & (self->target->capacity - 1);
+}
+
+/// @brief Advance this iterator to the first non-empty slot at or after its current slot.
+static inline void _dx_impl_seek(_dx_impl_iterator* self) {
+  while (self->offset < self->target->capacity && self->target->control[_dx_impl_iterator_get_index(self)] == DX_HASHMAP_CONTROL_EMPTY) {
+    self->offset++;
   }
 }
 
@@ -547,10 +722,12 @@ int dx_pointer_hashmap_iterator_initialize(dx_pointer_hashmap_iterator* self, dx
     return 1;
   }
   pimpl->target = _DX_IMPL(target->pimpl);
-  pimpl->bucket = 0;
-  pimpl->previous = NULL;
-  pimpl->current = NULL;
-  _dx_impl_increment(pimpl);
+  // The iterator visits the new table only.
+  _dx_impl_migrate(pimpl->target, pimpl->target->old_capacity);
+  // There is at least one empty slot as the load factor is less than one.
+  pimpl->start = _dx_impl_find_empty(pimpl->target, 0);
+  pimpl->offset = 0;
+  _dx_impl_seek(pimpl);
   self->pimpl = pimpl;
   return 0;
 }
@@ -562,7 +739,10 @@ void dx_pointer_hashmap_iterator_uninitialize(dx_pointer_hashmap_iterator* self)
 
 int dx_pointer_hashmap_iterator_next(dx_pointer_hashmap_iterator* self) {
   _dx_impl_iterator* pimpl = _DX_IMPL_ITERATOR(self->pimpl);
-  _dx_impl_increment(pimpl);
+  if (pimpl->offset < pimpl->target->capacity) {
+    pimpl->offset++;
+    _dx_impl_seek(pimpl);
+  }
   return 0;
 }
 
@@ -572,7 +752,7 @@ bool dx_pointer_hashmap_iterator_has_entry(dx_pointer_hashmap_iterator* self) {
     return false;
   }
   _dx_impl_iterator* pimpl = _DX_IMPL_ITERATOR(self->pimpl);
-  return NULL != pimpl->current;
+  return pimpl->offset < pimpl->target->capacity;
 }
 
 void* dx_pointer_hashmap_iterator_get_value(dx_pointer_hashmap_iterator* self) {
@@ -581,11 +761,11 @@ void* dx_pointer_hashmap_iterator_get_value(dx_pointer_hashmap_iterator* self) {
     return NULL;
   }
   _dx_impl_iterator* pimpl = _DX_IMPL_ITERATOR(self->pimpl);
-  if (!pimpl->current) {
+  if (pimpl->offset == pimpl->target->capacity) {
     dx_set_error(DX_INVALID_OPERATION);
     return NULL;
   }
-  return pimpl->current->value;
+  return pimpl->target->slots[_dx_impl_iterator_get_index(pimpl)].value;
 }
 
 void* dx_pointer_hashmap_iterator_get_key(dx_pointer_hashmap_iterator* self) {
@@ -594,11 +774,11 @@ void* dx_pointer_hashmap_iterator_get_key(dx_pointer_hashmap_iterator* self) {
     return NULL;
   }
   _dx_impl_iterator* pimpl = _DX_IMPL_ITERATOR(self->pimpl);
-  if (!pimpl->current) {
+  if (pimpl->offset == pimpl->target->capacity) {
     dx_set_error(DX_INVALID_OPERATION);
     return NULL;
   }
-  return pimpl->current->key;
+  return pimpl->target->slots[_dx_impl_iterator_get_index(pimpl)].key;
 }
 
 int dx_pointer_hashmap_iterator_remove(dx_pointer_hashmap_iterator* self) {
@@ -607,22 +787,177 @@ int dx_pointer_hashmap_iterator_remove(dx_pointer_hashmap_iterator* self) {
     return 1;
   }
   _dx_impl_iterator* pimpl = _DX_IMPL_ITERATOR(self->pimpl);
-  if (!pimpl->current) {
+  if (pimpl->offset == pimpl->target->capacity) {
     dx_set_error(DX_INVALID_OPERATION);
     return 1;
   }
-  _dx_impl_node** previous = pimpl->previous;
-  _dx_impl_node* current = pimpl->current;
-  // Predecessor points to successor.
-  *previous = current->next;
-  // Decrement size by 1.
-  pimpl->target->size--;
-  // Update iterator.
-  pimpl->previous = previous;
-  pimpl->current = *previous;
-  if (!pimpl->current) {
-    // Only if the removed node was the last in the bucket and hence pimpl->current is now a null pointer.
-    _dx_impl_increment(pimpl);
+  _dx_impl* target = pimpl->target;
+  dx_size index = _dx_impl_iterator_get_index(pimpl);
+  _dx_impl_slot slot = target->slots[index];
+  // An entry shifted into the current slot was not visited yet: Do not advance.
+  _dx_impl_erase(target, index);
+  _dx_impl_seek(pimpl);
+  if (target->value_removed_callback) {
+    target->value_removed_callback(&slot.value);
+  }
+  if (target->key_removed_callback) {
+    target->key_removed_callback(&slot.key);
   }
   return 0;
 }
+
+#if defined(DX_POINTER_HASHMAP_WITH_TESTS) && 1 == DX_POINTER_HASHMAP_WITH_TESTS
+
+// The number of entries added, looked up, and removed by a test.
+#define _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS (64 * 1024)
+
+// Report the time of a step if DX_POINTER_HASHMAP_WITH_BENCHMARKS is enabled.
+static void _dx_pointer_hashmap_tests_report(char const* name, dx_n64 time, dx_size number_of_operations) {
+#if defined(DX_POINTER_HASHMAP_WITH_BENCHMARKS) && 1 == DX_POINTER_HASHMAP_WITH_BENCHMARKS
+  dx_log_benchmark(name, time, number_of_operations);
+#endif
+}
+
+// Get the i-th key. Keys are aligned like pointers to objects.
+static inline dx_pointer_hashmap_key _dx_pointer_hashmap_tests_key(dx_size i) {
+  return (dx_pointer_hashmap_key)(uintptr_t)(16 * (i + 1));
+}
+
+static dx_size _dx_pointer_hashmap_tests_hash_key(dx_pointer_hashmap_key* key) {
+  return dx_hash_pointer(*key);
+}
+
+static dx_bool _dx_pointer_hashmap_tests_compare_keys(dx_pointer_hashmap_key* a, dx_pointer_hashmap_key* b) {
+  return *a == *b;
+}
+
+static int _dx_pointer_hashmap_tests_initialize(dx_pointer_hashmap* self) {
+  DX_POINTER_HASHMAP_CONFIGURATION configuration = {
+    .key_added_callback = NULL,
+    .key_removed_callback = NULL,
+    .value_added_callback = NULL,
+    .value_removed_callback = NULL,
+    .hash_key_callback = &_dx_pointer_hashmap_tests_hash_key,
+    .compare_keys_callback = &_dx_pointer_hashmap_tests_compare_keys,
+  };
+  return dx_pointer_hashmap_initialize(self, &configuration);
+}
+
+// Add, look up, and remove entries.
+// Check the size and the values after each step and report the time per operation of each step.
+static int _dx_pointer_hashmap_tests_set_get_remove() {
+  dx_pointer_hashmap map;
+  if (_dx_pointer_hashmap_tests_initialize(&map)) {
+    return 1;
+  }
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS; ++i) {
+    if (dx_pointer_hashmap_set(&map, _dx_pointer_hashmap_tests_key(i), _dx_pointer_hashmap_tests_key(i))) {
+      dx_pointer_hashmap_uninitialize(&map);
+      return 1;
+    }
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  _dx_pointer_hashmap_tests_report("dx_pointer_hashmap_set", time, _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS);
+  if (_DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS != dx_pointer_hashmap_get_size(&map)) {
+    dx_pointer_hashmap_uninitialize(&map);
+    return 1;
+  }
+  // Adding an existing key fails.
+  if (!dx_pointer_hashmap_set(&map, _dx_pointer_hashmap_tests_key(0), NULL) || DX_EXISTS != dx_get_error()) {
+    dx_pointer_hashmap_uninitialize(&map);
+    return 1;
+  }
+  dx_set_error(DX_NO_ERROR);
+  start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS; ++i) {
+    if (_dx_pointer_hashmap_tests_key(i) != dx_pointer_hashmap_get(&map, _dx_pointer_hashmap_tests_key(i))) {
+      dx_pointer_hashmap_uninitialize(&map);
+      return 1;
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  _dx_pointer_hashmap_tests_report("dx_pointer_hashmap_get", time, _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS);
+  // Looking up keys which were not added fails.
+  start = dx_os_get_time_ns();
+  for (dx_size i = _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS; i < 2 * _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS; ++i) {
+    if (dx_pointer_hashmap_get(&map, _dx_pointer_hashmap_tests_key(i)) || DX_NOT_FOUND != dx_get_error()) {
+      dx_pointer_hashmap_uninitialize(&map);
+      return 1;
+    }
+    dx_set_error(DX_NO_ERROR);
+  }
+  time = dx_os_get_time_ns() - start;
+  _dx_pointer_hashmap_tests_report("dx_pointer_hashmap_get (not found)", time, _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS);
+  start = dx_os_get_time_ns();
+  for (dx_size i = 0; i < _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS; ++i) {
+    if (dx_pointer_hashmap_remove(&map, _dx_pointer_hashmap_tests_key(i))) {
+      dx_pointer_hashmap_uninitialize(&map);
+      return 1;
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  _dx_pointer_hashmap_tests_report("dx_pointer_hashmap_remove", time, _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS);
+  if (0 != dx_pointer_hashmap_get_size(&map)) {
+    dx_pointer_hashmap_uninitialize(&map);
+    return 1;
+  }
+  dx_pointer_hashmap_uninitialize(&map);
+  return 0;
+}
+
+// Add entries one by one to a map which grows or for which the capacity was reserved.
+// If the capacity was reserved, check that the capacity is not changed by the additions.
+// If DX_POINTER_HASHMAP_WITH_BENCHMARKS is enabled, report the total time and the greatest time of a single addition.
+static int _dx_pointer_hashmap_tests_latency(dx_bool reserve, char const* name, char const* latency_name) {
+  dx_pointer_hashmap map;
+  if (_dx_pointer_hashmap_tests_initialize(&map)) {
+    return 1;
+  }
+  if (reserve && dx_pointer_hashmap_reserve(&map, _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS)) {
+    dx_pointer_hashmap_uninitialize(&map);
+    return 1;
+  }
+  dx_size capacity = dx_pointer_hashmap_get_capacity(&map);
+  dx_n64 total_time = 0;
+  dx_n64 greatest_time = 0;
+  for (dx_size i = 0; i < _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS; ++i) {
+#if defined(DX_POINTER_HASHMAP_WITH_BENCHMARKS) && 1 == DX_POINTER_HASHMAP_WITH_BENCHMARKS
+    dx_n64 start = dx_os_get_time_ns();
+#endif
+    if (dx_pointer_hashmap_set(&map, _dx_pointer_hashmap_tests_key(i), _dx_pointer_hashmap_tests_key(i))) {
+      dx_pointer_hashmap_uninitialize(&map);
+      return 1;
+    }
+#if defined(DX_POINTER_HASHMAP_WITH_BENCHMARKS) && 1 == DX_POINTER_HASHMAP_WITH_BENCHMARKS
+    dx_n64 time = dx_os_get_time_ns() - start;
+    total_time += time;
+    if (time > greatest_time) {
+      greatest_time = time;
+    }
+#endif
+  }
+  if (reserve && capacity != dx_pointer_hashmap_get_capacity(&map)) {
+    dx_pointer_hashmap_uninitialize(&map);
+    return 1;
+  }
+  dx_pointer_hashmap_uninitialize(&map);
+  _dx_pointer_hashmap_tests_report(name, total_time, _DX_POINTER_HASHMAP_TESTS_NUMBER_OF_KEYS);
+  _dx_pointer_hashmap_tests_report(latency_name, greatest_time, 1);
+  return 0;
+}
+
+int dx_pointer_hashmap_tests() {
+  if (_dx_pointer_hashmap_tests_set_get_remove()) {
+    return 1;
+  }
+  if (_dx_pointer_hashmap_tests_latency(false, "dx_pointer_hashmap_set (growing)", "dx_pointer_hashmap_set (growing, greatest latency)")) {
+    return 1;
+  }
+  if (_dx_pointer_hashmap_tests_latency(true, "dx_pointer_hashmap_set (reserved)", "dx_pointer_hashmap_set (reserved, greatest latency)")) {
+    return 1;
+  }
+  return 0;
+}
+
+#endif // DX_POINTER_HASHMAP_WITH_TESTS
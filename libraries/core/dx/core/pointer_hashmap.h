@@ -28,16 +28,13 @@ typedef void (dx_value_removed_callback)(dx_pointer_hashmap_value*);
 typedef dx_size (dx_hash_key_callback)(dx_pointer_hashmap_key*);
 typedef dx_bool (dx_compare_keys_callback)(dx_pointer_hashmap_key*, dx_pointer_hashmap_key*);
 
-typedef struct dx_pointer_hashmap_node dx_pointer_hashmap_node;
-struct dx_pointer_hashmap_node {
-  dx_pointer_hashmap_node* next;
-  dx_size hash_value;
-  dx_pointer_hashmap_key key;
-  dx_pointer_hashmap_value value;
-};
-
 /// @brief A dynamic hashmap of pointers (also null pointers).
 /// Supports callbacks for notifications on additions and removals of pointers.
+/// @remarks
+/// The hashmap is an open addressing hash table storing its entries inline.
+/// The capacity is a power of two and is doubled if the load factor would exceed 3/4.
+/// If DX_POINTER_HASHMAP_INCREMENTAL_RESIZE_ENABLED is enabled, then the entries are migrated to the new table
+/// in small steps by subsequent additions and removals instead of all at once.
 typedef struct dx_pointer_hashmap dx_pointer_hashmap;
 
 struct dx_pointer_hashmap {
@@ -125,12 +122,25 @@ dx_size dx_pointer_hashmap_get_size(dx_pointer_hashmap const* self);
 dx_size dx_pointer_hashmap_get_capacity(dx_pointer_hashmap const* self);
 
 /// @brief Get the free capacity, in elements.
+/// That is the number of entries which can be added without increasing the capacity.
 /// @param self A pointer to this hashmap.
 /// @return The free capacity on success. The free capacity may be zero. The zero value is also returned on failure.
 /// @default-failure In particular the following error codes are set
 /// - #DX_INVALID_ARGUMENT @a self is a null pointer
 dx_size dx_pointer_hashmap_get_free_capacity(dx_pointer_hashmap const* self);
 
+/// @brief Increase the capacity such that at least the specified number of entries can be stored without increasing the capacity.
+/// @param self A pointer to this hashmap.
+/// @param size The number of entries.
+/// @return The zero value on success. A non-zero value on failure.
+/// @remarks
+/// Bulk loaders should call this function before adding a known number of entries.
+/// The capacity is never decreased by this function.
+/// @default-failure In particular the following error codes are set
+/// - #DX_INVALID_ARGUMENT @a self is a null pointer
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int dx_pointer_hashmap_reserve(dx_pointer_hashmap* self, dx_size size);
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /// @brief An iterator for a pointer hash map.
@@ -184,6 +194,15 @@ void* dx_pointer_hashmap_iterator_get_value(dx_pointer_hashmap_iterator* self);
 /// @default-failure
 void* dx_pointer_hashmap_iterator_get_key(dx_pointer_hashmap_iterator* self);
 
+/// @brief Remove the current entry and advance this iterator to the next entry.
+/// The removed callbacks are invoked for the key and the value of the removed entry.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_OPERATION this iterator has no entry
 int dx_pointer_hashmap_iterator_remove(dx_pointer_hashmap_iterator* self);
 
+#if defined(DX_POINTER_HASHMAP_WITH_TESTS) && 1 == DX_POINTER_HASHMAP_WITH_TESTS
+int dx_pointer_hashmap_tests();
+#endif
+
 #endif // DX_CORE_POINTER_HASHMAP_H_INCLUDED
\ No newline at end of file
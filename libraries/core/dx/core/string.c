@@ -2,19 +2,33 @@
 
 #include "dx/core/_string_format.h"
 
-// memcmp, memcpy
+// memchr, memcmp, memcpy
 #include <string.h>
 
+#if defined(_M_X64)
+  // _mm_loadu_si128, _mm_movemask_epi8, _mm_or_si128
+  #include <emmintrin.h>
+#endif
+
 #include "dx/core/byte_array.h"
-#include "dx/core/safe_add_nx.h"
-#include "dx/core/safe_mul_nx.h"
+#include "dx/core/convert.h"
+#include "dx/core/memory.h"
+
+// SRWLOCK
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+/// @brief Validate the Bytes of a string and set the flags of the string accordingly.
+/// @param self A pointer to the string.
+static void _dx_string_validate(dx_string* self);
 
 dx_string* dx_string_printfv(dx_string* format, va_list arguments) {
   dx_byte_array buffer;
   if (dx_byte_array_initialize(&buffer)) {
     return NULL;
   }
-  if (dx__format_v(&buffer, format->bytes, format->bytes + format->number_of_bytes, arguments)) {
+  dx__format_sink sink = { .array = &buffer, .bytes = NULL, .capacity = 0, .size = 0 };
+  if (dx__format_v(&sink, format->bytes, format->bytes + format->number_of_bytes, arguments)) {
     dx_byte_array_uninitialize(&buffer);
     return NULL;
   }
@@ -31,6 +45,130 @@ dx_string* dx_string_printf(dx_string* format, ...) {
   return string;
 }
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+DX_DEFINE_OBJECT_TYPE("dx.string_format",
+                      dx_string_format,
+                      dx_object)
+
+static void dx_string_format_destruct(dx_string_format* self) {
+  // The literal Bytes are stored in the same block as the operations.
+  self->bytes = NULL;
+  dx_memory_deallocate(self->ops);
+  self->ops = NULL;
+}
+
+int dx_string_format_construct(dx_string_format* self, char const* bytes, dx_size number_of_bytes) {
+  if (!self || !bytes) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx_rti_type* _type = dx_string_format_get_type();
+  if (!_type) {
+    return 1;
+  }
+  if (dx__format_compile(bytes, bytes + number_of_bytes, &self->ops, &self->number_of_ops, &self->bytes, &self->number_of_bytes)) {
+    return 1;
+  }
+  DX_OBJECT(self)->type = _type;
+  return 0;
+}
+
+dx_string_format* dx_string_format_create(char const* bytes, dx_size number_of_bytes) {
+  dx_rti_type* _type = dx_string_format_get_type();
+  if (!_type) {
+    return NULL;
+  }
+  dx_string_format* self = DX_STRING_FORMAT(dx_object_alloc(sizeof(dx_string_format)));
+  if (!self) {
+    return NULL;
+  }
+  if (dx_string_format_construct(self, bytes, number_of_bytes)) {
+    DX_UNREFERENCE(self);
+    self = NULL;
+    return NULL;
+  }
+  return self;
+}
+
+int dx_string_format_printv(dx_string_format* self, dx_byte_array* buffer, va_list arguments) {
+  if (!self || !buffer) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx__format_sink sink = { .array = buffer, .bytes = NULL, .capacity = 0, .size = 0 };
+  return dx__format_execute_v(&sink, self->ops, self->number_of_ops, self->bytes, arguments);
+}
+
+int dx_string_format_print(dx_string_format* self, dx_byte_array* buffer, ...) {
+  va_list arguments;
+  va_start(arguments, buffer);
+  int result = dx_string_format_printv(self, buffer, arguments);
+  va_end(arguments);
+  return result;
+}
+
+int dx_string_format_print_bytesv(dx_string_format* self, char* bytes, dx_size capacity, dx_size* number_of_bytes, va_list arguments) {
+  if (!self || !bytes || !number_of_bytes) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx__format_sink sink = { .array = NULL, .bytes = bytes, .capacity = capacity, .size = 0 };
+  if (dx__format_execute_v(&sink, self->ops, self->number_of_ops, self->bytes, arguments)) {
+    return 1;
+  }
+  *number_of_bytes = sink.size;
+  return 0;
+}
+
+int dx_string_format_print_bytes(dx_string_format* self, char* bytes, dx_size capacity, dx_size* number_of_bytes, ...) {
+  va_list arguments;
+  va_start(arguments, number_of_bytes);
+  int result = dx_string_format_print_bytesv(self, bytes, capacity, number_of_bytes, arguments);
+  va_end(arguments);
+  return result;
+}
+
+dx_string* dx_string_format_printfv(dx_string_format* self, va_list arguments) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return NULL;
+  }
+  // Most results are short: Format into a stack buffer first and use a dx_byte_array object only if that buffer is too small.
+  char temporary[256];
+  dx__format_sink sink = { .array = NULL, .bytes = temporary, .capacity = sizeof(temporary), .size = 0 };
+  dx_error error = dx_get_error();
+  if (!dx__format_execute_v(&sink, self->ops, self->number_of_ops, self->bytes, arguments)) {
+    return dx_string_create(temporary, sink.size);
+  }
+  if (dx_get_error() != DX_OVERFLOW) {
+    return NULL;
+  }
+  dx_set_error(error);
+  dx_byte_array buffer;
+  if (dx_byte_array_initialize(&buffer)) {
+    return NULL;
+  }
+  sink = (dx__format_sink){ .array = &buffer, .bytes = NULL, .capacity = 0, .size = 0 };
+  if (dx__format_execute_v(&sink, self->ops, self->number_of_ops, self->bytes, arguments)) {
+    dx_byte_array_uninitialize(&buffer);
+    return NULL;
+  }
+  dx_string* string = dx_string_create(buffer.elements, buffer.size);
+  dx_byte_array_uninitialize(&buffer);
+  return string;
+}
+
+dx_string* dx_string_format_printf(dx_string_format* self, ...) {
+  va_list arguments;
+  va_start(arguments, self);
+  dx_string* string = dx_string_format_printfv(self, arguments);
+  va_end(arguments);
+  return string;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 int dx_string_construct(dx_string* self, char const* bytes, dx_size number_of_bytes) {
   if (!self || !bytes) {
     dx_set_error(DX_INVALID_ARGUMENT);
@@ -38,6 +176,12 @@ int dx_string_construct(dx_string* self, char const* bytes, dx_size number_of_by
   }
   memcpy(self->bytes, bytes, number_of_bytes);
   self->number_of_bytes = number_of_bytes;
+  self->is_interned = false;
+  self->flags = 0;
+  self->hash_value = dx_hash_bytes(bytes, number_of_bytes);
+#if defined(DX_STRING_VALIDATE_ON_CREATION_ENABLED) && 1 == DX_STRING_VALIDATE_ON_CREATION_ENABLED
+  _dx_string_validate(self);
+#endif
   return 0;
 }
 
@@ -68,6 +212,157 @@ dx_size dx_string_get_number_of_bytes(dx_string const* self) {
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/// @brief The initial capacity of the atom table.
+#define DX_ATOMS_MINIMAL_CAPACITY (64)
+
+/// @brief The lock of the atom table.
+/// Lookups acquire the lock in shared mode, insertions acquire the lock in exclusive mode.
+static SRWLOCK g_atoms_lock = SRWLOCK_INIT;
+
+/// @brief The atom table.
+/// An open addressing hash table with linear probing.
+/// Its capacity is either zero or a power of two.
+/// It holds a reference to each of its atoms.
+static struct {
+  dx_string** elements;
+  dx_size size;
+  dx_size capacity;
+} g_atoms = { .elements = NULL, .size = 0, .capacity = 0 };
+
+static dx_string* _dx_atoms_find(char const* bytes, dx_size number_of_bytes, dx_size hash_value) {
+  if (!g_atoms.capacity) {
+    return NULL;
+  }
+  dx_size mask = g_atoms.capacity - 1;
+  for (dx_size i = hash_value & mask; g_atoms.elements[i]; i = (i + 1) & mask) {
+    dx_string* atom = g_atoms.elements[i];
+    if (atom->hash_value == hash_value && atom->number_of_bytes == number_of_bytes && !memcmp(atom->bytes, bytes, number_of_bytes)) {
+      return atom;
+    }
+  }
+  return NULL;
+}
+
+static void _dx_atoms_insert(dx_string** elements, dx_size capacity, dx_string* atom) {
+  dx_size mask = capacity - 1;
+  dx_size i = atom->hash_value & mask;
+  while (elements[i]) {
+    i = (i + 1) & mask;
+  }
+  elements[i] = atom;
+}
+
+static int _dx_atoms_grow() {
+  dx_size new_capacity = g_atoms.capacity ? g_atoms.capacity * 2 : DX_ATOMS_MINIMAL_CAPACITY;
+  if (new_capacity < g_atoms.capacity || SIZE_MAX / sizeof(dx_string*) < new_capacity) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return 1;
+  }
+  dx_string** new_elements = dx_memory_allocate(sizeof(dx_string*) * new_capacity);
+  if (!new_elements) {
+    return 1;
+  }
+  memset(new_elements, 0, sizeof(dx_string*) * new_capacity);
+  for (dx_size i = 0, n = g_atoms.capacity; i < n; ++i) {
+    if (g_atoms.elements[i]) {
+      _dx_atoms_insert(new_elements, new_capacity, g_atoms.elements[i]);
+    }
+  }
+  if (g_atoms.elements) {
+    dx_memory_deallocate(g_atoms.elements);
+  }
+  g_atoms.elements = new_elements;
+  g_atoms.capacity = new_capacity;
+  return 0;
+}
+
+static dx_string* _dx_string_create_atom(char const* bytes, dx_size number_of_bytes, dx_size hash_value) {
+  // Fast path: The atom exists.
+  AcquireSRWLockShared(&g_atoms_lock);
+  dx_string* atom = _dx_atoms_find(bytes, number_of_bytes, hash_value);
+  if (atom) {
+    DX_REFERENCE(atom);
+  }
+  ReleaseSRWLockShared(&g_atoms_lock);
+  if (atom) {
+    return atom;
+  }
+  // Slow path: The atom might not exist.
+  AcquireSRWLockExclusive(&g_atoms_lock);
+  atom = _dx_atoms_find(bytes, number_of_bytes, hash_value);
+  if (atom) {
+    DX_REFERENCE(atom);
+    ReleaseSRWLockExclusive(&g_atoms_lock);
+    return atom;
+  }
+  // Atoms and the atom table must outlive the current arena (if any).
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  // Keep the load factor at or below 3/4.
+  if ((g_atoms.size + 1) * 4 > g_atoms.capacity * 3) {
+    if (_dx_atoms_grow()) {
+      dx_memory_set_current_arena(arena);
+      ReleaseSRWLockExclusive(&g_atoms_lock);
+      return NULL;
+    }
+  }
+  atom = dx_string_create(bytes, number_of_bytes);
+  dx_memory_set_current_arena(arena);
+  if (!atom) {
+    ReleaseSRWLockExclusive(&g_atoms_lock);
+    return NULL;
+  }
+  atom->is_interned = true;
+  _dx_atoms_insert(g_atoms.elements, g_atoms.capacity, atom);
+  g_atoms.size++;
+  // The reference of the atom table was acquired by dx_string_create.
+  DX_REFERENCE(atom);
+  ReleaseSRWLockExclusive(&g_atoms_lock);
+  return atom;
+}
+
+dx_string* dx_string_create_atom(char const* bytes, dx_size number_of_bytes) {
+  if (!bytes) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return NULL;
+  }
+  return _dx_string_create_atom(bytes, number_of_bytes, dx_hash_bytes(bytes, number_of_bytes));
+}
+
+dx_string* dx_string_intern(dx_string* self) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return NULL;
+  }
+  if (self->is_interned) {
+    DX_REFERENCE(self);
+    return self;
+  }
+  return _dx_string_create_atom(self->bytes, self->number_of_bytes, self->hash_value);
+}
+
+dx_bool dx_string_is_interned(dx_string const* self) {
+  return self && self->is_interned;
+}
+
+void dx_string_atoms_uninitialize() {
+  AcquireSRWLockExclusive(&g_atoms_lock);
+  for (dx_size i = 0, n = g_atoms.capacity; i < n; ++i) {
+    if (g_atoms.elements[i]) {
+      DX_UNREFERENCE(g_atoms.elements[i]);
+      g_atoms.elements[i] = NULL;
+    }
+  }
+  if (g_atoms.elements) {
+    dx_memory_deallocate(g_atoms.elements);
+    g_atoms.elements = NULL;
+  }
+  g_atoms.size = 0;
+  g_atoms.capacity = 0;
+  ReleaseSRWLockExclusive(&g_atoms_lock);
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 /// @brief
 /// Classify the first Byte of an UTF8 sequence to determine the length of the sequence.
 /// @param x
@@ -114,6 +409,14 @@ typedef struct y_utf8_it {
   bool error;
 } y_utf8_it;
 
+/// @brief Decode an UTF8 sequence to a code point.
+/// @param it The iterator.
+/// @param [out] n Pointer to a variable receiving the length of the sequence.
+/// @param [out] p Pointer to a variable receiving the code point.
+/// @return The zero value on success. A non-zero value on failure.
+/// The function fails if the iterator is at its end or if there is an encoding error.
+/// An encoding error is an invalid first Byte, a missing or invalid continuation Byte,
+/// an overlong sequence, a surrogate code point, or a code point greater than U+10FFFF.
 int y_utf8_decode(y_utf8_it* it, dx_size* n, uint32_t* p) {
   if (it->error || it->current == it->end) {
     return 1;
@@ -127,32 +430,117 @@ int y_utf8_decode(y_utf8_it* it, dx_size* n, uint32_t* p) {
     it->error = true;
     return 1;
   }
+  // Continuation Bytes are in the range 10xx xxxx.
+  for (dx_size i = 1; i < l; ++i) {
+    if ((it->current[i] & 0xC0) != 0x80) {
+      dx_set_error(DX_DECODING_FAILED);
+      it->error = true;
+      return 1;
+    }
+  }
+  uint32_t x;
   switch (l) {
   case 1: {
-    *p = it->current[0];
+    x = it->current[0];
   } break;
   case 2: {
-    *p = (it->current[0] << 8)
-      | (it->current[1] << 0);
+    x = ((uint32_t)(it->current[0] & 0x1F) << 6)
+      | ((uint32_t)(it->current[1] & 0x3F) << 0);
   } break;
   case 3: {
-    *p = (it->current[0] << 16)
-      | (it->current[1] << 8)
-      | (it->current[2] << 0);
+    x = ((uint32_t)(it->current[0] & 0x0F) << 12)
+      | ((uint32_t)(it->current[1] & 0x3F) << 6)
+      | ((uint32_t)(it->current[2] & 0x3F) << 0);
   } break;
   case 4: {
-    *p = (it->current[0] << 24)
-      | (it->current[1] << 16)
-      | (it->current[2] << 8)
-      | (it->current[3] << 0);
+    x = ((uint32_t)(it->current[0] & 0x07) << 18)
+      | ((uint32_t)(it->current[1] & 0x3F) << 12)
+      | ((uint32_t)(it->current[2] & 0x3F) << 6)
+      | ((uint32_t)(it->current[3] & 0x3F) << 0);
   } break;
   };
+  // Reject overlong sequences, surrogates, and code points beyond U+10FFFF.
+  static uint32_t const minima[] = { 0, 0x00, 0x80, 0x800, 0x10000 };
+  if (x < minima[l] || (x >= 0xD800 && x <= 0xDFFF) || x > 0x10FFFF) {
+    dx_set_error(DX_DECODING_FAILED);
+    it->error = true;
+    return 1;
+  }
+  *p = x;
   *n = l;
   it->current += l;
   return 0;
 }
 
+/// @brief Get the length of the longest prefix of an array of Bytes that consists of ASCII Bytes.
+/// @param p A pointer to an array of @a n Bytes.
+/// @param n The number of Bytes in the array pointed to by @a p.
+/// @return The length of the prefix.
+static dx_size _dx_utf8_ascii_prefix(uint8_t const* p, dx_size n) {
+  dx_size i = 0;
+#if defined(_M_X64)
+  // 32 and 16 Bytes at a time: A Byte is ASCII if its most significant bit is clear.
+  for (; i + 32 <= n; i += 32) {
+    __m128i x = _mm_loadu_si128((__m128i const*)(p + i));
+    __m128i y = _mm_loadu_si128((__m128i const*)(p + i + 16));
+    if (_mm_movemask_epi8(_mm_or_si128(x, y))) {
+      break;
+    }
+  }
+  for (; i + 16 <= n; i += 16) {
+    if (_mm_movemask_epi8(_mm_loadu_si128((__m128i const*)(p + i)))) {
+      break;
+    }
+  }
+#else
+  // 8 Bytes at a time.
+  for (; i + 8 <= n; i += 8) {
+    uint64_t x;
+    memcpy(&x, p + i, 8);
+    if (x & UINT64_C(0x8080808080808080)) {
+      break;
+    }
+  }
+#endif
+  while (i < n && p[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+static void _dx_string_validate(dx_string* self) {
+  uint8_t const* p = (uint8_t const*)self->bytes;
+  dx_size n = self->number_of_bytes;
+  dx_size i = _dx_utf8_ascii_prefix(p, n);
+  if (i == n) {
+    self->flags |= DX_STRING_FLAGS_ASCII | DX_STRING_FLAGS_UTF8;
+    return;
+  }
+  // Validation must not clobber the error variable.
+  dx_error last_error = dx_get_error();
+  y_utf8_it it = { .current = p + i, .end = p + n, .error = false };
+  while (it.current != it.end) {
+    uint32_t x;
+    dx_size l;
+    if (y_utf8_decode(&it, &l, &x)) {
+      dx_set_error(last_error);
+      return;
+    }
+    it.current += _dx_utf8_ascii_prefix(it.current, (dx_size)(it.end - it.current));
+  }
+  self->flags |= DX_STRING_FLAGS_UTF8;
+}
+
 bool dx_string_contains_symbol(dx_string const* self, uint32_t symbol) {
+  // ASCII Bytes do not occur in multi-Byte sequences of valid UTF-8.
+  if (self->flags & DX_STRING_FLAGS_UTF8) {
+    if (symbol < 0x80) {
+      return NULL != memchr(self->bytes, (int)symbol, self->number_of_bytes);
+    }
+    if (self->flags & DX_STRING_FLAGS_ASCII) {
+      return false;
+    }
+  }
   y_utf8_it it = { .current = (uint8_t*)self->bytes,
                    .end = (uint8_t*)self->bytes + self->number_of_bytes,
                    .error = false };
@@ -171,6 +559,17 @@ bool dx_string_is_equal_to(dx_string const* self, dx_string const* other) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return false;
   }
+  if (self == other) {
+    return true;
+  }
+  // Two distinct atoms are never equal.
+  if (self->is_interned && other->is_interned) {
+    return false;
+  }
+  // Strings of different hash values are never equal.
+  if (self->hash_value != other->hash_value) {
+    return false;
+  }
   if (self->number_of_bytes != other->number_of_bytes) {
     return false;
   }
@@ -182,78 +581,15 @@ dx_size dx_string_get_hash_value(dx_string const* self) {
     dx_set_error(DX_INVALID_ARGUMENT);
     return 0;
   }
-  return dx_hash_bytes(self->bytes, self->number_of_bytes);
+  return self->hash_value;
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 int dx_str_to_i64(char const* p, dx_size l, int64_t* v) {
-  if (!p || !v) {
-    dx_set_error(DX_INVALID_ARGUMENT);
-    return 1;
-  }
-  char const* q = p + l;
-  bool negative = false;
-  if (p != q && *p == '-') {
-    negative = true;
-    p++;
-    l -= 1;
-  }
-  uint64_t u;
-  if (dx_str_to_u64(p, l, &u)) {
-    return 1;
-  }
-  // neither +u nor -u can be represented by an int64_t value.
-  if (u > INT64_MAX) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  // u is within the range of [0,INT64_MAX].
-  int64_t w = negative ? -(int64_t)u : +(int64_t)u;
-  *v = w;
-  return 0;
+  return dx_convert_utf8bytes_to_i64(p, l, v);
 }
 
 int dx_str_to_u64(char const* p, dx_size l, uint64_t* v) {
-  if (!p || !v) {
-    dx_set_error(DX_INVALID_ARGUMENT);
-    return 1;
-  }
-  char const* q = p + l;
-  bool negative = false;
-  if (p != q && *p == '+') {
-    p++;
-  } else if (p != q && *p == '-') {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  uint64_t u = 0;
-  // there must be at least one digit
-  if (!(p != q && '0' <= *p && *p <= '9')) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  do {
-    uint64_t overflow;
-    // safe multiply
-    u = dx_mul_u64(u, 10, &overflow);
-    if (overflow) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    uint64_t w = (*p) - '0';
-    // safe add
-    u = dx_add_u64(u, w, &overflow);
-    if (overflow) {
-      dx_set_error(DX_CONVERSION_FAILED);
-      return 1;
-    }
-    p++;
-  } while (p != q && '0' <= *p && *p <= '9');
-  if (p != q) {
-    dx_set_error(DX_CONVERSION_FAILED);
-    return 1;
-  }
-  *v = u;
-  return 0;
+  return dx_convert_utf8bytes_to_n64(p, l, v);
 }
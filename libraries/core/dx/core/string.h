@@ -2,6 +2,7 @@
 #define DX_CORE_STRING_H_INCLUDED
 
 #include "dx/core/object.h"
+#include "dx/core/byte_array.h"
 
 /// @brief The type of a string.
 typedef struct dx_string dx_string;
@@ -12,7 +13,7 @@ static inline dx_string* DX_STRING(void* p) {
 /// @details
 /// The following format specifiers are currently supported:
 /// - `${s}` a pointer to a dx_string object. Prints the contents of this string.
-/// - `$$` prints `%`.
+/// - `$$` prints `$`.
 /// - `${i8}` a dx_i8 value.
 /// - `${i16}` a dx_i16 value.
 /// - `${i32}` a dx_i32 value.
@@ -27,6 +28,107 @@ dx_string* dx_string_printfv(dx_string* format, va_list arguments);
 
 dx_string* dx_string_printf(dx_string* format, ...);
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief The type of a compiled format.
+/// @details
+/// A format (see dx_string_printfv for the supported format specifiers) is parsed once when the compiled format is created.
+/// The compiled format can then be used repeatedly to format into a dx_byte_array object, an array of Bytes, or a new string.
+DX_DECLARE_OBJECT_TYPE("dx.string_format",
+                       dx_string_format,
+                       dx_object)
+
+static inline dx_string_format* DX_STRING_FORMAT(void* p) {
+  return (dx_string_format*)p;
+}
+
+struct dx_string_format {
+  dx_object _parent;
+  /// @brief A pointer to an array of @a number_of_ops operations.
+  struct dx__format_op* ops;
+  dx_size number_of_ops;
+  /// @brief A pointer to an array of @a number_of_bytes literal Bytes referenced by the operations.
+  /// Stored in the same block as the operations.
+  char* bytes;
+  dx_size number_of_bytes;
+};
+
+/// @brief Construct this compiled format.
+/// @param self A pointer to this compiled format.
+/// @param bytes A pointer to an array of @a number_of_bytes Bytes, the format.
+/// @param number_of_bytes The number of Bytes in the array pointed to by @a bytes.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT the format is not valid
+/// - #DX_ALLOCATION_FAILED an allocation failed
+int dx_string_format_construct(dx_string_format* self, char const* bytes, dx_size number_of_bytes);
+
+/// @brief Create a compiled format.
+/// @param bytes A pointer to an array of @a number_of_bytes Bytes, the format.
+/// @param number_of_bytes The number of Bytes in the array pointed to by @a bytes.
+/// @return A pointer to the compiled format on success. A null pointer on failure.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT the format is not valid
+/// - #DX_ALLOCATION_FAILED an allocation failed
+dx_string_format* dx_string_format_create(char const* bytes, dx_size number_of_bytes);
+
+/// @brief Append the formatted arguments to a dx_byte_array object.
+/// @param self A pointer to this compiled format.
+/// @param buffer A pointer to the dx_byte_array object.
+/// @param arguments The arguments.
+/// @return The zero value on success. A non-zero value on failure.
+/// @remarks On failure, some Bytes may have been appended.
+/// @default-failure
+int dx_string_format_printv(dx_string_format* self, dx_byte_array* buffer, va_list arguments);
+
+/// @brief Append the formatted arguments to a dx_byte_array object.
+/// @param self A pointer to this compiled format.
+/// @param buffer A pointer to the dx_byte_array object.
+/// @return The zero value on success. A non-zero value on failure.
+/// @remarks On failure, some Bytes may have been appended.
+/// @default-failure
+int dx_string_format_print(dx_string_format* self, dx_byte_array* buffer, ...);
+
+/// @brief Write the formatted arguments to an array of Bytes.
+/// @param self A pointer to this compiled format.
+/// @param bytes A pointer to an array of @a capacity Bytes.
+/// @param capacity The number of Bytes in the array pointed to by @a bytes.
+/// @param number_of_bytes A pointer to a <code>dx_size</code> variable.
+/// @param arguments The arguments.
+/// @return The zero value on success. A non-zero value on failure.
+/// @success <code>*number_of_bytes</code> was assigned the number of Bytes written.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self, @a bytes, or @a number_of_bytes is a null pointer
+/// - #DX_OVERFLOW the formatted arguments do not fit into the array
+int dx_string_format_print_bytesv(dx_string_format* self, char* bytes, dx_size capacity, dx_size* number_of_bytes, va_list arguments);
+
+/// @brief Write the formatted arguments to an array of Bytes.
+/// @param self A pointer to this compiled format.
+/// @param bytes A pointer to an array of @a capacity Bytes.
+/// @param capacity The number of Bytes in the array pointed to by @a bytes.
+/// @param number_of_bytes A pointer to a <code>dx_size</code> variable.
+/// @return The zero value on success. A non-zero value on failure.
+/// @success <code>*number_of_bytes</code> was assigned the number of Bytes written.
+/// @default-failure
+/// - #DX_INVALID_ARGUMENT @a self, @a bytes, or @a number_of_bytes is a null pointer
+/// - #DX_OVERFLOW the formatted arguments do not fit into the array
+int dx_string_format_print_bytes(dx_string_format* self, char* bytes, dx_size capacity, dx_size* number_of_bytes, ...);
+
+/// @brief Create a string from the formatted arguments.
+/// @param self A pointer to this compiled format.
+/// @param arguments The arguments.
+/// @return A pointer to the string on success. A null pointer on failure.
+/// @default-failure
+dx_string* dx_string_format_printfv(dx_string_format* self, va_list arguments);
+
+/// @brief Create a string from the formatted arguments.
+/// @param self A pointer to this compiled format.
+/// @return A pointer to the string on success. A null pointer on failure.
+/// @default-failure
+dx_string* dx_string_format_printf(dx_string_format* self, ...);
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 /// @brief Create a string from an array of Bytes representing a value UTF-8 string.
 /// @param bytes A pointer to an array of @a number_of_bytes Bytes.
 /// @param number_of_bytes The number of Bytes in the array pointed to by @a bytes.
@@ -64,11 +166,55 @@ bool dx_string_is_equal_to(dx_string const* self, dx_string const* other);
 /// @brief Get the hash value of this string.
 /// @param self A pointer to this string.
 /// @return The hash value of this string. This may be @a 0. @a 0 is also returned on failure.
+/// @remarks The hash value is computed once when the string is created.
 /// @default-failure
 dx_size dx_string_get_hash_value(dx_string const* self);
 
+/// @brief Get the atom for an array of Bytes representing a valid UTF-8 string.
+/// @param bytes A pointer to an array of @a number_of_bytes Bytes.
+/// @param number_of_bytes The number of Bytes in the array pointed to by @a bytes.
+/// @return A pointer to the atom on success. A null pointer on failure.
+/// @remarks
+/// An atom is the canonical string for its contents:
+/// Two atoms are equal if and only if they are the same object.
+/// The atom is created and added to the atom table if it does not exist yet.
+/// The atom table holds a reference to each of its atoms until dx_string_atoms_uninitialize is invoked.
+/// Atoms are never allocated from the current arena of the calling thread.
+/// @default-failure
+dx_string* dx_string_create_atom(char const* bytes, dx_size number_of_bytes);
+
+/// @brief Get the atom for a string.
+/// @param self A pointer to the string.
+/// @return A pointer to the atom on success. A null pointer on failure.
+/// If the string is an atom, then a new reference to the string is returned.
+/// @default-failure
+dx_string* dx_string_intern(dx_string* self);
+
+/// @brief Get if a string is an atom.
+/// @param self A pointer to the string.
+/// @return @a true if the string is an atom. @a false otherwise.
+dx_bool dx_string_is_interned(dx_string const* self);
+
+/// @brief Release the references of the atom table to its atoms and clear the atom table.
+/// @remarks This function is invoked by dx_rti_unintialize.
+void dx_string_atoms_uninitialize();
+
+/// @brief Flag indicating that the Bytes of a string are ASCII.
+#define DX_STRING_FLAGS_ASCII (1)
+
+/// @brief Flag indicating that the Bytes of a string are valid UTF-8.
+#define DX_STRING_FLAGS_UTF8 (2)
+
 struct dx_string {
   dx_object _parent;
+  /// @brief @a true if this string is an atom.
+  dx_bool is_interned;
+  /// @brief A bitwise or of DX_STRING_FLAGS_* values.
+  /// If no flag is set, then the Bytes were not validated or are not valid UTF-8.
+  dx_n8 flags;
+  /// @brief The hash value of this string.
+  /// Computed when the string is created.
+  dx_size hash_value;
   dx_size number_of_bytes;
   char bytes[];
 };
@@ -107,4 +253,8 @@ int dx_str_to_i64(char const* p, dx_size l, int64_t* v);
 /// <code>*v</code> was assigned the value.
 int dx_str_to_u64(char const* p, dx_size l, uint64_t* v);
 
+#if defined(DX_STRING_FORMAT_WITH_TESTS) && 1 == DX_STRING_FORMAT_WITH_TESTS
+int dx_string_format_tests();
+#endif
+
 #endif // DX_CORE_STRING_H_INCLUDED
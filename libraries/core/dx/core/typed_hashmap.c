@@ -0,0 +1,286 @@
+#include "dx/core/typed_hashmap.h"
+
+#if defined(DX_TYPED_HASHMAP_WITH_TESTS) && 1 == DX_TYPED_HASHMAP_WITH_TESTS
+
+// The number of keys and values in the hashmaps of the tests.
+// Used to check that the lifetime hooks are invoked exactly once for each key and value added and removed.
+static dx_size g_number_of_keys = 0;
+static dx_size g_number_of_values = 0;
+
+static inline void _dx_typed_hashmap_tests_key_added(dx_size* key) {
+  g_number_of_keys++;
+}
+
+static inline void _dx_typed_hashmap_tests_key_removed(dx_size* key) {
+  g_number_of_keys--;
+}
+
+static inline void _dx_typed_hashmap_tests_value_added(dx_size* value) {
+  g_number_of_values++;
+}
+
+static inline void _dx_typed_hashmap_tests_value_removed(dx_size* value) {
+  g_number_of_values--;
+}
+
+// The number of keys copied by _dx_typed_hashmap_tests_copy_key.
+static dx_size g_number_of_copies = 0;
+
+static int _dx_typed_hashmap_tests_copy_key(dx_size* target, dx_size const* source) {
+  g_number_of_copies++;
+  *target = *source;
+  return 0;
+}
+
+static int _dx_typed_hashmap_tests_copy_key_failing(dx_size* target, dx_size const* source) {
+  dx_set_error(DX_ALLOCATION_FAILED);
+  return 1;
+}
+
+static inline bool _dx_typed_hashmap_tests_equal(dx_size const* a, dx_size const* b) {
+  return *a == *b;
+}
+
+static inline dx_size _dx_typed_hashmap_tests_hash(dx_size const* key) {
+  return dx_hash_sz(*key);
+}
+
+// All keys have the same control Byte and one of four home slots at the end of the table.
+// Hence the runs are long, wrap around the end of the table, and removals must shift entries backwards.
+static inline dx_size _dx_typed_hashmap_tests_hash_colliding(dx_size const* key) {
+  return DX_SIZE_GREATEST - (*key & 3);
+}
+
+DX_DEFINE_TYPED_HASHMAP(_dx_typed_hashmap_tests_map,
+                        dx_size,
+                        dx_size,
+                        _dx_typed_hashmap_tests_hash,
+                        _dx_typed_hashmap_tests_equal,
+                        _dx_typed_hashmap_tests_key_added,
+                        _dx_typed_hashmap_tests_key_removed,
+                        _dx_typed_hashmap_tests_value_added,
+                        _dx_typed_hashmap_tests_value_removed)
+
+DX_DEFINE_TYPED_HASHMAP(_dx_typed_hashmap_tests_colliding_map,
+                        dx_size,
+                        dx_size,
+                        _dx_typed_hashmap_tests_hash_colliding,
+                        _dx_typed_hashmap_tests_equal,
+                        _dx_typed_hashmap_tests_key_added,
+                        _dx_typed_hashmap_tests_key_removed,
+                        _dx_typed_hashmap_tests_value_added,
+                        _dx_typed_hashmap_tests_value_removed)
+
+// The tests are identical for both hashmaps and only differ in the hash function and the number of keys.
+// Hence they are defined by a macro.
+// - insert: add keys, look them up, replace values, check the size
+// - resize: the capacity is doubled exactly if the size would exceed 3/4 of the capacity and all entries are preserved
+// - erase: remove every other key, look up the removed and the remaining keys, remove a key which was removed
+// - reuse: removed slots are reused such that adding and removing keys at a constant size does not increase the capacity
+// - iteration: visits each entry exactly once
+// - find or insert: returns existing values and copies only the keys of added entries
+// - clear and uninitialize: remove all keys and values
+#define _DX_TYPED_HASHMAP_TESTS_DEFINE(C_NAME, NUMBER_OF_KEYS) \
+\
+  static int C_NAME##_check(C_NAME* self, dx_size begin, dx_size end, dx_size step, dx_size offset) { \
+    for (dx_size i = begin; i < end; i += step) { \
+      dx_size* value = C_NAME##_get(self, i); \
+      if (!value || *value != i + offset) { \
+        return 1; \
+      } \
+    } \
+    return 0; \
+  } \
+\
+  static int C_NAME##_test_insert_and_resize(C_NAME* self) { \
+    if (DX_HASHMAP_GROUP_WIDTH != C_NAME##_get_capacity(self) || 0 != C_NAME##_get_size(self)) { \
+      return 1; \
+    } \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; ++i) { \
+      dx_size old_capacity = C_NAME##_get_capacity(self); \
+      if (C_NAME##_set(self, i, i)) { \
+        return 1; \
+      } \
+      dx_size new_capacity = C_NAME##_get_capacity(self); \
+      dx_size expected_capacity = i + 1 > dx_hashmap_get_greatest_size(old_capacity) ? old_capacity * 2 : old_capacity; \
+      if (i + 1 != C_NAME##_get_size(self) || expected_capacity != new_capacity) { \
+        return 1; \
+      } \
+      if (old_capacity != new_capacity && C_NAME##_check(self, 0, i + 1, 1, 0)) { \
+        return 1; \
+      } \
+    } \
+    if (C_NAME##_check(self, 0, NUMBER_OF_KEYS, 1, 0)) { \
+      return 1; \
+    } \
+    if (C_NAME##_get(self, NUMBER_OF_KEYS) || DX_NOT_FOUND != dx_get_error()) { \
+      return 1; \
+    } \
+    dx_set_error(DX_NO_ERROR); \
+    /* Replace the values. */ \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; ++i) { \
+      if (C_NAME##_set(self, i, i + 1)) { \
+        return 1; \
+      } \
+    } \
+    if (NUMBER_OF_KEYS != C_NAME##_get_size(self)) { \
+      return 1; \
+    } \
+    if (C_NAME##_check(self, 0, NUMBER_OF_KEYS, 1, 1)) { \
+      return 1; \
+    } \
+    return 0; \
+  } \
+\
+  static int C_NAME##_test_erase(C_NAME* self) { \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; i += 2) { \
+      if (C_NAME##_remove(self, i)) { \
+        return 1; \
+      } \
+    } \
+    if (NUMBER_OF_KEYS / 2 != C_NAME##_get_size(self)) { \
+      return 1; \
+    } \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; i += 2) { \
+      if (C_NAME##_get(self, i) || DX_NOT_FOUND != dx_get_error()) { \
+        return 1; \
+      } \
+      dx_set_error(DX_NO_ERROR); \
+    } \
+    if (C_NAME##_check(self, 1, NUMBER_OF_KEYS, 2, 1)) { \
+      return 1; \
+    } \
+    if (!C_NAME##_remove(self, 0) || DX_NOT_FOUND != dx_get_error()) { \
+      return 1; \
+    } \
+    dx_set_error(DX_NO_ERROR); \
+    return 0; \
+  } \
+\
+  static int C_NAME##_test_reuse(C_NAME* self) { \
+    dx_size capacity = C_NAME##_get_capacity(self); \
+    dx_size size = C_NAME##_get_size(self); \
+    /* Add the removed keys again. */ \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; i += 2) { \
+      if (C_NAME##_set(self, i, i + 1)) { \
+        return 1; \
+      } \
+    } \
+    if (capacity != C_NAME##_get_capacity(self) || NUMBER_OF_KEYS != C_NAME##_get_size(self)) { \
+      return 1; \
+    } \
+    if (C_NAME##_check(self, 0, NUMBER_OF_KEYS, 1, 1)) { \
+      return 1; \
+    } \
+    /* Remove the keys again and add and remove new keys at a constant size. */ \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; i += 2) { \
+      if (C_NAME##_remove(self, i)) { \
+        return 1; \
+      } \
+    } \
+    for (dx_size i = NUMBER_OF_KEYS; i < 16 * NUMBER_OF_KEYS; ++i) { \
+      if (C_NAME##_set(self, i, i + 1) || C_NAME##_remove(self, i)) { \
+        return 1; \
+      } \
+    } \
+    if (capacity != C_NAME##_get_capacity(self) || size != C_NAME##_get_size(self)) { \
+      return 1; \
+    } \
+    if (C_NAME##_check(self, 1, NUMBER_OF_KEYS, 2, 1)) { \
+      return 1; \
+    } \
+    return 0; \
+  } \
+\
+  static int C_NAME##_test_iterate(C_NAME* self) { \
+    dx_size n = 0, sum = 0; \
+    for (dx_size i = C_NAME##_next(self, 0); i < C_NAME##_get_capacity(self); i = C_NAME##_next(self, i + 1)) { \
+      C_NAME##_entry* entry = C_NAME##_get_entry(self, i); \
+      if (entry->value != entry->key + 1) { \
+        return 1; \
+      } \
+      n++; \
+      sum += entry->key; \
+    } \
+    /* The remaining keys are the odd keys 1, 3, ..., 2n - 1 of which the sum is n^2. */ \
+    if (n != C_NAME##_get_size(self) || sum != n * n) { \
+      return 1; \
+    } \
+    return 0; \
+  } \
+\
+  static int C_NAME##_test_find_or_insert(C_NAME* self) { \
+    g_number_of_copies = 0; \
+    for (dx_size i = 0; i < NUMBER_OF_KEYS; ++i) { \
+      dx_size* value = C_NAME##_find_or_insert(self, i, i % 2 ? 0 : i + 1, &_dx_typed_hashmap_tests_copy_key); \
+      if (!value || *value != i + 1) { \
+        return 1; \
+      } \
+    } \
+    if (NUMBER_OF_KEYS / 2 != g_number_of_copies || NUMBER_OF_KEYS != C_NAME##_get_size(self)) { \
+      return 1; \
+    } \
+    if (C_NAME##_check(self, 0, NUMBER_OF_KEYS, 1, 1)) { \
+      return 1; \
+    } \
+    /* The copy of the key is not created for existing keys. If it cannot be created, then no entry is added. */ \
+    dx_size* value = C_NAME##_find_or_insert(self, 0, 0, &_dx_typed_hashmap_tests_copy_key_failing); \
+    if (!value || *value != 1) { \
+      return 1; \
+    } \
+    if (C_NAME##_find_or_insert(self, NUMBER_OF_KEYS, 0, &_dx_typed_hashmap_tests_copy_key_failing) || DX_ALLOCATION_FAILED != dx_get_error()) { \
+      return 1; \
+    } \
+    dx_set_error(DX_NO_ERROR); \
+    if (NUMBER_OF_KEYS != C_NAME##_get_size(self) || C_NAME##_get(self, NUMBER_OF_KEYS)) { \
+      return 1; \
+    } \
+    dx_set_error(DX_NO_ERROR); \
+    return 0; \
+  } \
+\
+  static int C_NAME##_tests() { \
+    C_NAME map; \
+    if (C_NAME##_initialize(&map)) { \
+      return 1; \
+    } \
+    if (C_NAME##_test_insert_and_resize(&map) || C_NAME##_test_erase(&map) || C_NAME##_test_reuse(&map) || C_NAME##_test_iterate(&map) || \
+        C_NAME##_test_find_or_insert(&map)) { \
+      C_NAME##_uninitialize(&map); \
+      return 1; \
+    } \
+    if (g_number_of_keys != C_NAME##_get_size(&map) || g_number_of_values != C_NAME##_get_size(&map)) { \
+      C_NAME##_uninitialize(&map); \
+      return 1; \
+    } \
+    if (C_NAME##_clear(&map) || 0 != C_NAME##_get_size(&map) || 0 != g_number_of_keys || 0 != g_number_of_values) { \
+      C_NAME##_uninitialize(&map); \
+      return 1; \
+    } \
+    if (C_NAME##_set(&map, 1, 2) || C_NAME##_check(&map, 1, 2, 1, 1)) { \
+      C_NAME##_uninitialize(&map); \
+      return 1; \
+    } \
+    C_NAME##_uninitialize(&map); \
+    if (0 != g_number_of_keys || 0 != g_number_of_values) { \
+      return 1; \
+    } \
+    return 0; \
+  }
+
+_DX_TYPED_HASHMAP_TESTS_DEFINE(_dx_typed_hashmap_tests_map, (4 * 1024))
+
+// The runs of the colliding hashmap are as long as the hashmap is large. Hence fewer keys are used.
+_DX_TYPED_HASHMAP_TESTS_DEFINE(_dx_typed_hashmap_tests_colliding_map, 256)
+
+int dx_typed_hashmap_tests() {
+  if (_dx_typed_hashmap_tests_map_tests()) {
+    return 1;
+  }
+  if (_dx_typed_hashmap_tests_colliding_map_tests()) {
+    return 1;
+  }
+  return 0;
+}
+
+#endif // DX_TYPED_HASHMAP_WITH_TESTS
@@ -0,0 +1,440 @@
+#if !defined(DX_CORE_TYPED_HASHMAP_H_INCLUDED)
+#define DX_CORE_TYPED_HASHMAP_H_INCLUDED
+
+#include "dx/core/memory.h"
+#include "dx/core/safe_mul_nx.h"
+
+#if defined(_M_X64)
+  // _mm_loadu_si128, _mm_movemask_epi8, _mm_cmpeq_epi8, _mm_set1_epi8
+  #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+  // _BitScanForward64
+  #include <intrin.h>
+#endif
+
+// memcpy, memset
+#include <string.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+// Control Bytes shared by dx_pointer_hashmap and the typed hashmaps.
+// Each slot of a hashmap has a control Byte which is either DX_HASHMAP_CONTROL_EMPTY, DX_HASHMAP_CONTROL_DELETED,
+// or the 7 most significant Bits of the hash value of the key in that slot.
+// A group of control Bytes (16 Bytes using SSE2, 8 Bytes otherwise) is compared at once.
+
+/// @brief The control Byte of an empty slot.
+#define DX_HASHMAP_CONTROL_EMPTY (0x80)
+
+/// @brief The control Byte of a slot of which the entry was removed but which does not end a run.
+/// Only used by the old table of a dx_pointer_hashmap which is being resized incrementally.
+#define DX_HASHMAP_CONTROL_DELETED (0xFE)
+
+/// @brief Get if a control Byte is the control Byte of a slot with an entry.
+static inline bool dx_hashmap_control_is_full(dx_n8 control) {
+  return control < DX_HASHMAP_CONTROL_EMPTY;
+}
+
+#if defined(_M_X64)
+
+/// @brief The number of control Bytes in a group.
+#define DX_HASHMAP_GROUP_WIDTH (16)
+
+/// @brief A bitmask with one Bit for each control Byte of a group.
+typedef uint32_t dx_hashmap_bitmask;
+
+/// @brief log2 of the number of Bits in a bitmask per control Byte.
+#define DX_HASHMAP_BITMASK_SHIFT (0)
+
+/// @brief Get the bitmask of the control Bytes of a group equal to a control Byte.
+/// @param control A pointer to the first control Byte of the group.
+/// @param h2 The control Byte.
+/// @return The bitmask.
+static inline dx_hashmap_bitmask dx_hashmap_group_match(dx_n8 const* control, dx_n8 h2) {
+  __m128i group = _mm_loadu_si128((__m128i const*)control);
+  return (dx_hashmap_bitmask)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+/// @brief Get the bitmask of the empty control Bytes of a group.
+/// @param control A pointer to the first control Byte of the group.
+/// @return The bitmask.
+static inline dx_hashmap_bitmask dx_hashmap_group_match_empty(dx_n8 const* control) {
+  return dx_hashmap_group_match(control, DX_HASHMAP_CONTROL_EMPTY);
+}
+
+#else
+
+#define DX_HASHMAP_GROUP_WIDTH (8)
+
+typedef uint64_t dx_hashmap_bitmask;
+
+#define DX_HASHMAP_BITMASK_SHIFT (3)
+
+static inline dx_hashmap_bitmask dx_hashmap_group_match(dx_n8 const* control, dx_n8 h2) {
+  static uint64_t const LSBS = UINT64_C(0x0101010101010101);
+  static uint64_t const MSBS = UINT64_C(0x8080808080808080);
+  uint64_t group;
+  memcpy(&group, control, sizeof(uint64_t));
+  uint64_t x = group ^ (LSBS * h2);
+  // May report a false positive for a Byte following a matching Byte. This is fine as the keys are compared.
+  return (x - LSBS) & ~x & MSBS;
+}
+
+static inline dx_hashmap_bitmask dx_hashmap_group_match_empty(dx_n8 const* control) {
+  static uint64_t const MSBS = UINT64_C(0x8080808080808080);
+  uint64_t group;
+  memcpy(&group, control, sizeof(uint64_t));
+  // DX_HASHMAP_CONTROL_EMPTY and DX_HASHMAP_CONTROL_DELETED are the only control Bytes with their most significant Bit set.
+  // Of these, only DX_HASHMAP_CONTROL_EMPTY has its second most significant Bit cleared.
+  return group & ~(group << 1) & MSBS;
+}
+
+#endif
+
+/// @brief Get the index of the first control Byte in a non-zero bitmask.
+static inline dx_size dx_hashmap_bitmask_first(dx_hashmap_bitmask x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index;
+  _BitScanForward64(&index, (uint64_t)x);
+  return (dx_size)index >> DX_HASHMAP_BITMASK_SHIFT;
+#else
+  dx_size index = 0;
+  while (!(x & 1)) {
+    x >>= 1;
+    index++;
+  }
+  return index >> DX_HASHMAP_BITMASK_SHIFT;
+#endif
+}
+
+/// @brief Remove the first control Byte from a non-zero bitmask.
+static inline dx_hashmap_bitmask dx_hashmap_bitmask_next(dx_hashmap_bitmask x) {
+  return x & (x - 1);
+}
+
+/// @brief Get the control Byte for a hash value.
+static inline dx_n8 dx_hashmap_h2(dx_size hash_value) {
+  return (dx_n8)(hash_value >> (sizeof(dx_size) * 8 - 7));
+}
+
+/// @brief Get the greatest size of a hashmap for a capacity.
+/// The maximal load factor is 3/4.
+static inline dx_size dx_hashmap_get_greatest_size(dx_size capacity) {
+  return capacity - capacity / 4;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief A hook which does nothing.
+/// Can be passed as a lifetime hook to DX_DEFINE_TYPED_HASHMAP.
+#define DX_TYPED_HASHMAP_NO_HOOK(P) ((void)(P))
+
+/// @brief Define a typed hashmap.
+/// @details
+/// Defines the type @a C_NAME of a hashmap with keys of type @a KEY and values of type @a VALUE, both stored inline,
+/// and the following functions:
+/// @code
+/// int C_NAME_initialize(C_NAME* self);
+/// void C_NAME_uninitialize(C_NAME* self);
+/// int C_NAME_clear(C_NAME* self);
+/// int C_NAME_set(C_NAME* self, KEY key, VALUE value);
+/// VALUE* C_NAME_get(C_NAME const* self, KEY key);
+/// VALUE* C_NAME_find_or_insert(C_NAME* self, KEY key, VALUE value, int (*copy_key)(KEY* target, KEY const* source));
+/// int C_NAME_remove(C_NAME* self, KEY key);
+/// dx_size C_NAME_get_size(C_NAME const* self);
+/// dx_size C_NAME_get_capacity(C_NAME const* self);
+/// C_NAME_entry* C_NAME_get_entry(C_NAME const* self, dx_size index);
+/// dx_size C_NAME_next(C_NAME const* self, dx_size index);
+/// @endcode
+/// The hooks are invoked directly such that they can be inlined. They are functions or function-like macros:
+/// - <code>dx_size HASH(KEY const*)</code> computes the hash value of a key.
+/// - <code>bool EQUAL(KEY const*, KEY const*)</code> compares two keys.
+/// - <code>void KEY_ADDED(KEY*)</code>, <code>void KEY_REMOVED(KEY*)</code> are invoked if a key is added to or removed from the hashmap.
+/// - <code>void VALUE_ADDED(VALUE*)</code>, <code>void VALUE_REMOVED(VALUE*)</code> are invoked if a value is added to or removed from the hashmap.
+/// Pass DX_TYPED_HASHMAP_NO_HOOK for a lifetime hook which should do nothing.
+/// @remarks
+/// The hashmap is an open addressing hash table with linear probing using the control Bytes above.
+/// Its capacity is a power of two which is doubled if the load factor would exceed 3/4.
+/// Entries are removed by shifting the subsequent entries of their run backwards such that no tombstones are required.
+#define DX_DEFINE_TYPED_HASHMAP(C_NAME, KEY, VALUE, HASH, EQUAL, KEY_ADDED, KEY_REMOVED, VALUE_ADDED, VALUE_REMOVED) \
+\
+  typedef struct C_NAME##_entry { \
+    dx_size hash_value; \
+    KEY key; \
+    VALUE value; \
+  } C_NAME##_entry; \
+\
+  typedef struct C_NAME { \
+    /** @brief A pointer to an array of @a capacity entries followed by @a capacity + DX_HASHMAP_GROUP_WIDTH - 1 control Bytes. */ \
+    C_NAME##_entry* entries; \
+    /** @brief A pointer to the control Bytes. The last DX_HASHMAP_GROUP_WIDTH - 1 control Bytes are copies of the first ones. */ \
+    dx_n8* control; \
+    dx_size size; \
+    dx_size capacity; \
+  } C_NAME; \
+\
+  static inline void C_NAME##_set_control(C_NAME* self, dx_size index, dx_n8 control) { \
+    self->control[index] = control; \
+    if (index < DX_HASHMAP_GROUP_WIDTH - 1) { \
+      self->control[self->capacity + index] = control; \
+    } \
+  } \
+\
+  static inline int C_NAME##_allocate(dx_size capacity, C_NAME##_entry** entries, dx_n8** control) { \
+    dx_size overflow; \
+    dx_size n = dx_mul_sz(capacity, sizeof(C_NAME##_entry), &overflow); \
+    if (overflow || DX_SIZE_GREATEST - n < capacity + DX_HASHMAP_GROUP_WIDTH - 1) { \
+      dx_set_error(DX_ALLOCATION_FAILED); \
+      return 1; \
+    } \
+    C_NAME##_entry* entries1 = dx_memory_allocate(n + capacity + DX_HASHMAP_GROUP_WIDTH - 1); \
+    if (!entries1) { \
+      return 1; \
+    } \
+    *control = (dx_n8*)(entries1 + capacity); \
+    memset(*control, DX_HASHMAP_CONTROL_EMPTY, capacity + DX_HASHMAP_GROUP_WIDTH - 1); \
+    *entries = entries1; \
+    return 0; \
+  } \
+\
+  static inline dx_size C_NAME##_find(C_NAME const* self, dx_size hash_value, KEY const* key) { \
+    dx_size const mask = self->capacity - 1; \
+    dx_n8 const h2 = dx_hashmap_h2(hash_value); \
+    dx_size position = hash_value & mask; \
+    while (true) { \
+      dx_hashmap_bitmask match = dx_hashmap_group_match(self->control + position, h2); \
+      while (match) { \
+        dx_size index = (position + dx_hashmap_bitmask_first(match)) & mask; \
+        C_NAME##_entry const* entry = &self->entries[index]; \
+        if (entry->hash_value == hash_value && EQUAL(&entry->key, key)) { \
+          return index; \
+        } \
+        match = dx_hashmap_bitmask_next(match); \
+      } \
+      if (dx_hashmap_group_match_empty(self->control + position)) { \
+        return self->capacity; \
+      } \
+      position = (position + DX_HASHMAP_GROUP_WIDTH) & mask; \
+    } \
+  } \
+\
+  static inline dx_size C_NAME##_find_empty(C_NAME const* self, dx_size hash_value) { \
+    dx_size const mask = self->capacity - 1; \
+    dx_size position = hash_value & mask; \
+    while (true) { \
+      dx_hashmap_bitmask empty = dx_hashmap_group_match_empty(self->control + position); \
+      if (empty) { \
+        return (position + dx_hashmap_bitmask_first(empty)) & mask; \
+      } \
+      position = (position + DX_HASHMAP_GROUP_WIDTH) & mask; \
+    } \
+  } \
+\
+  static inline int C_NAME##_set_capacity(C_NAME* self, dx_size new_capacity) { \
+    C_NAME##_entry* new_entries; \
+    dx_n8* new_control; \
+    if (C_NAME##_allocate(new_capacity, &new_entries, &new_control)) { \
+      return 1; \
+    } \
+    C_NAME##_entry* old_entries = self->entries; \
+    dx_n8* old_control = self->control; \
+    dx_size old_capacity = self->capacity; \
+    self->entries = new_entries; \
+    self->control = new_control; \
+    self->capacity = new_capacity; \
+    for (dx_size i = 0; i < old_capacity; ++i) { \
+      if (old_control[i] != DX_HASHMAP_CONTROL_EMPTY) { \
+        dx_size index = C_NAME##_find_empty(self, old_entries[i].hash_value); \
+        self->entries[index] = old_entries[i]; \
+        C_NAME##_set_control(self, index, old_control[i]); \
+      } \
+    } \
+    dx_memory_deallocate(old_entries); \
+    return 0; \
+  } \
+\
+  static inline int C_NAME##_initialize(C_NAME* self) { \
+    if (!self) { \
+      dx_set_error(DX_INVALID_ARGUMENT); \
+      return 1; \
+    } \
+    if (C_NAME##_allocate(DX_HASHMAP_GROUP_WIDTH, &self->entries, &self->control)) { \
+      return 1; \
+    } \
+    self->size = 0; \
+    self->capacity = DX_HASHMAP_GROUP_WIDTH; \
+    return 0; \
+  } \
+\
+  static inline int C_NAME##_clear(C_NAME* self) { \
+    if (!self) { \
+      dx_set_error(DX_INVALID_ARGUMENT); \
+      return 1; \
+    } \
+    for (dx_size i = 0, n = self->capacity; i < n && self->size; ++i) { \
+      if (self->control[i] != DX_HASHMAP_CONTROL_EMPTY) { \
+        VALUE_REMOVED(&self->entries[i].value); \
+        KEY_REMOVED(&self->entries[i].key); \
+        self->size--; \
+      } \
+    } \
+    memset(self->control, DX_HASHMAP_CONTROL_EMPTY, self->capacity + DX_HASHMAP_GROUP_WIDTH - 1); \
+    self->size = 0; \
+    return 0; \
+  } \
+\
+  static inline void C_NAME##_uninitialize(C_NAME* self) { \
+    DX_DEBUG_ASSERT(NULL != self); \
+    C_NAME##_clear(self); \
+    dx_memory_deallocate(self->entries); \
+    self->entries = NULL; \
+    self->control = NULL; \
+  } \
+\
+  /** @brief Ensure an entry can be added without exceeding the maximal load factor. */ \
+  static inline int C_NAME##_reserve_one(C_NAME* self) { \
+    if (self->size + 1 > dx_hashmap_get_greatest_size(self->capacity)) { \
+      if (self->capacity > DX_SIZE_GREATEST / 2 / sizeof(C_NAME##_entry)) { \
+        dx_set_error(DX_ALLOCATION_FAILED); \
+        return 1; \
+      } \
+      if (C_NAME##_set_capacity(self, self->capacity * 2)) { \
+        return 1; \
+      } \
+    } \
+    return 0; \
+  } \
+\
+  /** @brief Add an entry for a key which is not in the hashmap. The capacity must have been reserved. */ \
+  static inline C_NAME##_entry* C_NAME##_insert(C_NAME* self, dx_size hash_value, KEY key, VALUE value) { \
+    dx_size index = C_NAME##_find_empty(self, hash_value); \
+    C_NAME##_entry* entry = &self->entries[index]; \
+    KEY_ADDED(&key); \
+    entry->key = key; \
+    VALUE_ADDED(&value); \
+    entry->value = value; \
+    entry->hash_value = hash_value; \
+    C_NAME##_set_control(self, index, dx_hashmap_h2(hash_value)); \
+    self->size++; \
+    return entry; \
+  } \
+\
+  /** @brief Add or replace an entry. */ \
+  static inline int C_NAME##_set(C_NAME* self, KEY key, VALUE value) { \
+    if (!self) { \
+      dx_set_error(DX_INVALID_ARGUMENT); \
+      return 1; \
+    } \
+    dx_size hash_value = HASH(&key); \
+    dx_size index = C_NAME##_find(self, hash_value, &key); \
+    if (index != self->capacity) { \
+      C_NAME##_entry* entry = &self->entries[index]; \
+      KEY_ADDED(&key); \
+      KEY_REMOVED(&entry->key); \
+      entry->key = key; \
+      VALUE_ADDED(&value); \
+      VALUE_REMOVED(&entry->value); \
+      entry->value = value; \
+      return 0; \
+    } \
+    if (C_NAME##_reserve_one(self)) { \
+      return 1; \
+    } \
+    C_NAME##_insert(self, hash_value, key, value); \
+    return 0; \
+  } \
+\
+  /** @brief Get a pointer to the value of an entry. If there is no such entry, add an entry. */ \
+  /** The hashmap is probed once. If an entry is added, its key is @a key if @a copy_key is a null pointer. */ \
+  /** Otherwise its key is the equal copy of @a key created by @a copy_key which is invoked only if an entry is added. */ \
+  /** @return A pointer to the value on success. A null pointer on failure. */ \
+  static inline VALUE* C_NAME##_find_or_insert(C_NAME* self, KEY key, VALUE value, int (*copy_key)(KEY* target, KEY const* source)) { \
+    if (!self) { \
+      dx_set_error(DX_INVALID_ARGUMENT); \
+      return NULL; \
+    } \
+    dx_size hash_value = HASH(&key); \
+    dx_size index = C_NAME##_find(self, hash_value, &key); \
+    if (index != self->capacity) { \
+      return &self->entries[index].value; \
+    } \
+    if (C_NAME##_reserve_one(self)) { \
+      return NULL; \
+    } \
+    if (copy_key) { \
+      KEY source = key; \
+      if (copy_key(&key, &source)) { \
+        return NULL; \
+      } \
+    } \
+    return &C_NAME##_insert(self, hash_value, key, value)->value; \
+  } \
+\
+  /** @brief Get a pointer to the value of an entry. @return A pointer to the value on success. A null pointer on failure. */ \
+  static inline VALUE* C_NAME##_get(C_NAME const* self, KEY key) { \
+    if (!self) { \
+      dx_set_error(DX_INVALID_ARGUMENT); \
+      return NULL; \
+    } \
+    dx_size index = C_NAME##_find(self, HASH(&key), &key); \
+    if (index == self->capacity) { \
+      dx_set_error(DX_NOT_FOUND); \
+      return NULL; \
+    } \
+    return &self->entries[index].value; \
+  } \
+\
+  static inline int C_NAME##_remove(C_NAME* self, KEY key) { \
+    if (!self) { \
+      dx_set_error(DX_INVALID_ARGUMENT); \
+      return 1; \
+    } \
+    dx_size index = C_NAME##_find(self, HASH(&key), &key); \
+    if (index == self->capacity) { \
+      dx_set_error(DX_NOT_FOUND); \
+      return 1; \
+    } \
+    C_NAME##_entry entry = self->entries[index]; \
+    dx_size const mask = self->capacity - 1; \
+    dx_size hole = index; \
+    for (dx_size current = (hole + 1) & mask; self->control[current] != DX_HASHMAP_CONTROL_EMPTY; current = (current + 1) & mask) { \
+      dx_size home = self->entries[current].hash_value & mask; \
+      if (((current - home) & mask) >= ((current - hole) & mask)) { \
+        self->entries[hole] = self->entries[current]; \
+        C_NAME##_set_control(self, hole, self->control[current]); \
+        hole = current; \
+      } \
+    } \
+    C_NAME##_set_control(self, hole, DX_HASHMAP_CONTROL_EMPTY); \
+    self->size--; \
+    VALUE_REMOVED(&entry.value); \
+    KEY_REMOVED(&entry.key); \
+    return 0; \
+  } \
+\
+  static inline dx_size C_NAME##_get_size(C_NAME const* self) { \
+    return self->size; \
+  } \
+\
+  static inline dx_size C_NAME##_get_capacity(C_NAME const* self) { \
+    return self->capacity; \
+  } \
+\
+  static inline C_NAME##_entry* C_NAME##_get_entry(C_NAME const* self, dx_size index) { \
+    return &self->entries[index]; \
+  } \
+\
+  /** @brief Get the index of the first entry at or after an index. @return The index of the entry if any. The capacity otherwise. */ \
+  static inline dx_size C_NAME##_next(C_NAME const* self, dx_size index) { \
+    while (index < self->capacity && self->control[index] == DX_HASHMAP_CONTROL_EMPTY) { \
+      index++; \
+    } \
+    return index; \
+  }
+
+#if defined(DX_TYPED_HASHMAP_WITH_TESTS) && 1 == DX_TYPED_HASHMAP_WITH_TESTS
+int dx_typed_hashmap_tests();
+#endif
+
+#endif // DX_CORE_TYPED_HASHMAP_H_INCLUDED
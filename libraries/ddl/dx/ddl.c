@@ -19,7 +19,7 @@ static dx_ddl_parser* _create_parser() {
   return parser;
 }
 
-dx_ddl_node* dx_ddl_compile(char const* p, dx_size n) {
+static dx_ddl_node* _compile(char const* p, dx_size n) {
   dx_ddl_parser* parser = _create_parser();
   if (!parser) {
     return NULL;
@@ -34,3 +34,19 @@ dx_ddl_node* dx_ddl_compile(char const* p, dx_size n) {
   parser = NULL;
   return node;
 }
+
+dx_ddl_node* dx_ddl_compile(char const* p, dx_size n) {
+  // The parser, the scanner, and the strings and arrays of the nodes are allocated from an arena.
+  // The nodes are pooled, hence they are not allocated from the arena.
+  // The memory of the arena is reclaimed when the last node is destroyed.
+  dx_memory_arena* arena = dx_memory_arena_create();
+  if (!arena) {
+    return NULL;
+  }
+  dx_memory_arena* previous_arena = dx_memory_set_current_arena(arena);
+  dx_ddl_node* node = _compile(p, n);
+  dx_memory_set_current_arena(previous_arena);
+  dx_memory_arena_destroy(arena);
+  arena = NULL;
+  return node;
+}
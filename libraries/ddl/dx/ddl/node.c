@@ -1,6 +1,10 @@
 #include "dx/ddl/node.h"
 
+#include "dx/core/typed_hashmap.h"
 #include <string.h>
+#if defined(DX_DDL_NODE_WITH_TESTS) && 1 == DX_DDL_NODE_WITH_TESTS && defined(DX_DDL_NODE_WITH_BENCHMARKS) && 1 == DX_DDL_NODE_WITH_BENCHMARKS
+#include "dx/core/os.h"
+#endif
 
 DX_DEFINE_OBJECT_TYPE("dx.ddl.node",
                       dx_ddl_node,
@@ -25,13 +29,208 @@ static void on_removed(dx_object** a) {
 }
 
 static dx_size on_hash_key(dx_object** a) {
-  return dx_string_get_hash_value(DX_STRING(*a));
+  // The hash value is cached by the string.
+  return DX_STRING(*a)->hash_value;
 }
 
 static bool on_compare_keys(dx_object** a, dx_object** b) {
   return dx_string_is_equal_to(DX_STRING(*a), DX_STRING(*b));
 }
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief An entry of an ADL map node.
+typedef struct dx_ddl_node_map_entry {
+  dx_string* name;
+  dx_ddl_node* value;
+} dx_ddl_node_map_entry;
+
+/// @brief The greatest number of entries of an ADL map node for which no index is maintained.
+#define DX_DDL_NODE_MAP_INDEX_THRESHOLD (DX_HASHMAP_GROUP_WIDTH)
+
+/// @brief The entries of an ADL map node.
+/// @remarks
+/// The entries are stored in insertion order in a flat array.
+/// Most maps have only a few entries (like "type", "name", "red", "green", and "blue"):
+/// As long as the number of entries does not exceed DX_DDL_NODE_MAP_INDEX_THRESHOLD,
+/// the control Bytes (see "dx/core/typed_hashmap.h") of the names are compared at once to find an entry.
+/// Otherwise an index from names to values is maintained.
+struct dx_ddl_node_map {
+  /// @brief A pointer to an array of @a capacity entries or a null pointer if @a capacity is zero.
+  dx_ddl_node_map_entry* entries;
+  /// @brief The number of entries.
+  dx_size size;
+  /// @brief The capacity of the array of entries.
+  dx_size capacity;
+  /// @brief A pointer to the index or a null pointer if @a size does not exceed DX_DDL_NODE_MAP_INDEX_THRESHOLD.
+  dx_pointer_hashmap* index;
+  /// @brief The control Bytes of the names of the first DX_DDL_NODE_MAP_INDEX_THRESHOLD entries.
+  /// The control Bytes of the unused entries are DX_HASHMAP_CONTROL_EMPTY.
+  dx_n8 control[DX_DDL_NODE_MAP_INDEX_THRESHOLD];
+};
+
+/// @brief Create an empty map.
+/// @return A pointer to the map on success. The null pointer on failure.
+static dx_ddl_node_map* _map_create();
+
+static void _map_destroy(dx_ddl_node_map* self);
+
+/// @brief Create the index of a map.
+/// @param self A pointer to the map.
+/// @return The zero value on success. A non-zero value on failure.
+static int _map_create_index(dx_ddl_node_map* self);
+
+/// @brief Get the value of an entry of a map.
+/// @param self A pointer to the map.
+/// @param name The name of the entry.
+/// @return A pointer to the value if an entry for the name was found. The null pointer otherwise.
+static dx_ddl_node* _map_find(dx_ddl_node_map const* self, dx_string* name);
+
+static int _map_add(dx_ddl_node_map* self, dx_string* name, dx_ddl_node* value);
+
+static dx_ddl_node_map* _map_create() {
+  dx_ddl_node_map* self = dx_memory_allocate(sizeof(dx_ddl_node_map));
+  if (!self) {
+    return NULL;
+  }
+  self->entries = NULL;
+  self->size = 0;
+  self->capacity = 0;
+  self->index = NULL;
+  memset(self->control, DX_HASHMAP_CONTROL_EMPTY, DX_DDL_NODE_MAP_INDEX_THRESHOLD);
+  return self;
+}
+
+static void _map_destroy(dx_ddl_node_map* self) {
+  if (self->index) {
+    dx_pointer_hashmap_uninitialize(self->index);
+    dx_memory_deallocate(self->index);
+    self->index = NULL;
+  }
+  for (dx_size i = 0, n = self->size; i < n; ++i) {
+    DX_UNREFERENCE(self->entries[i].value);
+    DX_UNREFERENCE(self->entries[i].name);
+  }
+  if (self->entries) {
+    dx_memory_deallocate(self->entries);
+    self->entries = NULL;
+  }
+  self->size = 0;
+  self->capacity = 0;
+  dx_memory_deallocate(self);
+}
+
+static int _map_create_index(dx_ddl_node_map* self) {
+  // The entries own the names and the values.
+  static DX_POINTER_HASHMAP_CONFIGURATION const configuration = {
+    .compare_keys_callback = (bool(*)(void**,void**)) &on_compare_keys,
+    .hash_key_callback = (dx_size(*)(void**)) & on_hash_key,
+    .key_added_callback = NULL,
+    .key_removed_callback = NULL,
+    .value_added_callback = NULL,
+    .value_removed_callback = NULL,
+  };
+  dx_pointer_hashmap* index = dx_memory_allocate(sizeof(dx_pointer_hashmap));
+  if (!index) {
+    return 1;
+  }
+  if (dx_pointer_hashmap_initialize(index, &configuration)) {
+    dx_memory_deallocate(index);
+    index = NULL;
+    return 1;
+  }
+  if (dx_pointer_hashmap_reserve(index, self->size * 2)) {
+    dx_pointer_hashmap_uninitialize(index);
+    dx_memory_deallocate(index);
+    index = NULL;
+    return 1;
+  }
+  for (dx_size i = 0, n = self->size; i < n; ++i) {
+    if (dx_pointer_hashmap_set(index, self->entries[i].name, self->entries[i].value)) {
+      dx_pointer_hashmap_uninitialize(index);
+      dx_memory_deallocate(index);
+      index = NULL;
+      return 1;
+    }
+  }
+  self->index = index;
+  return 0;
+}
+
+static dx_ddl_node* _map_find(dx_ddl_node_map const* self, dx_string* name) {
+  if (self->index) {
+    dx_error old_error = dx_get_error();
+    dx_ddl_node* value = dx_pointer_hashmap_get(self->index, name);
+    if (!value) {
+      dx_set_error(old_error);
+    }
+    return value;
+  }
+  dx_hashmap_bitmask match = dx_hashmap_group_match(self->control, dx_hashmap_h2(name->hash_value));
+  while (match) {
+    dx_size i = dx_hashmap_bitmask_first(match);
+    // The control Bytes of unused entries never match but the match may report false positives.
+    if (i < self->size) {
+      dx_ddl_node_map_entry* entry = &self->entries[i];
+      if (entry->name->hash_value == name->hash_value && dx_string_is_equal_to(entry->name, name)) {
+        return entry->value;
+      }
+    }
+    match = dx_hashmap_bitmask_next(match);
+  }
+  return NULL;
+}
+
+static int _map_add(dx_ddl_node_map* self, dx_string* name, dx_ddl_node* value) {
+  if (_map_find(self, name)) {
+    dx_set_error(DX_EXISTS);
+    return 1;
+  }
+  if (self->size == self->capacity) {
+    static dx_size const least_capacity = 4;
+    static dx_size const greatest_capacity = DX_SIZE_GREATEST / sizeof(dx_ddl_node_map_entry);
+    if (self->capacity > greatest_capacity / 2) {
+      dx_set_error(DX_ALLOCATION_FAILED);
+      return 1;
+    }
+    dx_size new_capacity = self->capacity ? self->capacity * 2 : least_capacity;
+    dx_ddl_node_map_entry* new_entries = NULL;
+    if (self->entries) {
+      new_entries = dx_memory_reallocate(self->entries, new_capacity * sizeof(dx_ddl_node_map_entry));
+    } else {
+      new_entries = dx_memory_allocate(new_capacity * sizeof(dx_ddl_node_map_entry));
+    }
+    if (!new_entries) {
+      return 1;
+    }
+    self->entries = new_entries;
+    self->capacity = new_capacity;
+  }
+  if (self->index) {
+    if (dx_pointer_hashmap_set(self->index, name, value)) {
+      return 1;
+    }
+  } else if (self->size < DX_DDL_NODE_MAP_INDEX_THRESHOLD) {
+    self->control[self->size] = dx_hashmap_h2(name->hash_value);
+  }
+  self->entries[self->size].name = name;
+  DX_REFERENCE(name);
+  self->entries[self->size].value = value;
+  DX_REFERENCE(value);
+  self->size++;
+  if (!self->index && self->size > DX_DDL_NODE_MAP_INDEX_THRESHOLD) {
+    if (_map_create_index(self)) {
+      self->size--;
+      DX_UNREFERENCE(self->entries[self->size].value);
+      DX_UNREFERENCE(self->entries[self->size].name);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 int dx_ddl_node_construct(dx_ddl_node* self, dx_ddl_node_kind kind) {
   if (!self) {
     dx_set_error(DX_INVALID_ARGUMENT);
@@ -52,15 +251,8 @@ int dx_ddl_node_construct(dx_ddl_node* self, dx_ddl_node_kind kind) {
       }
     } break;
     case dx_ddl_node_kind_map: {
-      static DX_POINTER_HASHMAP_CONFIGURATION const configuration = {
-        .compare_keys_callback = (bool(*)(void**,void**)) &on_compare_keys,
-        .hash_key_callback = (dx_size(*)(void**)) & on_hash_key,
-        .key_added_callback = (void(*)(void**)) &on_added,
-        .key_removed_callback = (void(*)(void**)) &on_removed,
-        .value_added_callback = (void(*)(void**)) &on_added,
-        .value_removed_callback = (void(*)(void**)) &on_removed,
-      };
-      if (dx_pointer_hashmap_initialize(&self->map, &configuration)) {
+      self->map = _map_create();
+      if (!self->map) {
         return 1;
       }
     } break;
@@ -94,7 +286,9 @@ static void dx_ddl_node_destruct(dx_ddl_node* self) {
       dx_pointer_array_uninitialize(&self->list);
     } break;
     case dx_ddl_node_kind_map: {
-      dx_pointer_hashmap_uninitialize(&self->map);
+      DX_DEBUG_ASSERT(NULL != self->map);
+      _map_destroy(self->map);
+      self->map = NULL;
     } break;
     case dx_ddl_node_kind_number: {
       DX_DEBUG_ASSERT(NULL != self->number);
@@ -111,10 +305,16 @@ static void dx_ddl_node_destruct(dx_ddl_node* self) {
 }
 
 dx_ddl_node* dx_ddl_node_create(dx_ddl_node_kind kind) {
-  dx_ddl_node* self = DX_DDL_NODE(dx_object_alloc(sizeof(dx_ddl_node)));
+  dx_rti_type* _type = dx_ddl_node_get_type();
+  if (!_type) {
+    return NULL;
+  }
+  dx_ddl_node* self = DX_DDL_NODE(dx_object_alloc_pooled(_type));
   if (!self) {
     return NULL;
   }
+  // Nodes are created, compiled, and destroyed by the same thread.
+  dx_object_set_thread_confined(DX_OBJECT(self), true);
   if (dx_ddl_node_construct(self, kind)) {
     DX_UNREFERENCE(self);
     self = NULL;
@@ -140,7 +340,7 @@ int dx_ddl_node_map_set(dx_ddl_node* self, dx_string* name, dx_ddl_node* value)
     dx_set_error(DX_INVALID_OPERATION);
     return 1;
   }
-  return dx_pointer_hashmap_set(&self->map, name, value);
+  return _map_add(self->map, name, value);
 }
 
 dx_ddl_node* dx_ddl_node_map_get(dx_ddl_node const* self, dx_string* name) {
@@ -152,7 +352,12 @@ dx_ddl_node* dx_ddl_node_map_get(dx_ddl_node const* self, dx_string* name) {
     dx_set_error(DX_INVALID_OPERATION);
     return NULL;
   }
-  return dx_pointer_hashmap_get(&self->map, name);
+  dx_ddl_node* value = _map_find(self->map, name);
+  if (!value) {
+    dx_set_error(DX_NOT_FOUND);
+    return NULL;
+  }
+  return value;
 }
 
 int dx_ddl_node_list_append(dx_ddl_node* self, dx_ddl_node* value) {
@@ -269,3 +474,187 @@ int dx_ddl_node_set_number(dx_ddl_node* self, dx_string* number) {
   self->number = number;
   return 0;
 }
+
+#if defined(DX_DDL_NODE_WITH_TESTS) && 1 == DX_DDL_NODE_WITH_TESTS
+
+// The greatest number of entries of a map created by the tests.
+#define _DX_DDL_NODE_TESTS_GREATEST_SIZE (256)
+
+// Create the name of the i-th entry.
+static dx_string* _dx_ddl_node_tests_create_name(dx_size i) {
+  dx_string* format = dx_string_create("field${n64}", sizeof("field${n64}") - 1);
+  if (!format) {
+    return NULL;
+  }
+  dx_string* name = dx_string_printf(format, (dx_n64)i);
+  DX_UNREFERENCE(format);
+  format = NULL;
+  return name;
+}
+
+static void _dx_ddl_node_tests_unreference_names(dx_string** names, dx_size n) {
+  for (dx_size i = 0; i < n; ++i) {
+    DX_UNREFERENCE(names[i]);
+    names[i] = NULL;
+  }
+}
+
+#if defined(DX_DDL_NODE_WITH_BENCHMARKS) && 1 == DX_DDL_NODE_WITH_BENCHMARKS
+
+// The number of lookups performed by a benchmark.
+#define _DX_DDL_NODE_TESTS_NUMBER_OF_LOOKUPS (1024 * 1024)
+
+// Get the value of an entry by comparing the name of each entry in turn.
+static dx_ddl_node* _dx_ddl_node_tests_find_linear(dx_ddl_node_map const* self, dx_string* name) {
+  for (dx_size i = 0; i < self->size; ++i) {
+    if (dx_string_is_equal_to(self->entries[i].name, name)) {
+      return self->entries[i].value;
+    }
+  }
+  return NULL;
+}
+
+// Log a benchmark of lookups in a map of n entries.
+static int _dx_ddl_node_tests_log_benchmark(char const* format_bytes, dx_size format_number_of_bytes, dx_size n, dx_n64 time, dx_size number_of_operations) {
+  dx_string* format = dx_string_create(format_bytes, format_number_of_bytes);
+  if (!format) {
+    return 1;
+  }
+  dx_string* name = dx_string_printf(format, (dx_n64)n);
+  DX_UNREFERENCE(format);
+  format = NULL;
+  if (!name) {
+    return 1;
+  }
+  dx_log_benchmark(dx_string_get_bytes(name), time, number_of_operations);
+  DX_UNREFERENCE(name);
+  name = NULL;
+  return 0;
+}
+
+// Look up the entries of a map of n entries.
+// Report the time per lookup with dx_ddl_node_map_get and with a linear search.
+static int _dx_ddl_node_tests_map_benchmark(dx_ddl_node* map, dx_ddl_node* value, dx_string** lookup_names, dx_size n) {
+  dx_size number_of_rounds = _DX_DDL_NODE_TESTS_NUMBER_OF_LOOKUPS / n;
+  dx_n64 start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < number_of_rounds; ++j) {
+    for (dx_size i = 0; i < n; ++i) {
+      if (value != dx_ddl_node_map_get(map, lookup_names[i])) {
+        return 1;
+      }
+    }
+  }
+  dx_n64 time = dx_os_get_time_ns() - start;
+  if (_dx_ddl_node_tests_log_benchmark("dx_ddl_node_map_get (${n64} entries)\0", sizeof("dx_ddl_node_map_get (${n64} entries)\0"), n, time, number_of_rounds * n)) {
+    return 1;
+  }
+  start = dx_os_get_time_ns();
+  for (dx_size j = 0; j < number_of_rounds; ++j) {
+    for (dx_size i = 0; i < n; ++i) {
+      if (value != _dx_ddl_node_tests_find_linear(map->map, lookup_names[i])) {
+        return 1;
+      }
+    }
+  }
+  time = dx_os_get_time_ns() - start;
+  if (_dx_ddl_node_tests_log_benchmark("linear search (${n64} entries)\0", sizeof("linear search (${n64} entries)\0"), n, time, number_of_rounds * n)) {
+    return 1;
+  }
+  return 0;
+}
+
+#endif // DX_DDL_NODE_WITH_BENCHMARKS
+
+// Add n entries to a map and look them up by names which are equal but not identical to the names of the entries.
+// Check that adding an existing name and looking up a missing name fail.
+// If DX_DDL_NODE_WITH_BENCHMARKS is enabled, report the time per lookup with dx_ddl_node_map_get and with a linear search.
+static int _dx_ddl_node_tests_map(dx_size n) {
+  DX_DEBUG_ASSERT(n <= _DX_DDL_NODE_TESTS_GREATEST_SIZE);
+  dx_string* names[_DX_DDL_NODE_TESTS_GREATEST_SIZE + 1];
+  dx_string* lookup_names[_DX_DDL_NODE_TESTS_GREATEST_SIZE + 1];
+  for (dx_size i = 0; i < n + 1; ++i) {
+    names[i] = _dx_ddl_node_tests_create_name(i);
+    if (!names[i]) {
+      _dx_ddl_node_tests_unreference_names(names, i);
+      return 1;
+    }
+  }
+  for (dx_size i = 0; i < n + 1; ++i) {
+    lookup_names[i] = _dx_ddl_node_tests_create_name(i);
+    if (!lookup_names[i]) {
+      _dx_ddl_node_tests_unreference_names(lookup_names, i);
+      _dx_ddl_node_tests_unreference_names(names, n + 1);
+      return 1;
+    }
+  }
+  dx_ddl_node* map = dx_ddl_node_create(dx_ddl_node_kind_map);
+  dx_ddl_node* value = dx_ddl_node_create(dx_ddl_node_kind_number);
+  if (!map || !value) {
+    goto on_error;
+  }
+  for (dx_size i = 0; i < n; ++i) {
+    if (dx_ddl_node_map_set(map, names[i], value)) {
+      goto on_error;
+    }
+  }
+  // Adding an existing name fails.
+  if (n > 0) {
+    if (!dx_ddl_node_map_set(map, lookup_names[n - 1], value) || DX_EXISTS != dx_get_error()) {
+      goto on_error;
+    }
+    dx_set_error(DX_NO_ERROR);
+  }
+  for (dx_size i = 0; i < n; ++i) {
+    if (value != dx_ddl_node_map_get(map, lookup_names[i])) {
+      goto on_error;
+    }
+  }
+  // Looking up a missing name fails.
+  if (dx_ddl_node_map_get(map, lookup_names[n]) || DX_NOT_FOUND != dx_get_error()) {
+    goto on_error;
+  }
+  dx_set_error(DX_NO_ERROR);
+#if defined(DX_DDL_NODE_WITH_BENCHMARKS) && 1 == DX_DDL_NODE_WITH_BENCHMARKS
+  if (n > 0 && _dx_ddl_node_tests_map_benchmark(map, value, lookup_names, n)) {
+    goto on_error;
+  }
+#endif
+  DX_UNREFERENCE(value);
+  value = NULL;
+  DX_UNREFERENCE(map);
+  map = NULL;
+  _dx_ddl_node_tests_unreference_names(lookup_names, n + 1);
+  _dx_ddl_node_tests_unreference_names(names, n + 1);
+  return 0;
+on_error:
+  if (value) {
+    DX_UNREFERENCE(value);
+    value = NULL;
+  }
+  if (map) {
+    DX_UNREFERENCE(map);
+    map = NULL;
+  }
+  _dx_ddl_node_tests_unreference_names(lookup_names, n + 1);
+  _dx_ddl_node_tests_unreference_names(names, n + 1);
+  return 1;
+}
+
+int dx_ddl_node_tests() {
+  // Maps below, at, and above the size at which the index is created.
+  static dx_size const sizes[] = {
+    0,
+    4,
+    DX_DDL_NODE_MAP_INDEX_THRESHOLD,
+    DX_DDL_NODE_MAP_INDEX_THRESHOLD + 1,
+    _DX_DDL_NODE_TESTS_GREATEST_SIZE,
+  };
+  for (dx_size i = 0; i < sizeof(sizes) / sizeof(dx_size); ++i) {
+    if (_dx_ddl_node_tests_map(sizes[i])) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+#endif // DX_DDL_NODE_WITH_TESTS
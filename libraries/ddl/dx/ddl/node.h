@@ -16,12 +16,16 @@ static inline dx_ddl_node* DX_DDL_NODE(void* p) {
   return (dx_ddl_node*)p;
 }
 
+/// @brief The entries of an ADL map node.
+/// The type is defined in "dx/ddl/node.c".
+typedef struct dx_ddl_node_map dx_ddl_node_map;
+
 struct dx_ddl_node {
   dx_object _parent;
   dx_ddl_node_kind kind;
   union {
     dx_pointer_array list;
-    dx_pointer_hashmap map;
+    dx_ddl_node_map* map;
     dx_string* string;
     dx_string* number;
   };
@@ -45,6 +49,7 @@ int dx_ddl_node_construct(dx_ddl_node* self, dx_ddl_node_kind kind);
 /// @return A pointer to this ADL node. The null pointer on failure.
 /// @success The node was assigned default values for the specified type.
 /// See dx_ddl_node_construct for details.
+/// @remarks The node is thread-confined to the calling thread (see dx_object_set_thread_confined).
 /// @default-failure
 dx_ddl_node* dx_ddl_node_create(dx_ddl_node_kind kind);
 
@@ -54,7 +59,7 @@ dx_ddl_node* dx_ddl_node_create(dx_ddl_node_kind kind);
 /// @failure This function has set the the error variable.
 dx_ddl_node_kind dx_ddl_node_get_kind(dx_ddl_node const* self);
 
-/// @brief Add or update the mapping from name to value in this ADL map node.
+/// @brief Add the mapping from name to value in this ADL map node.
 /// @param self A pointer to this ADL node.
 /// @param name The name.
 /// @param value The value.
@@ -63,6 +68,7 @@ dx_ddl_node_kind dx_ddl_node_get_kind(dx_ddl_node const* self);
 /// - #DX_INVALID_ARGUMENT @a self is a null pointer
 /// - #DX_INVALID_ARGUMENT @a value is a null pointer
 /// - #DX_INVALID_OPERATION this node is not of node kind #dx_ddl_node_kind_map.
+/// - #DX_EXISTS a mapping for the name exists
 int dx_ddl_node_map_set(dx_ddl_node* self, dx_string* name, dx_ddl_node* value);
 
 /// @brief Get a mapping from a name to a value in this ADL map node.
@@ -168,4 +174,8 @@ int dx_ddl_node_set_number(dx_ddl_node* self, dx_string* number);
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+#if defined(DX_DDL_NODE_WITH_TESTS) && 1 == DX_DDL_NODE_WITH_TESTS
+int dx_ddl_node_tests();
+#endif
+
 #endif // DX_DDL_NODE_H_INCLUDED
@@ -122,7 +122,7 @@ static int dx_ddl_parser_on_map_0(dx_ddl_parser* p, dx_ddl_node* map_node) {
     if (!dx_ddl_parser_is_word_kind(p, dx_ddl_word_kind_name)) {
       return 1;
     }
-    dx_string* name = dx_string_create(p->scanner->text.elements, p->scanner->text.size);
+    dx_string* name = dx_ddl_scanner_get_word_atom(p->scanner);
     if (!name) {
       return 1;
     }
@@ -519,6 +519,10 @@ dx_size dx_ddl_scanner_get_word_text_number_of_bytes(dx_ddl_scanner const* self)
   return self->text.size;
 }
 
+dx_string* dx_ddl_scanner_get_word_atom(dx_ddl_scanner const* self) {
+  return dx_string_create_atom(self->text.elements, self->text.size);
+}
+
 dx_ddl_word_kind dx_ddl_scanner_get_word_kind(dx_ddl_scanner const* self) {
   return self->kind;
 }
@@ -78,6 +78,13 @@ char const* dx_ddl_scanner_get_word_text_bytes(dx_ddl_scanner const* self);
 /// @failure This function has set the the error variable.
 dx_size dx_ddl_scanner_get_word_text_number_of_bytes(dx_ddl_scanner const* self);
 
+/// @brief Get the atom for the text of the current token.
+/// @param self A pointer to this scanner.
+/// @return A pointer to the atom on success. The null pointer on failure.
+/// @remarks The atom is suitable as a key: Names of the same text are the same atom.
+/// @failure This function has set the the error variable.
+dx_string* dx_ddl_scanner_get_word_atom(dx_ddl_scanner const* self);
+
 /// @brief Get the type of the current token.
 /// @param self A pointer to this scanner.
 /// @return The type of the current token. #dx_ddl_word_kind_error is returned on on failure.
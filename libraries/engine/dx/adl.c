@@ -75,6 +75,13 @@ static int _read_scene(dx_ddl_node* node, dx_adl_context* context) {
     if (node1->kind != dx_ddl_node_kind_list) {
       return 1;
     }
+    // The scene outlives the load, hence its array of assets is not allocated from the current arena.
+    dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+    int result = dx_object_array_reserve(&context->scene->assets, dx_object_array_get_size(&context->scene->assets) + dx_ddl_node_list_get_size(node1));
+    dx_memory_set_current_arena(arena);
+    if (result) {
+      return 1;
+    }
     for (dx_size i = 0, n = dx_ddl_node_list_get_size(node1); i < n; ++i) {
       dx_ddl_node* node2 = dx_ddl_node_list_get(node1, i);
       if (!node2) {
@@ -130,12 +137,15 @@ static int dx_adl_compiler_resolve_phase(dx_adl_context* context) {
 #include "dx/asset/image_operation.h"
 #include "dx/asset/mesh_operation.h"
 
-dx_asset_scene* dx_adl_compile(dx_ddl_node* node) {
+static dx_asset_scene* _compile(dx_ddl_node* node) {
   dx_adl_context* context = dx_adl_context_create();
   if (!context) {
     return NULL;
   }
+  // The scene escapes the compilation, hence it is not allocated from the current arena.
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_scene* scene = dx_asset_scene_create();
+  dx_memory_set_current_arena(arena);
   if (!scene) {
     DX_UNREFERENCE(context);
     context = NULL;
@@ -175,6 +185,8 @@ dx_asset_scene* dx_adl_compile(dx_ddl_node* node) {
     context = NULL;
     return NULL;
   }
+  // The remaining operations modify the assets of the scene, hence they do not allocate from the current arena.
+  dx_memory_set_current_arena(NULL);
   for (dx_size i = 0, n = dx_object_array_get_size(&scene->assets); i < n; ++i) { 
     dx_object* object = dx_object_array_get_at(&scene->assets, i);
     if (dx_rti_type_is_leq(object->type, dx_asset_mesh_instance_get_type())) {
@@ -237,4 +249,18 @@ dx_asset_scene* dx_adl_compile(dx_ddl_node* node) {
   return scene;
 }
 
+dx_asset_scene* dx_adl_compile(dx_ddl_node* node) {
+  // The transient objects of the compilation are allocated from an arena.
+  dx_memory_arena* arena = dx_memory_arena_create();
+  if (!arena) {
+    return NULL;
+  }
+  dx_memory_arena* previous_arena = dx_memory_set_current_arena(arena);
+  dx_asset_scene* scene = _compile(node);
+  dx_memory_set_current_arena(previous_arena);
+  dx_memory_arena_destroy(arena);
+  arena = NULL;
+  return scene;
+}
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
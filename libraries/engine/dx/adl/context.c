@@ -38,7 +38,8 @@ static bool compare_keys_callback(dx_string** key1, dx_string** key2) {
 static dx_size hash_key_callback(dx_string** key) {
   DX_DEBUG_ASSERT(NULL != key);
   DX_DEBUG_ASSERT(NULL != *key);
-  return dx_string_get_hash_value(*key);
+  // The hash value is cached by the string.
+  return (*key)->hash_value;
 }
 
 static void key_added_callback(dx_string** key) {
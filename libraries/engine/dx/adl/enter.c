@@ -148,6 +148,21 @@ int dx_adl_enter_run(dx_adl_enter* self, dx_ddl_node* source, dx_adl_context* co
   }
 #undef DEFINE
 
+  // Presize the definitions for the elements of the scene.
+  if (dx_ddl_node_kind_map == dx_ddl_node_get_kind(source)) {
+    dx_ddl_node* elements = dx_ddl_node_map_get(source, NAME(elements_key));
+    if (elements && dx_ddl_node_kind_list == dx_ddl_node_get_kind(elements)) {
+      dx_size size = dx_pointer_hashmap_get_size(&context->definitions->map) + dx_ddl_node_list_get_size(elements);
+      if (dx_asset_definitions_reserve(context->definitions, size)) {
+        return 1;
+      }
+    } else if (!elements) {
+      if (DX_NOT_FOUND != dx_get_error()) {
+        return 1;
+      }
+      dx_set_error(DX_NO_ERROR);
+    }
+  }
   return dx_adl_enter_on_scene(self, source, context);
 }
 
@@ -33,5 +33,7 @@ dx_object* dx_adl_semantical_reader_read(dx_adl_semantical_reader* self,
 {
   assert(NULL != self);
   assert(NULL != self->read);
-  return self->read(self, node, context); 
+  // The arena of the compilation remains current such that the temporaries of the reader are allocated from it.
+  // The reader allocates the asset and the values stored in it while no arena is current as they outlive the load.
+  return self->read(self, node, context);
 }
@@ -13,6 +13,19 @@ static inline dx_string* _get_name(dx_adl_semantical_names* names, dx_size index
 
 #define NAME(name) _get_name(self->context->names, dx_semantical_name_index_##name)
 
+// memcmp
+#include <string.h>
+
+/// @brief Compare two symbols by their names.
+static int _compare_symbols(dx_adl_symbol* a, dx_adl_symbol* b) {
+  dx_size n = a->name->number_of_bytes < b->name->number_of_bytes ? a->name->number_of_bytes : b->name->number_of_bytes;
+  int result = memcmp(a->name->bytes, b->name->bytes, n);
+  if (result) {
+    return result;
+  }
+  return a->name->number_of_bytes < b->name->number_of_bytes ? -1 : (a->name->number_of_bytes > b->name->number_of_bytes ? 1 : 0);
+}
+
 DX_DEFINE_OBJECT_TYPE("dx.adl.resolve",
   dx_adl_resolve,
   dx_object)
@@ -57,6 +70,9 @@ dx_adl_resolve* dx_adl_resolve_create(dx_adl_context* context) {
 
 static int setup_queue(dx_adl_resolve* self, bool include_unloaded, bool include_unresolved) {
   dx_pointer_array_clear(&self->queue);
+  if (dx_pointer_array_reserve(&self->queue, dx_pointer_hashmap_get_size(&self->context->definitions->map))) {
+    return 1;
+  }
   dx_pointer_hashmap_iterator iterator;
   dx_pointer_hashmap_iterator_initialize(&iterator, &self->context->definitions->map);
   while (dx_pointer_hashmap_iterator_has_entry(&iterator)) {
@@ -70,6 +86,11 @@ static int setup_queue(dx_adl_resolve* self, bool include_unloaded, bool include
     dx_pointer_hashmap_iterator_next(&iterator);
   }
   dx_pointer_hashmap_iterator_uninitialize(&iterator);
+  // The order of the symbols in the hashmap depends on the hash values and the capacity:
+  // Sort the symbols by their names such that the symbols are read and resolved in a deterministic order.
+  if (dx_pointer_array_sort(&self->queue, (dx_compare_callback*)&_compare_symbols)) {
+    return 1;
+  }
   return 0;
 }
 
@@ -61,7 +61,9 @@ static dx_object* read(dx_adl_semantical_color_reader* self, dx_ddl_node* node,
   if (_read_color_rgb_u8(node, context, &temporary)) {
     return NULL;
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_color* color = dx_asset_color_create(&temporary);
+  dx_memory_set_current_arena(arena);
   if (!color) {
     return NULL;
   }
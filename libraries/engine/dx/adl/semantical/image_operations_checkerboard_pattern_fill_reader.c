@@ -32,7 +32,7 @@ static int resolve(dx_adl_semantical_image_operations_checkerboard_pattern_fill_
   dx_ddl_node* node = symbol->node;
   // checkerColors
   {
-    dx_string* child_name = dx_string_create("checkerColors", sizeof("checkerColors") - 1);
+    dx_string* child_name = dx_string_create_atom("checkerColors", sizeof("checkerColors") - 1);
     if (!child_name) {
       return 1;
     }
@@ -81,13 +81,15 @@ static dx_object* read(dx_adl_semantical_image_operations_checkerboard_pattern_f
     dx_set_error(DX_INVALID_ARGUMENT);
     return NULL;
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_image_operations_checkerboard_pattern_fill* image_operation = dx_asset_image_operations_checkerboard_pattern_fill_create();
+  dx_memory_set_current_arena(arena);
   if (!image_operation) {
     return NULL;
   }
   // numberOfCheckers
   {
-    dx_string* child_name = dx_string_create("numberOfCheckers", sizeof("numberOfCheckers") - 1);
+    dx_string* child_name = dx_string_create_atom("numberOfCheckers", sizeof("numberOfCheckers") - 1);
     if (!child_name) {
       DX_UNREFERENCE(image_operation);
       image_operation = NULL;
@@ -132,7 +134,7 @@ static dx_object* read(dx_adl_semantical_image_operations_checkerboard_pattern_f
   }
   // checkerSize
   {
-    dx_string* child_name = dx_string_create("checkerSize", sizeof("checkerSize") - 1);
+    dx_string* child_name = dx_string_create_atom("checkerSize", sizeof("checkerSize") - 1);
     if (!child_name) {
       DX_UNREFERENCE(image_operation);
       image_operation = NULL;
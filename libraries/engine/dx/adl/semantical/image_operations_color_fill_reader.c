@@ -54,7 +54,9 @@ static dx_object* read(dx_adl_semantical_image_operations_color_fill_reader* sel
     dx_set_error(DX_INVALID_ARGUMENT);
     return NULL;
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_image_operations_color_fill* image_operation = dx_asset_image_operations_color_fill_create();
+  dx_memory_set_current_arena(arena);
   if (!image_operation) {
     return NULL;
   }
@@ -87,7 +87,11 @@ static int _read_image_operation(dx_ddl_node* node, dx_adl_symbol* symbol, dx_ad
   DX_UNREFERENCE(reader_symbol);
   reader_symbol = NULL;
   dx_asset_image* image = DX_ASSET_IMAGE(symbol->asset);
-  if (dx_object_array_append(&image->operations, DX_OBJECT(operation))) {
+  // The operations of the image outlive the load.
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  int result = dx_object_array_append(&image->operations, DX_OBJECT(operation));
+  dx_memory_set_current_arena(arena);
+  if (result) {
     DX_UNREFERENCE(operation);
     operation = NULL;
     return 1;
@@ -147,7 +151,9 @@ static dx_asset_image* _read_image(dx_ddl_node* node, dx_adl_context* context) {
     goto END;
   }
   DX_RGB_U8 white = { .r = 255, .g = 255, .b = 255 };
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   image_value = dx_asset_image_create(name_value, DX_PIXEL_FORMAT_RGB_U8, width_value, height_value, &white);
+  dx_memory_set_current_arena(arena);
   if (!image_value) {
     goto END;
   }
@@ -36,7 +36,9 @@ static dx_asset_material* _read_material(dx_ddl_node* node, dx_adl_context* cont
     }
   }
 
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_material* material_value_1 = dx_asset_material_create(name_value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(name_value);
   name_value = NULL;
   if (!material_value_1) {
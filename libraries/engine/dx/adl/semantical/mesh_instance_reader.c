@@ -48,7 +48,7 @@ static dx_object* read(dx_adl_semantical_mesh_instance_reader* self, dx_ddl_node
   DX_MAT4* transformation = NULL;
   // transformation?
   {
-    dx_string* name = dx_string_create("transformation", sizeof("transformation") - 1);
+    dx_string* name = dx_string_create_atom("transformation", sizeof("transformation") - 1);
     if (!name) {
       goto END;
     }
@@ -75,14 +75,18 @@ static dx_object* read(dx_adl_semantical_mesh_instance_reader* self, dx_ddl_node
     if (!name) {
       goto END;
     }
+    dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
     mesh_reference = dx_asset_reference_create(name);
+    dx_memory_set_current_arena(arena);
     DX_UNREFERENCE(name);
     name = NULL;
     if (!mesh_reference) {
       goto END;
     }
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   mesh_instance = dx_asset_mesh_instance_create(mesh_reference);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(mesh_reference);
   mesh_reference = NULL;
   if (!mesh_instance) {
@@ -37,7 +37,10 @@ static dx_object* read(dx_adl_semantical_mesh_operations_reader* self, dx_ddl_no
   if (dx_string_is_equal_to(received_type, NAME(mesh_operations_set_vertex_colors_type))) {
     DX_UNREFERENCE(received_type);
     received_type = NULL;
-    return DX_OBJECT(dx_asset_mesh_operations_set_vertex_colors_create());
+    dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+    dx_asset_mesh_operation* operation = DX_ASSET_MESH_OPERATION(dx_asset_mesh_operations_set_vertex_colors_create());
+    dx_memory_set_current_arena(arena);
+    return DX_OBJECT(operation);
   } else {
     DX_UNREFERENCE(received_type);
     received_type = NULL;
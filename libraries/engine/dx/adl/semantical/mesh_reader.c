@@ -126,7 +126,11 @@ static int _read_mesh_operation(dx_ddl_node* node, dx_adl_symbol* symbol, dx_adl
   DX_UNREFERENCE(reader_symbol);
   reader_symbol = NULL;
   dx_asset_mesh* mesh = DX_ASSET_MESH(symbol->asset);
-  if (dx_object_array_append(&mesh->operations, DX_OBJECT(operation))) {
+  // The operations of the mesh outlive the load.
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  int result = dx_object_array_append(&mesh->operations, DX_OBJECT(operation));
+  dx_memory_set_current_arena(arena);
+  if (result) {
     DX_UNREFERENCE(operation);
     operation = NULL;
     return 1;
@@ -207,17 +211,13 @@ static dx_asset_mesh* _read_mesh(dx_ddl_node* node, dx_adl_context* context) {
   }
   // generator
   {
-    dx_string* name = dx_string_create("generator", sizeof("generator") - 1);
+    dx_string* name = dx_string_create_atom("generator", sizeof("generator") - 1);
     if (!name) {
       goto END;
     }
-    dx_ddl_node* child_node = dx_ddl_node_map_get(node, name);
+    generator_value = dx_adl_semantical_read_string(node, name, context->names);
     DX_UNREFERENCE(name);
     name = NULL;
-    if (!child_node) {
-      goto END;
-    }
-    generator_value = dx_ddl_node_get_string(child_node);
     if (!generator_value) {
       goto END;
     }
@@ -243,7 +243,9 @@ static dx_asset_mesh* _read_mesh(dx_ddl_node* node, dx_adl_context* context) {
       goto END;
     }
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   mesh_value = dx_asset_mesh_create(name_value, generator_value, vertex_format_value, material_reference_value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(material_reference_value);
   material_reference_value = NULL;
   DX_UNREFERENCE(generator_value);
@@ -21,7 +21,7 @@ int dx_adl_semantical_names_construct(dx_adl_semantical_names* self) {
   }
   memset(self->names, 0, sizeof(dx_string*) * (DX_SEMANTICAL_NAMES_NUMBER_OF_NAMES));
 #define DEFINE(NAME, STRING) \
-  self->names[dx_semantical_name_index_##NAME] = dx_string_create(STRING, sizeof(STRING) - 1); \
+  self->names[dx_semantical_name_index_##NAME] = dx_string_create_atom(STRING, sizeof(STRING) - 1); \
   if (!self->names[dx_semantical_name_index_##NAME]) { \
     goto ERROR; \
   }
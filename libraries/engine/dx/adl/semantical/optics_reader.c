@@ -23,7 +23,9 @@ DX_DEFINE_OBJECT_TYPE("dx.adl.semantical.optics_reader",
                       dx_adl_semantical_reader)
 
 static dx_asset_optics_perspective* _read_optics_perspective(dx_ddl_node* node, dx_adl_context* context) {
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_optics_perspective* optics_value = dx_asset_optics_perspective_create();
+  dx_memory_set_current_arena(arena);
   if (!optics_value) {
     return NULL;
   }
@@ -48,7 +50,9 @@ static dx_asset_optics_perspective* _read_optics_perspective(dx_ddl_node* node,
     dx_string* key = NAME(aspect_ratio_key);
     if (!dx_adl_semantical_read_f32(node, key, &value)) {
       if (!optics_value->aspect_ratio) {
+        arena = dx_memory_set_current_arena(NULL);
         optics_value->aspect_ratio = dx_memory_allocate(sizeof(dx_f32));
+        dx_memory_set_current_arena(arena);
         if (!optics_value->aspect_ratio) {
           DX_UNREFERENCE(optics_value);
           optics_value = NULL;
@@ -103,7 +107,9 @@ static dx_asset_optics_perspective* _read_optics_perspective(dx_ddl_node* node,
 }
 
 static dx_asset_optics_orthographic* _read_optics_orthographic(dx_ddl_node* node, dx_adl_context* context) {
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_optics_orthographic* optics_value = dx_asset_optics_orthographic_create();
+  dx_memory_set_current_arena(arena);
   if (!optics_value) {
     return NULL;
   }
@@ -12,6 +12,20 @@ static inline dx_string* _get_name(dx_adl_semantical_names* names, dx_size index
 }
 #define NAME(name) _get_name(context->names, dx_semantical_name_index_##name)
 
+// Names and strings are stored in assets which outlive the load.
+// If a string was allocated from an arena, then this function releases it and returns a copy which is not.
+static dx_string* _copy_out(dx_string* value) {
+  if (!dx_memory_is_arena_block(value)) {
+    return value;
+  }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
+  dx_string* copy = dx_string_create(dx_string_get_bytes(value), dx_string_get_number_of_bytes(value));
+  dx_memory_set_current_arena(arena);
+  DX_UNREFERENCE(value);
+  value = NULL;
+  return copy;
+}
+
 static int _read_translation(DX_MAT4* target, dx_ddl_node* node, dx_adl_context* context, dx_adl_semantical_names* names);
 
 static int _read_vector_3(DX_VEC3* target, dx_ddl_node* node, dx_adl_context* context, dx_adl_semantical_names* names);
@@ -127,9 +141,12 @@ dx_string* dx_adl_semantical_read_name(dx_ddl_node* node, dx_adl_context* contex
   if (!child_node || child_node->kind != dx_ddl_node_kind_string) {
     return NULL;
   }
-  dx_string* type = dx_ddl_node_get_string(child_node);
-  DX_DEBUG_CHECK_MAGIC_BYTES(type);
-  return type;
+  dx_string* value = dx_ddl_node_get_string(child_node);
+  if (!value) {
+    return NULL;
+  }
+  DX_DEBUG_CHECK_MAGIC_BYTES(value);
+  return _copy_out(value);
 }
 
 int dx_adl_semantical_read_n8(dx_ddl_node* node, dx_string* name, dx_n8* target) {
@@ -186,7 +203,7 @@ dx_string* dx_adl_semantical_read_string(dx_ddl_node* node, dx_string* name, dx_
     return NULL;
   }
   DX_DEBUG_CHECK_MAGIC_BYTES(value);
-  return value;
+  return _copy_out(value);
 }
 
 dx_asset_color* dx_adl_semantical_read_color_instance_0(dx_ddl_node* node, dx_adl_context* context) {
@@ -234,7 +251,9 @@ dx_asset_reference* dx_adl_semantical_read_color_instance(dx_ddl_node* node, dx_
   if (!value) {
     return NULL;
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_reference* reference = dx_asset_reference_create(value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(value);
   value = NULL;
   return reference;
@@ -270,7 +289,9 @@ dx_asset_reference* dx_adl_semantical_read_instance(dx_ddl_node* node, dx_string
   if (!value) {
     return NULL;
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_reference* reference = dx_asset_reference_create(value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(value);
   value = NULL;
   return reference;
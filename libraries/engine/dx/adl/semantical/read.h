@@ -26,7 +26,7 @@ dx_string* dx_adl_semantical_read_type(dx_ddl_node* node, dx_adl_context* contex
 /// @param node A pointer to the node.
 /// @param names A pointer to the names object.
 /// @return A pointer to the type on success. The null pointer on failure.
-/// @success The caller acquired a reference to the string object returned.
+/// @success The caller acquired a reference to the string object returned. The string object is not allocated from an arena.
 /// @default-failure
 dx_string* dx_adl_semantical_read_name(dx_ddl_node* node, dx_adl_context* context);
 
@@ -99,7 +99,7 @@ int dx_adl_semantical_read_f64(dx_ddl_node* node, dx_string* key, dx_f64* target
 /// @param key The key.
 /// @param [out] target A pointer to a <code>dx_f64</code> variable.
 /// @return A pointer to the value on success. The null pointer on failure.
-/// @success The caller acquired a reference to the string object returned.
+/// @success The caller acquired a reference to the string object returned. The string object is not allocated from an arena.
 /// @default-failure
 dx_string* dx_adl_semantical_read_string(dx_ddl_node* node, dx_string* key, dx_adl_semantical_names* names);
 
@@ -68,7 +68,9 @@ static dx_asset_texture* _read_texture(dx_ddl_node* node, dx_adl_context* contex
     }
   }
   //
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   texture_value = dx_asset_texture_create(name_value, image_reference_value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(image_reference_value);
   image_reference_value = NULL;
   DX_UNREFERENCE(name_value);
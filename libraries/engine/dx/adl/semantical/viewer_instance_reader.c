@@ -67,7 +67,9 @@ static dx_asset_viewer_instance* _read_viewer_instance(dx_ddl_node* node, dx_adl
       return NULL;
     }
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   dx_asset_viewer_instance* viewer_instance_value = dx_asset_viewer_instance_create(viewer_value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(viewer_value);
   viewer_value = NULL;
   return viewer_instance_value;
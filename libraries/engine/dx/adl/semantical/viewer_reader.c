@@ -64,7 +64,9 @@ static dx_object* read(dx_adl_semantical_viewer_reader* self, dx_ddl_node* node,
       return NULL;
     }
   }
+  dx_memory_arena* arena = dx_memory_set_current_arena(NULL);
   viewer_value = dx_asset_viewer_create(name_value);
+  dx_memory_set_current_arena(arena);
   DX_UNREFERENCE(name_value);
   name_value = NULL;
   if (!viewer_value) {
@@ -80,7 +80,8 @@ static void on_removed(dx_object** a) {
 
 static dx_size on_hash_key(dx_object** a) {
   DX_DEBUG_CHECK_MAGIC_BYTES(*a);
-  return dx_string_get_hash_value(DX_STRING(*a));
+  // The hash value is cached by the string.
+  return DX_STRING(*a)->hash_value;
 }
 
 static bool on_compare_keys(dx_object** a, dx_object** b) {
@@ -149,6 +150,14 @@ int dx_asset_definitions_set(dx_asset_definitions* self, dx_string* name, dx_adl
   return 0;
 }
 
+int dx_asset_definitions_reserve(dx_asset_definitions* self, dx_size size) {
+  if (!self) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dx_pointer_hashmap_reserve(&self->map, size);
+}
+
 int dx_asset_definitions_dump(dx_asset_definitions* self) {
   dx_log("{\n", sizeof("{\n") - 1);
   dx_pointer_hashmap_iterator iterator;
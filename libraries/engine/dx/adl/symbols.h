@@ -55,6 +55,12 @@ dx_adl_symbol* dx_asset_definitions_get(dx_asset_definitions const* self, dx_str
 
 int dx_asset_definitions_set(dx_asset_definitions* self, dx_string* name, dx_adl_symbol* symbol);
 
+/// @brief Ensure the specified number of definitions can be stored without growing these definitions.
+/// @param self A pointer to these definitions.
+/// @param size The number of definitions.
+/// @return The zero value on success. A non-zero value on failure.
+int dx_asset_definitions_reserve(dx_asset_definitions* self, dx_size size);
+
 int dx_asset_definitions_dump(dx_asset_definitions* self);
 
 #endif // DX_ADL_SYMBOLS_H_INCLUDED
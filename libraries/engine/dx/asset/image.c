@@ -2,8 +2,7 @@
 
 // string
 #include <string.h>
-#include "dx/asset/image_operations/color_fill.h"
-#include "dx/asset/image_operations/checkerboard_pattern_fill.h"
+#include "dx/asset/image_operation.h"
 
 DX_DEFINE_OBJECT_TYPE("dx.asset.image",
                       dx_asset_image,
@@ -45,8 +44,6 @@ static int _swap_columns(dx_asset_image* self, dx_size i, dx_size j);
 /// @remark This is a non-primitive operation.
 static int _swap_rows(dx_asset_image* self, dx_size i, dx_size j);
 
-static int on_color_fill_image_operation(dx_asset_image* self, OFFSET2 offset, EXTEND2 extend, dx_asset_image_operations_color_fill* image_operation);
-
 static dx_size get_bytes_per_pixel(DX_PIXEL_FORMAT pixel_format) {
   switch (pixel_format) {
   case DX_PIXEL_FORMAT_RGB_U8: {
@@ -263,11 +260,22 @@ dx_asset_image* dx_asset_image_create(dx_string* name,
   return self;
 }
 
-static int on_color_fill_image_operation(dx_asset_image* self, OFFSET2 offset, EXTEND2 extend, dx_asset_image_operations_color_fill* image_operation) {
+int dx_asset_image_fill(dx_asset_image* self,
+                        dx_size left,
+                        dx_size top,
+                        dx_size width,
+                        dx_size height,
+                        DX_RGB_U8 const* color) {
+  if (!self || !color) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
   switch (self->pixel_format) {
   case DX_PIXEL_FORMAT_RGB_U8: {
+    OFFSET2 offset = { .left = left, .top = top };
+    EXTEND2 extend = { .width = width, .height = height };
     EXTEND2 image_size = { .width = self->width, .height = self->height };
-    _fill_rgb_u8(self->pixels, offset, extend, image_size, &(image_operation->color));
+    _fill_rgb_u8(self->pixels, offset, extend, image_size, color);
   } break;
   default: {
     dx_set_error(DX_INVALID_ARGUMENT);
@@ -277,7 +285,6 @@ static int on_color_fill_image_operation(dx_asset_image* self, OFFSET2 offset, E
   return 0;
 }
 
-#include "dx/asset/image_operations/checkerboard_pattern_fill_impl.i"
 #include "dx/asset/image_operations/mirror_horizontal_impl.i"
 #include "dx/asset/image_operations/mirror_vertical_impl.i"
 
@@ -287,22 +294,5 @@ int dx_asset_image_apply(dx_asset_image* self,
                          dx_size width,
                          dx_size height,
                          dx_asset_image_operation* image_operation) {
-  if (dx_rti_type_is_leq(DX_OBJECT(image_operation)->type, dx_asset_image_operations_color_fill_get_type())) {
-    OFFSET2 offset = { .left = left, .top = top };
-    EXTEND2 extend = { .width = width, .height = height };
-    return on_color_fill_image_operation(self, offset, extend, DX_ASSET_IMAGE_OPERATIONS_COLOR_FILL(image_operation));
-  }
-  if (dx_get_error()) {
-    return 1;
-  }
-  if (dx_rti_type_is_leq(DX_OBJECT(image_operation)->type, dx_asset_image_operations_checkerboard_pattern_fill_get_type())) {
-    OFFSET2 offset = { .left = left, .top = top };
-    EXTEND2 extend = { .width = width, .height = height };
-    return on_checkerboard_pattern_fill_image_operation(self, offset, extend, DX_ASSET_IMAGE_OPERATIONS_CHECKERBOARD_PATTERN_FILL(image_operation));
-  }
-  if (dx_get_error()) {
-    return 1;
-  }
-  dx_set_error(DX_INVALID_ARGUMENT);
-  return 1;
+  return dx_asset_image_operation_apply(image_operation, self, left, top, width, height);
 }
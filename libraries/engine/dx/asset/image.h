@@ -38,6 +38,22 @@ dx_asset_image* dx_asset_image_create(dx_string* name,
                                       dx_size height,
                                       DX_RGB_U8 const* color);
 
+/// @brief Fill the specified area with the specified color.
+/// @param self A pointer to this image.
+/// @param left The left border of the area to fill.
+/// @param top The top border of the area to fill.
+/// @param width The width of the area to fill.
+/// @param height The height of the area to fill.
+/// @param color A pointer to the color.
+/// @return The zero value on success. A non-zero value on failure.
+/// @remarks The area is clipped against the image.
+int dx_asset_image_fill(dx_asset_image* self,
+                        dx_size left,
+                        dx_size top,
+                        dx_size width,
+                        dx_size height,
+                        DX_RGB_U8 const* color);
+
 /// @brief Apply to the specified area the specified image operation.
 /// @param self A pointer to this image.
 /// @param left The left border of the area to fill.
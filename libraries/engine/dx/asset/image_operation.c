@@ -1,12 +1,17 @@
 #include "dx/asset/image_operation.h"
 
-DX_DEFINE_OBJECT_TYPE("dx.asset.image_operation",
-                      dx_asset_image_operation,
-                      dx_object)
+DX_DEFINE_OBJECT_TYPE_WITH_DISPATCH("dx.asset.image_operation",
+                                    dx_asset_image_operation,
+                                    dx_object,
+                                    dx_asset_image_operation_dispatch)
 
 static void dx_asset_image_operation_destruct(dx_asset_image_operation* self)
 {/*Intentionally empty.*/}
 
+static void dx_asset_image_operation_construct_dispatch(dx_asset_image_operation_dispatch* self) {
+  self->apply = NULL;
+}
+
 int dx_asset_image_operation_construct(dx_asset_image_operation* self) {
   dx_rti_type* _type = dx_asset_image_operation_get_type();
   if (!_type) {
@@ -15,3 +20,16 @@ int dx_asset_image_operation_construct(dx_asset_image_operation* self) {
   DX_OBJECT(self)->type = _type;
   return 0;
 }
+
+int dx_asset_image_operation_apply(dx_asset_image_operation* self, dx_asset_image* image, dx_size left, dx_size top, dx_size width, dx_size height) {
+  if (!self || !image) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  dx_asset_image_operation_dispatch* dispatch = dx_rti_type_get_dispatch(DX_OBJECT(self)->type);
+  if (!dispatch->apply) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  return dispatch->apply(self, image, left, top, width, height);
+}
@@ -2,6 +2,7 @@
 #define DX_ASSET_IMAGE_OPERATION_H_INCLUDED
 
 #include "dx/asset/color.h"
+typedef struct dx_asset_image dx_asset_image;
 
 DX_DECLARE_OBJECT_TYPE("dx.asset.image_operation",
                        dx_asset_image_operation,
@@ -15,6 +16,23 @@ struct dx_asset_image_operation {
   dx_object _parent;
 };
 
+/// @brief The dispatch table of dx_asset_image_operation.
+typedef struct dx_asset_image_operation_dispatch {
+  /// @brief Apply this image operation to the specified area of an image.
+  /// The null pointer if the image operation can not be applied.
+  int (*apply)(dx_asset_image_operation* self, dx_asset_image* image, dx_size left, dx_size top, dx_size width, dx_size height);
+} dx_asset_image_operation_dispatch;
+
 int dx_asset_image_operation_construct(dx_asset_image_operation* self);
 
+/// @brief Apply this image operation to the specified area of an image.
+/// @param self A pointer to this image operation.
+/// @param image A pointer to the image.
+/// @param left, top, width, height The area.
+/// @return The zero value on success. A non-zero value on failure.
+/// @default-failure
+/// In particular, the following error codes are returned:
+/// - #DX_INVALID_ARGUMENT this image operation can not be applied
+int dx_asset_image_operation_apply(dx_asset_image_operation* self, dx_asset_image* image, dx_size left, dx_size top, dx_size width, dx_size height);
+
 #endif // DX_ASSET_IMAGE_OPERATION_H_INCLUDED
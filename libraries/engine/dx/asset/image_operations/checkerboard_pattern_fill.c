@@ -1,13 +1,59 @@
 #include "dx/asset/image_operations/checkerboard_pattern_fill.h"
 
+#include "dx/asset/image.h"
 
-DX_DEFINE_OBJECT_TYPE("dx.asset.image_operations.checkerboard_pattern_fill",
-                      dx_asset_image_operations_checkerboard_pattern_fill,
-                      dx_asset_image_operation)
+DX_DEFINE_OBJECT_TYPE_WITH_DISPATCH("dx.asset.image_operations.checkerboard_pattern_fill",
+                                    dx_asset_image_operations_checkerboard_pattern_fill,
+                                    dx_asset_image_operation,
+                                    dx_asset_image_operation_dispatch)
 
 static void dx_asset_image_operations_checkerboard_pattern_fill_destruct(dx_asset_image_operations_checkerboard_pattern_fill* self)
 {/*Intentionally empty.*/}
 
+static int apply(dx_asset_image_operations_checkerboard_pattern_fill* self, dx_asset_image* image, dx_size left, dx_size top, dx_size width, dx_size height) {
+  if (!self->first_checker_color || !self->second_checker_color) {
+    dx_set_error(DX_INVALID_ARGUMENT);
+    return 1;
+  }
+  for (dx_size y = 0; y < self->number_of_checkers_vertical; ++y) {
+    dx_size t = top + y * self->checker_size_vertical,
+            h = self->checker_size_vertical;
+    // Rows of checkers which do not fit entirely are skipped.
+    if (t + h > top + height) {
+      continue;
+    }
+    for (dx_size x = 0; x < self->number_of_checkers_horizontal; ++x) {
+      dx_size l = left + x * self->checker_size_horizontal,
+              w = self->checker_size_horizontal;
+      // Fast clip.
+      if (l > left + width) {
+        continue;
+      }
+      // Slow clip.
+      if (l + w > left + width) {
+        dx_size delta = (l + w) - (left + width);
+        w -= delta;
+      }
+      int even_x = x % 2 == 0;
+      int even_y = y % 2 == 0;
+      if (even_x != even_y) {
+        if (dx_asset_image_fill(image, l, t, w, h, &self->first_checker_color->value)) {
+          return 1;
+        }
+      } else {
+        if (dx_asset_image_fill(image, l, t, w, h, &self->second_checker_color->value)) {
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+static void dx_asset_image_operations_checkerboard_pattern_fill_construct_dispatch(dx_asset_image_operation_dispatch* self) {
+  self->apply = (int(*)(dx_asset_image_operation*, dx_asset_image*, dx_size, dx_size, dx_size, dx_size)) & apply;
+}
+
 int dx_asset_image_operations_checkerboard_pattern_fill_construct(dx_asset_image_operations_checkerboard_pattern_fill* self) {
   dx_rti_type* _type = dx_asset_image_operations_checkerboard_pattern_fill_get_type();
   if (!_type) {
@@ -1,12 +1,23 @@
 #include "dx/asset/image_operations/color_fill.h"
 
-DX_DEFINE_OBJECT_TYPE("dx.asset.image_operations.color_fill",
-                      dx_asset_image_operations_color_fill,
-                      dx_asset_image_operation)
+#include "dx/asset/image.h"
+
+DX_DEFINE_OBJECT_TYPE_WITH_DISPATCH("dx.asset.image_operations.color_fill",
+                                    dx_asset_image_operations_color_fill,
+                                    dx_asset_image_operation,
+                                    dx_asset_image_operation_dispatch)
 
 static void dx_asset_image_operations_color_fill_destruct(dx_asset_image_operations_color_fill* self)
 {/*Intentionally empty.*/}
 
+static int apply(dx_asset_image_operations_color_fill* self, dx_asset_image* image, dx_size left, dx_size top, dx_size width, dx_size height) {
+  return dx_asset_image_fill(image, left, top, width, height, &self->color);
+}
+
+static void dx_asset_image_operations_color_fill_construct_dispatch(dx_asset_image_operation_dispatch* self) {
+  self->apply = (int(*)(dx_asset_image_operation*, dx_asset_image*, dx_size, dx_size, dx_size, dx_size)) & apply;
+}
+
 int dx_asset_image_operations_color_fill_construct(dx_asset_image_operations_color_fill* self) {
   dx_rti_type* _type = dx_asset_image_operations_color_fill_get_type();
   if (!_type) {
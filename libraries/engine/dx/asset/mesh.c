@@ -52,8 +52,11 @@ static int resize_vertex_arrays(dx_asset_mesh* self, dx_bool shrink, dx_size num
   }
   dx_memory_copy(ambient_uv, self->vertices.ambient_uv, dx_min_sz(self->number_of_vertices, number_of_vertices) * sizeof(DX_VEC2));
 
+  dx_memory_deallocate(self->vertices.xyz);
   self->vertices.xyz = xyz;
+  dx_memory_deallocate(self->vertices.ambient_rgba);
   self->vertices.ambient_rgba = ambient_rgba;
+  dx_memory_deallocate(self->vertices.ambient_uv);
   self->vertices.ambient_uv = ambient_uv;
   self->number_of_vertices = number_of_vertices;
 
@@ -120,11 +123,22 @@ static int dx_asset_mesh_construct(dx_asset_mesh* self, dx_string* name, dx_stri
   int (*generator)(dx_asset_mesh*)  = NULL;
 
 #define SELECT_GENERATOR(name) \
-  { \
+  if (!generator) { \
     dx_string* temporary = dx_string_create(#name, strlen(#name)); \
+    if (!temporary) { \
+      dx_memory_deallocate(self->vertices.ambient_uv); \
+      self->vertices.ambient_uv = NULL; \
+      dx_memory_deallocate(self->vertices.ambient_rgba); \
+      self->vertices.ambient_rgba = NULL; \
+      dx_memory_deallocate(self->vertices.xyz); \
+      self->vertices.xyz = NULL; \
+      return 1; \
+    } \
     if (dx_string_is_equal_to(specifier, temporary)) { \
       generator = &dx_asset_mesh_on_##name; \
     } \
+    DX_UNREFERENCE(temporary); \
+    temporary = NULL; \
   }
 
 SELECT_GENERATOR(cube)
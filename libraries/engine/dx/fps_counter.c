@@ -46,6 +46,7 @@ int dx_fps_counter_on_enter_frame(dx_fps_counter* self) {
   }
   self->started = true;
   self->start = GetTickCount64();
+  dx_memory_enter_frame();
   return 0;
 }
 
@@ -58,6 +59,9 @@ int dx_fps_counter_on_leave_frame(dx_fps_counter* self) {
   }
   dx_n64 delta = GetTickCount64() - self->start;
   self->started = false;
+  // Report frames exceeding the allocation budget.
+  // The frame is nevertheless accounted for.
+  dx_memory_leave_frame();
   self->durations[self->write] = delta;
   self->write = (self->write + 1) % 64;
   if (self->size < 64) {
@@ -31,8 +31,16 @@ int dx_fps_counter_construct(dx_fps_counter* self);
 
 dx_fps_counter* dx_fps_counter_create();
 
+/// @brief Enter a frame.
+/// @param self A pointer to this FPS counter.
+/// @return The zero value on success. A non-zero value on failure.
+/// @remarks Allocations on the calling thread are counted until the frame is left (see dx_memory_enter_frame).
 int dx_fps_counter_on_enter_frame(dx_fps_counter* self);
 
+/// @brief Leave a frame.
+/// @param self A pointer to this FPS counter.
+/// @return The zero value on success. A non-zero value on failure.
+/// @remarks Frames exceeding the allocation budget are reported (see dx_memory_leave_frame).
 int dx_fps_counter_on_leave_frame(dx_fps_counter* self);
 
 dx_f64 dx_fps_counter_get_fps(dx_fps_counter* self);
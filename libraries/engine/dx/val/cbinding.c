@@ -1,16 +1,13 @@
 #include "dx/val/cbinding.h"
 
-// strcmp
+// strcmp, strlen
 #include <string.h>
 
-typedef struct _entry _entry;
+#include "dx/core/typed_hashmap.h"
 
-typedef struct _map _map;
+typedef struct _value _value;
 
-struct _entry {
-  _entry* next;
-  dx_size hv;
-  char* name;
+struct _value {
   uint8_t tag;
   union {
     DX_VEC3 vec3;
@@ -20,132 +17,107 @@ struct _entry {
   };
 };
 
-struct _map{
-  _entry** buckets;
-  dx_size size;
-  dx_size capacity;
-};
+static inline dx_size _hash_name(char* const* name) {
+  return dx_hash_bytes(*name, strlen(*name));
+}
+
+static inline bool _are_names_equal(char* const* x, char* const* y) {
+  return !strcmp(*x, *y);
+}
 
-static dx_size hash(char const* p, dx_size n) {
-  dx_size hv = n;
-  for (dx_size i = n; i > 0; --i) {
-    hv = hv * 37 + (dx_size)(p[i - 1]);
+static int _copy_name(char** target, char* const* source) {
+  *target = dx_memory_duplicate_string(*source);
+  if (!*target) {
+    dx_set_error(DX_ALLOCATION_FAILED);
+    return 1;
   }
-  return hv;
+  return 0;
+}
+
+static inline void _name_removed(char** name) {
+  dx_memory_deallocate(*name);
+  *name = NULL;
 }
 
+// Maps names to values. The map owns its names.
+DX_DEFINE_TYPED_HASHMAP(_map,
+                        char*,
+                        _value,
+                        _hash_name,
+                        _are_names_equal,
+                        DX_TYPED_HASHMAP_NO_HOOK,
+                        _name_removed,
+                        DX_TYPED_HASHMAP_NO_HOOK,
+                        DX_TYPED_HASHMAP_NO_HOOK)
+
 static void* _create_impl();
 
 static void _destroy_impl(void* pimpl);
 
-static _entry* get_or_create_impl(_map* map, bool create, char const* name);
+static _value* get_or_create_impl(_map* map, char const* name);
 
 static void* _create_impl() {
   _map* map = dx_memory_allocate(sizeof(_map));
   if (!map) {
     return NULL;
   }
-  map->size = 0;
-  map->capacity = 8;
-  map->buckets = dx_memory_allocate(sizeof(_entry) * map->capacity);
-  if (!map->buckets) {
+  if (_map_initialize(map)) {
     dx_memory_deallocate(map);
     map = NULL;
     return NULL;
   }
-  for (dx_size i = 0, n = map->capacity; i < n; ++i) {
-    map->buckets[i] = NULL;
-  }
   return map;
 }
 
 static void _destroy_impl(void* pimpl) {
   _map* map = (_map*)pimpl;
-  for (dx_size i = 0, n = map->capacity; i < n; ++i) {
-    while (map->buckets[i]) {
-      _entry* entry = map->buckets[i];
-      map->buckets[i] = entry->next;
-      dx_memory_deallocate(entry->name);
-      entry->name = NULL;
-      dx_memory_deallocate(entry);
-      map->size--;
-    }
-  }
-  dx_memory_deallocate(map->buckets);
-  map->buckets = NULL;
+  _map_uninitialize(map);
   dx_memory_deallocate(map);
 }
 
-static _entry* get_or_create_impl(_map* map, bool create, char const* name) {
-  dx_size n = strlen(name);
-  dx_size hv = hash(name, n);
-  dx_size hi = hv % map->capacity;
-  for (_entry* entry = map->buckets[hi]; NULL != entry; entry = entry->next) {
-    if (entry->hv == hv) {
-      if (!strcmp(entry->name, name)) {
-        return entry;
-      }
-    }
-  }
-  if (!create) {
-    return NULL;
-  }
-  _entry* entry = dx_memory_allocate(sizeof(_entry));
-  if (!entry) {
-    return NULL;
-  }
-  entry->hv = hv;
-  entry->name = _strdup(name);
-  if (!entry->name) {
-    dx_set_error(DX_ALLOCATION_FAILED);
-    dx_memory_deallocate(entry);
-    entry = NULL;
-    return NULL;
-  }
-  entry->tag = DX_CBINDING_TYPE_EMPTY;
-  entry->next = map->buckets[hi];
-  map->buckets[hi] = entry;
-  map->size++;
-  return entry;
+static _value* get_or_create_impl(_map* map, char const* name) {
+  _value value = { .tag = DX_CBINDING_TYPE_EMPTY };
+  // The name is not modified by the hashmap. If an entry is added, then the map owns a copy of the name.
+  return _map_find_or_insert(map, (char*)name, value, &_copy_name);
 }
 
 int dx_cbinding_set_vec3(dx_cbinding* self, char const* name, DX_VEC3 const* v) {
-  _entry* entry = get_or_create_impl((_map*)self->pimpl, true, name);
-  if (!entry) {
+  _value* value = get_or_create_impl((_map*)self->pimpl, name);
+  if (!value) {
     return 1;
   }
-  entry->tag = DX_CBINDING_TYPE_VEC3;
-  entry->vec3 = *v;
+  value->tag = DX_CBINDING_TYPE_VEC3;
+  value->vec3 = *v;
   return 0;
 }
 
 int dx_cbinding_set_vec4(dx_cbinding* self, char const* name, DX_VEC4 const* v) {
-  _entry* entry = get_or_create_impl((_map*)self->pimpl, true, name);
-  if (!entry) {
+  _value* value = get_or_create_impl((_map*)self->pimpl, name);
+  if (!value) {
     return 1;
   }
-  entry->tag = DX_CBINDING_TYPE_VEC4;
-  entry->vec4 = *v;
+  value->tag = DX_CBINDING_TYPE_VEC4;
+  value->vec4 = *v;
   return 0;
 }
 
 int dx_cbinding_set_mat4(dx_cbinding* self, char const *name, DX_MAT4 const* a) {
-  _entry* entry = get_or_create_impl((_map*)self->pimpl, true, name);
-  if (!entry) {
+  _value* value = get_or_create_impl((_map*)self->pimpl, name);
+  if (!value) {
     return 1;
   }
-  entry->tag = DX_CBINDING_TYPE_MAT4;
-  entry->mat4 = *a;
+  value->tag = DX_CBINDING_TYPE_MAT4;
+  value->mat4 = *a;
   return 0;
 }
 
 int dx_cbinding_set_texture_index(dx_cbinding* self, char const* name, dx_size i) {
-  _entry* entry = get_or_create_impl((_map*)self->pimpl, true, name);
-  if (!entry) {
+  _value* value = get_or_create_impl((_map*)self->pimpl, name);
+  if (!value) {
     return 1;
   }
-  entry->tag = DX_CBINDING_TYPE_TEXTURE_INDEX;
-  entry->texture_index = i;
+  value->tag = DX_CBINDING_TYPE_TEXTURE_INDEX;
+  value->texture_index = i;
   return 0;
 }
 
@@ -186,109 +158,90 @@ dx_cbinding* dx_cbinding_create() {
 
 dx_cbinding_iter dx_cbinding_get_iter(dx_cbinding* self) {
   _map* map = (_map*)self->pimpl;
-  for (dx_size i = 0, n = map->capacity; i < n; ++i) {
-    if (NULL != map->buckets[i]) {
-      dx_cbinding_iter it = { .a = (void*)i, .b = map->buckets[i], .c = map };
-      return it;
-    }
-  }
-  dx_cbinding_iter it = { .a = (void*)map->capacity, .b = NULL, .c = map };
+  dx_size index = _map_next(map, 0);
+  dx_cbinding_iter it = { .a = (void*)index, .b = NULL, .c = map };
   return it;
 }
 
 int dx_cbinding_iter_next(dx_cbinding_iter* self) {
   _map* map = (_map*)self->c;
-  _entry* entry = (_entry*)self->b;
-  if (entry) {
-    entry = entry->next;
-    if (entry) {
-      // Found successor in current bucket. Done.
-      self->b = (void*)entry;
-      return 0;
-    } else {
-      // Found NO successor in current bucket. move to next non-empty bucket if any.
-      dx_size index = (dx_size)self->a;
-      index++;
-      for (; index < map->capacity && !map->buckets[index]; ++index) {
-
-      }
-      if (index == map->capacity) {
-        // Found no next non-empty bucket. Done.
-        self->a = (void*)index;
-        self->b = NULL;
-        return 0;
-      } else {
-        // Found next non-empty bucket. Done.
-        self->a = (void*)index;
-        self->b = map->buckets[index];
-        return 0;
-      }
-    }
-  } else {
-    // Is already at end. Done.
-    return 0;
+  dx_size index = (dx_size)self->a;
+  if (index < _map_get_capacity(map)) {
+    self->a = (void*)_map_next(map, index + 1);
+  }
+  return 0;
+}
+
+/// @brief Get the entry of a cbinding iterator.
+/// @return A pointer to the entry if the iterator has a value. The null pointer otherwise.
+static inline _map_entry* _get_entry(dx_cbinding_iter const* self) {
+  _map* map = (_map*)self->c;
+  dx_size index = (dx_size)self->a;
+  if (index == _map_get_capacity(map)) {
+    return NULL;
   }
+  return _map_get_entry(map, index);
 }
 
 bool dx_cbinding_iter_has_value(dx_cbinding_iter const* self) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   return NULL != entry;
 }
 
 uint8_t dx_cbinding_iter_get_tag(dx_cbinding_iter const* self) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   if (!entry) {
     dx_set_error(DX_INVALID_OPERATION);
     return DX_CBINDING_TYPE_EMPTY;
   }
-  return entry->tag;
+  return entry->value.tag;
 }
 
 char const* dx_cbinding_iter_get_name(dx_cbinding_iter const* self) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   if (!entry) {
     dx_set_error(DX_INVALID_OPERATION);
     return DX_CBINDING_TYPE_EMPTY;
   }
-  return entry->name;
+  return entry->key;
 }
 
 int dx_cbinding_iter_get_vec3(dx_cbinding_iter const* self, DX_VEC3* v) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   if (!entry) {
     dx_set_error(DX_INVALID_OPERATION);
     return DX_CBINDING_TYPE_EMPTY;
   }
-  *v = entry->vec3;
+  *v = entry->value.vec3;
   return 0;
 }
 
 int dx_cbinding_iter_get_vec4(dx_cbinding_iter const* self, DX_VEC4* v) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   if (!entry) {
     dx_set_error(DX_INVALID_OPERATION);
     return DX_CBINDING_TYPE_EMPTY;
   }
-  *v = entry->vec4;
+  *v = entry->value.vec4;
   return 0;
 }
 
 int dx_cbinding_iter_get_mat4(dx_cbinding_iter const* self, DX_MAT4* a) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   if (!entry) {
     dx_set_error(DX_INVALID_OPERATION);
     return DX_CBINDING_TYPE_EMPTY;
   }
-  *a = entry->mat4;
+  *a = entry->value.mat4;
   return 0;
 }
 
 int dx_cbinding_iter_get_texture_index(dx_cbinding_iter const* self, dx_size* i) {
-  _entry* entry = (_entry*)self->b;
+  _map_entry* entry = _get_entry(self);
   if (!entry) {
     dx_set_error(DX_INVALID_OPERATION);
     return DX_CBINDING_TYPE_EMPTY;
   }
-  *i = entry->texture_index;
+  *i = entry->value.texture_index;
   return 0;
 }
@@ -2,18 +2,31 @@
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+DX_DEFINE_OBJECT_TYPE("dx.command",
+                      dx_command,
+                      dx_object)
+
 int dx_command_construct_clear_color(dx_command* command, dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h, DX_VEC4 const* color) {
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return 1;
+  }
   command->kind = DX_COMMAND_KIND_CLEAR_COLOR;
   command->clear_color_command.rectangle.l = l;
   command->clear_color_command.rectangle.b = b;
   command->clear_color_command.rectangle.w = w;
   command->clear_color_command.rectangle.h = h;
   command->clear_color_command.color = *color;
+  DX_OBJECT(command)->type = _type;
   return 0;
 }
 
 dx_command* dx_command_create_clear_color(dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h, DX_VEC4 const* color) {
-  dx_command* command = DX_COMMAND(dx_object_alloc(sizeof(dx_command)));
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return NULL;
+  }
+  dx_command* command = DX_COMMAND(dx_object_alloc_pooled(_type));
   if (!command) {
     return NULL;
   }
@@ -26,17 +39,26 @@ dx_command* dx_command_create_clear_color(dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h
 }
 
 int dx_command_construct_clear_depth(dx_command* command, dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h, dx_f32 depth) {
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return 1;
+  }
   command->kind = DX_COMMAND_KIND_CLEAR_DEPTH;
   command->clear_depth_command.rectangle.l = l;
   command->clear_depth_command.rectangle.b = b;
   command->clear_depth_command.rectangle.w = w;
   command->clear_depth_command.rectangle.h = h;
   command->clear_depth_command.depth = depth;
+  DX_OBJECT(command)->type = _type;
   return 0;
 }
 
 dx_command* dx_command_create_clear_depth(dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h, dx_f32 depth) {
-  dx_command* command = DX_COMMAND(dx_object_alloc(sizeof(dx_command)));
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return NULL;
+  }
+  dx_command* command = DX_COMMAND(dx_object_alloc_pooled(_type));
   if (!command) {
     return NULL;
   }
@@ -49,6 +71,10 @@ dx_command* dx_command_create_clear_depth(dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h
 }
 
 int dx_command_construct_draw(dx_command* command, dx_vbinding* vbinding, dx_val_material* material, dx_cbinding* cbinding, dx_program* program, int start, int length) {
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return 1;
+  }
   command->kind = DX_COMMAND_KIND_DRAW;
   command->draw_command.vbinding = vbinding;
   DX_REFERENCE(vbinding);
@@ -60,11 +86,16 @@ int dx_command_construct_draw(dx_command* command, dx_vbinding* vbinding, dx_val
   DX_REFERENCE(program);
   command->draw_command.start = start;
   command->draw_command.length = length;
+  DX_OBJECT(command)->type = _type;
   return 0;
 }
 
 dx_command* dx_command_create_draw(dx_vbinding* vbinding, dx_val_material* material, dx_cbinding* cbinding, dx_program* program, int start, int length) {
-  dx_command* command = DX_COMMAND(dx_object_alloc(sizeof(dx_command)));
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return NULL;
+  }
+  dx_command* command = DX_COMMAND(dx_object_alloc_pooled(_type));
   if (!command) {
     return NULL;
   }
@@ -77,16 +108,25 @@ dx_command* dx_command_create_draw(dx_vbinding* vbinding, dx_val_material* mater
 }
 
 int dx_command_construct_viewport(dx_command* command, dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h) {
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return 1;
+  }
   command->kind = DX_COMMAND_KIND_VIEWPORT;
   command->viewport_command.l = l;
   command->viewport_command.b = b;
   command->viewport_command.w = w;
   command->viewport_command.h = h;
+  DX_OBJECT(command)->type = _type;
   return 0;
 }
 
 dx_command* dx_command_create_viewport(dx_f32 l, dx_f32 b, dx_f32 w, dx_f32 h) {
-  dx_command* command = DX_COMMAND(dx_object_alloc(sizeof(dx_command)));
+  dx_rti_type* _type = dx_command_get_type();
+  if (!_type) {
+    return NULL;
+  }
+  dx_command* command = DX_COMMAND(dx_object_alloc_pooled(_type));
   if (!command) {
     return NULL;
   }
@@ -44,14 +44,19 @@ static void remove_from_backend(dx_mesh* self);
 static dx_program_text* load_program(dx_string* path, dx_string* filename, uint8_t flags) {
   dx_program_text* vertex_program = NULL, * fragment_program = NULL;
   dx_program_text* program = NULL;
+  // The format of the paths of the vertex program and the fragment program is compiled once.
+  dx_string_format* format = dx_string_format_create("${s}/${s}.${s}", sizeof("${s}/${s}.${s}") - 1);
+  if (!format) {
+    goto on_error;
+  }
   {
-    dx_string* format = dx_string_create("${s}/${s}.vs", sizeof("${s}/${s}.vs") - 1);
-    if (!format) {
+    dx_string* extension = dx_string_create_atom("vs", sizeof("vs") - 1);
+    if (!extension) {
       goto on_error;
     }
-    dx_string* p = dx_string_printf(format, path, filename);
-    DX_UNREFERENCE(format);
-    format = NULL;
+    dx_string* p = dx_string_format_printf(format, path, filename, extension);
+    DX_UNREFERENCE(extension);
+    extension = NULL;
     if (!p) {
       goto on_error;
     }
@@ -63,13 +68,13 @@ static dx_program_text* load_program(dx_string* path, dx_string* filename, uint8
     }
   }
   {
-    dx_string* format = dx_string_create("${s}/${s}.fs", sizeof("${s}/${s}.fs") - 1);
-    if (!format) {
+    dx_string* extension = dx_string_create_atom("fs", sizeof("fs") - 1);
+    if (!extension) {
       goto on_error;
     }
-    dx_string* p = dx_string_printf(format, path, filename);
-    DX_UNREFERENCE(format);
-    format = NULL;
+    dx_string* p = dx_string_format_printf(format, path, filename, extension);
+    DX_UNREFERENCE(extension);
+    extension = NULL;
     if (!p) {
       goto on_error;
     }
@@ -80,6 +85,8 @@ static dx_program_text* load_program(dx_string* path, dx_string* filename, uint8
       goto on_error;
     }
   }
+  DX_UNREFERENCE(format);
+  format = NULL;
   {
     program = dx_program_text_create(vertex_program, fragment_program);
     DX_UNREFERENCE(vertex_program);
@@ -172,6 +179,10 @@ on_error:
     DX_UNREFERENCE(vertex_program);
     vertex_program = NULL;
   }
+  if (format) {
+    DX_UNREFERENCE(format);
+    format = NULL;
+  }
   return NULL;
 }
 
@@ -534,7 +534,7 @@ int dx_gl_wgl_application_construct(dx_gl_wgl_application* self, dx_msg_queue* m
     return 1;
   }
   //
-  self->class_name = _strdup("dx.gl.wgl.window.class_name");
+  self->class_name = dx_memory_duplicate_string("dx.gl.wgl.window.class_name");
   if (!self->class_name) {
     dx_set_error(DX_ALLOCATION_FAILED);
     return 1;